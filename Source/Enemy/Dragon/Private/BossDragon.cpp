@@ -4,6 +4,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h" // GAS 라이브러리 필수
 #include "MotionWarpingComponent.h"
+#include "Combat/EffectQueueSubsystem.h"
 
 ABossDragon::ABossDragon()
 {
@@ -75,11 +76,17 @@ void ABossDragon::OnRushOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor
 			// 레벨 1.0 기준으로 Effect 생성
 			FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(RushDamageEffect, 1.0f, ContextHandle);
 
-			if (SpecHandle.IsValid())
+			// 데미지 적용 큐에 제출
+			// 플레이어의 여러 컴포넌트가 같은 프레임에 겹쳐도 돌진 한 프레임에 한 번만 적용
+			UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(this);
+			if (SpecHandle.IsValid() && !EffectQueue)
 			{
-				// 데미지 적용!
+				// 큐가 없는 월드에서는 바로 적용
 				AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-
+				UE_LOG(LogTemp, Warning, TEXT("[BossDragon] Rush HIT! Damaged Actor: %s"), *OtherActor->GetName());
+			}
+			else if (SpecHandle.IsValid() && EffectQueue->QueueEffect(AbilitySystemComponent, TargetASC, SpecHandle, FGameplayTag(), this))
+			{
 				// 로그 출력
 				UE_LOG(LogTemp, Warning, TEXT("[BossDragon] Rush HIT! Damaged Actor: %s"), *OtherActor->GetName());
 			}
@@ -3,6 +3,7 @@
 #include "BehaviorTree/BehaviorTree.h" // 헤더 추가 필요
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
+#include "Grid/BlockHazardFieldSubsystem.h"
 
 AEnemyAI::AEnemyAI()
 {
@@ -38,6 +39,14 @@ void AEnemyAI::UpdateAIState()
 	if (Blackboard)
 	{
 		Blackboard->SetValueAsObject(BBKey_TargetActor, NewTarget);
+
+		// 위험 거리장은 O(1) 조회이므로 별도의 오버랩 검사 없이 매 갱신마다 기록
+		APawn* OwningPawn = GetPawn();
+		UBlockHazardFieldSubsystem* HazardField = GetWorld()->GetSubsystem<UBlockHazardFieldSubsystem>();
+		if (OwningPawn && HazardField)
+		{
+			Blackboard->SetValueAsFloat(BBKey_HazardDistance, HazardField->GetHazardDistanceAtLocation(OwningPawn->GetActorLocation()));
+		}
 	}
 }
 
@@ -3,6 +3,7 @@
 #include "EnemyAttributeSet.h" 
 #include "GameplayEffectExtension.h" // GE 관련 헤더
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Combat/EffectQueueSubsystem.h" // 프레임 단위 GE 적용 큐
 #include "Components/CapsuleComponent.h" // 캡슐 콜리전 설정용
 #include "Components/SkeletalMeshComponent.h" // 메쉬 설정용
 #include "AIController.h" // AI 컨트롤러 접근용
@@ -120,10 +121,18 @@ void AEnemyBase::OnAttackHit(AActor* TargetActor)
 
 		if (SpecHandle.IsValid())
 		{
-			// 3. 데미지 적용!
-			AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-
-			UE_LOG(LogTemp, Log, TEXT("[EnemyBase] Successfully applied damage to %s"), *TargetActor->GetName());
+			// 3. 데미지 적용 큐에 제출 (같은 프레임에 같은 대상이 여러 번 잡혀도 한 번만 적용)
+			UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(this);
+			if (!EffectQueue)
+			{
+				// 큐가 없는 월드에서는 바로 적용
+				AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+				UE_LOG(LogTemp, Log, TEXT("[EnemyBase] Applied damage to %s"), *TargetActor->GetName());
+			}
+			else if (EffectQueue->QueueEffect(AbilitySystemComponent, TargetASC, SpecHandle, FGameplayTag(), this))
+			{
+				UE_LOG(LogTemp, Log, TEXT("[EnemyBase] Queued damage to %s"), *TargetActor->GetName());
+			}
 		}
 	}
 }
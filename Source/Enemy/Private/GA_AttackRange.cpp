@@ -1,5 +1,7 @@
-#include "Enemy/Public/GA_AttackRange.h" //   
-#include "Block/BlockBase.h"             // ٴ  Ŭ (World )
+#include "Enemy/Public/GA_AttackRange.h" // 내 헤더 파일
+#include "Block/BlockBase.h"             // 바닥 블록 클래스 (World 모듈)
+#include "Grid/BlockGridSubsystem.h"     // 블록 그리드 조회 (World 모듈)
+#include "Grid/BlockHazardFieldSubsystem.h" // 위험 거리장 (World 모듈)
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
 #include "Abilities/Tasks/AbilityTask_WaitDelay.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
@@ -12,9 +14,9 @@
 
 UGA_AttackRange::UGA_AttackRange()
 {
-	// Ƽ νϽ: ͸ ¸   (  ʼ)
+	// 어빌리티 인스턴싱: 액터마다 상태를 별도로 관리 (변수 저장 필수)
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
-	//   å:     ʿ
+	// 서버 실행 정책: 데미지 판정은 서버 권한 필요
 	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::ServerOnly;
 }
 
@@ -30,48 +32,48 @@ void UGA_AttackRange::ActivateAbility(const FGameplayAbilitySpecHandle Handle, c
 	}
 
 	// =================================================================
-	// [б A] Ÿְ ִ  (NŸ ޺ )
+	// [분기 A] 몽타주가 있는 경우 (N연타 콤보 로직)
 	// =================================================================
 	if (AttackMontage)
 	{
 
-		// 1. Ÿ  
+		// 1. 몽타주 재생 시작
 		UAbilityTask_PlayMontageAndWait* MontageTask = UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(
 			this, NAME_None, AttackMontage, TelegraphPlayRate, NAME_None, false
 		);
 
-		// Ÿְ ų ߴܵǸ ų  (EndAbility)
+		// 몽타주가 끝나거나 중단되면 스킬을 완전히 종료(EndAbility)
 		MontageTask->OnCompleted.AddDynamic(this, &UGA_AttackRange::OnMontageFinished);
 		MontageTask->OnInterrupted.AddDynamic(this, &UGA_AttackRange::OnMontageFinished);
 		MontageTask->OnBlendOut.AddDynamic(this, &UGA_AttackRange::OnMontageFinished);
 		MontageTask->ReadyForActivation();
 
-		// 2. Hit̺Ʈ  ( ݺ)
-		// OnlyTriggerOnce = false Ͽ 2Ÿ, 3Ÿ ȣ  
+		// 2. Hit이벤트 대기 (무한 반복)
+		// OnlyTriggerOnce = false로 설정하여 2타, 3타 신호도 계속 받음
 		UAbilityTask_WaitGameplayEvent* WaitHitTask = UAbilityTask_WaitGameplayEvent::WaitGameplayEvent(
 			this,
-			HitEventTag, // : Event.Montage.Hit
+			HitEventTag, // 예: Event.Montage.Hit
 			nullptr,
-			false, // OnlyTriggerOnce = false (߿!)
+			false, // OnlyTriggerOnce = false (중요!)
 			false
 		);
 		WaitHitTask->EventReceived.AddDynamic(this, &UGA_AttackRange::OnHitEventReceived);
 		WaitHitTask->ReadyForActivation();
 
-		// 3. Telegraph ̺Ʈ  ( ݺ)
-		// 2Ÿ, 3Ÿ  غ ȣ 
+		// 3. Telegraph 이벤트 대기 (무한 반복)
+		// 2타, 3타 공격 준비 신호를 받음
 		UAbilityTask_WaitGameplayEvent* WaitTelegraphTask = UAbilityTask_WaitGameplayEvent::WaitGameplayEvent(
 			this,
-			TelegraphEventTag, // : Event.Montage.Telegraph
+			TelegraphEventTag, // 예: Event.Montage.Telegraph
 			nullptr,
-			false, // OnlyTriggerOnce = false (߿!)
+			false, // OnlyTriggerOnce = false (중요!)
 			false
 		);
 		WaitTelegraphTask->EventReceived.AddDynamic(this, &UGA_AttackRange::EnableTelegraph);
 		WaitTelegraphTask->ReadyForActivation();
 
-		// 4. [ɼ] ùŸ   ѱ
-		// Ÿ 0.0ʿ Ƽ̰   , ϰ 1Ÿ  ٷ մϴ.
+		// 4. [옵션] 첫타 장판 즉시 켜기
+		// 몽타주 0.0초에 노티파이가 없을 수도 있으니, 안전하게 1타 장판은 바로 켭니다.
 		FGameplayEventData DummyData;
 		EnableTelegraph(DummyData);
 
@@ -79,36 +81,44 @@ void UGA_AttackRange::ActivateAbility(const FGameplayAbilitySpecHandle Handle, c
 			TimerHandle_SpeedUp,
 			this,
 			&UGA_AttackRange::RestoreMontageSpeed,
-			TelegraphDuration, // n  
+			TelegraphDuration, // n초 뒤 실행
 			false
 		);
 	}
 	// =================================================================
-	// [б B] Ÿְ   (ܼ Ÿ̸  -  ȣȯ)
+	// [분기 B] 몽타주가 없는 경우 (단순 타이머 로직 - 구버전 호환)
 	// =================================================================
 	else
 	{
 		FGameplayEventData DummyData;
-		EnableTelegraph(DummyData); //  ѱ
+		EnableTelegraph(DummyData); // 장판 켜기
 
-		// ð    
+		// 시간 대기 후 공격 실행
 		UAbilityTask_WaitDelay* DelayTask = UAbilityTask_WaitDelay::WaitDelay(this, TelegraphDuration);
-		DelayTask->OnFinish.AddDynamic(this, &UGA_AttackRange::ExecuteAttack); // ⼭ ExecuteAttack  ؾ  ()
+		DelayTask->OnFinish.AddDynamic(this, &UGA_AttackRange::ExecuteAttack); // 여기서는 ExecuteAttack이 종료까지 담당해야 함 (주의)
 		DelayTask->ReadyForActivation();
 	}
 }
 
-// [Լ 1] ٴ   ѱ (2Ÿ, 3Ÿ  Ȱ)
+void UGA_AttackRange::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	// 장판이 켜진 채로 취소되면 위험원이 남으므로 정리
+	ResetBlockColors();
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+// [함수 1] 바닥 빨간 장판 켜기 (2타, 3타 때 재활용됨)
 void UGA_AttackRange::EnableTelegraph(FGameplayEventData Payload)
 {
 	APawn* AvatarPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
 	if (!AvatarPawn) return;
 
-	// Ȥ ִ  ִٸ ʱȭ ( )
+	// 혹시 켜져있는 색상이 있다면 초기화 (깜빡임 방지)
 	ResetBlockColors();
 
-	// 1.  ġ   ڽ 
-	// (Root Motion  ̵  Ƿ Ź  մϴ)
+	// 1. 현재 위치 기준으로 범위 박스 계산
+	// (Root Motion으로 보스가 이동했을 수 있으므로 매번 새로 계산합니다)
 	FVector ForwardDir = AvatarPawn->GetActorForwardVector();
 	FVector Origin = AvatarPawn->GetActorLocation();
 
@@ -117,32 +127,35 @@ void UGA_AttackRange::EnableTelegraph(FGameplayEventData Payload)
 	CachedTargetLocation = Origin + (ForwardDir * (AttackForwardOffset + HalfLength));
 	FVector BoxCenter = CachedTargetLocation;
 
-	// ٴ    (-50)
+	// 바닥 감지용 높이 보정 (-50)
 	BoxCenter.Z -= 50.0f;
 
 	FVector BoxExtent = FVector(HalfLength, AttackWidth * 0.5f, 50.0f);
 
-	// 2.  ˻ (WorldStatic = )
-	TArray<AActor*> OverlappedActors;
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_WorldStatic));
+	// 2. 그리드에서 범위 안의 블록 셀 조회 (물리 오버랩 대신)
+	UBlockGridSubsystem* Grid = GetWorld()->GetSubsystem<UBlockGridSubsystem>();
+	if (!Grid) return;
 
-	UKismetSystemLibrary::BoxOverlapActors(
-		this, BoxCenter, BoxExtent, ObjectTypes, ABlockBase::StaticClass(),
-		{ AvatarPawn }, OverlappedActors
-	);
+	TelegraphCells.Reset();
+	Grid->GetOccupiedCellsInBox(FBox(BoxCenter - BoxExtent, BoxCenter + BoxExtent), TelegraphCells);
 
-	// 3.    
-	for (AActor* Actor : OverlappedActors)
+	// 3. 색상 변경 및 저장
+	for (const FIntVector& Cell : TelegraphCells)
 	{
-		if (ABlockBase* Block = Cast<ABlockBase>(Actor))
+		if (ABlockBase* Block = Grid->GetBlockAt(Cell))
 		{
 			Block->SetHighlightState(EBlockHighlightState::Danger);
 			AffectedBlocks.Add(Block);
 		}
 	}
 
-	// Ÿ ӵ ٽ  ( )
+	// 4. 장판 셀을 위험 거리장에 임시 위험원으로 등록 (AI 회피 등에서 같은 정보를 사용)
+	if (UBlockHazardFieldSubsystem* HazardField = GetWorld()->GetSubsystem<UBlockHazardFieldSubsystem>())
+	{
+		HazardField->AddHazardSources(TelegraphCells);
+	}
+
+	// 몽타주 속도를 다시 늦춤 (관성 느낌)
 	ACharacter* Character = Cast<ACharacter>(GetAvatarActorFromActorInfo());
 	if (Character && Character->GetMesh()->GetAnimInstance())
 	{
@@ -151,7 +164,7 @@ void UGA_AttackRange::EnableTelegraph(FGameplayEventData Payload)
 		{
 			AnimInst->Montage_SetPlayRate(AttackMontage, TelegraphPlayRate);
 
-			// ٽ n ڿ  Ÿ̸ 缳
+			// 다시 n초 뒤에 빨라지도록 타이머 재설정
 			GetWorld()->GetTimerManager().SetTimer(
 				TimerHandle_SpeedUp,
 				this,
@@ -163,20 +176,20 @@ void UGA_AttackRange::EnableTelegraph(FGameplayEventData Payload)
 	}
 }
 
-// [Լ 2] Ÿֿ 'Hit' ȣ  ȣ
+// [함수 2] 몽타주에서 'Hit' 신호가 오면 호출
 void UGA_AttackRange::OnHitEventReceived(FGameplayEventData Payload)
 {
-	//    ( +  )
+	// 실제 공격 수행 (데미지 + 장판 끄기)
 	ExecuteAttack();
 
-	// [߿] ⼭ EndAbility ȣ ʽϴ!
-	// Ÿְ Ҵٸ  (2Ÿ)  ٷ ϱ Դϴ.
+	// [중요] 여기서 EndAbility를 호출하지 않습니다!
+	// 몽타주가 남았다면 다음 공격(2타)을 위해 기다려야 하기 때문입니다.
 }
 
-// [Լ 3]      
+// [함수 3] 실제 데미지 적용 및 장판 끄기
 void UGA_AttackRange::ExecuteAttack()
 {
-	// 1. ٴ  
+	// 1. 바닥 장판 끄기
 	ResetBlockColors();
 
 	APawn* AvatarPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
@@ -184,37 +197,37 @@ void UGA_AttackRange::ExecuteAttack()
 
 	FVector BoxCenter = CachedTargetLocation;
 	
-	// ÷̾    (+50)
+	// 플레이어 몸통 높이 보정 (+50)
 	BoxCenter.Z += 50.0f;
 
-	// (Z) ˳ϰ(100) ־  ÷̾ ° 
+	// 높이(Z)를 넉넉하게(100) 주어 점프한 플레이어도 맞게 설정
 	float HalfLength = AttackRangeForward * 0.5f;
 	FVector BoxExtent = FVector(HalfLength, AttackWidth * 0.5f, 100.0f);
 
-	//  [ ߰]   ڽ ȭ鿡 2ʰ ׸ϴ 
+	// ▼▼▼ [디버그 추가] 공격 판정 박스를 화면에 2초간 그립니다 ▼▼▼
 	DrawDebugBox(
 		GetWorld(),
 		BoxCenter,
 		BoxExtent,
-		FColor::Green, // Ÿ ڽ ʷϻ
+		FColor::Green, // 타격 박스는 초록색
 		false,
 		2.0f
 	);
-	// 
+	// ▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲▲
 
 
 	TArray<AActor*> OverlappedPawns;
 	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
 	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
 
-	// 3. (Pawn) 
+	// 3. 적(Pawn) 감지
 	UKismetSystemLibrary::BoxOverlapActors(
 		this, BoxCenter, BoxExtent, ObjectTypes, APawn::StaticClass(),
 		{ AvatarPawn }, OverlappedPawns
 	);
 
 
-	// 4. (GE) 
+	// 4. 데미지(GE) 적용
 	if (DamageEffectClass)
 	{
 		FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(DamageEffectClass);
@@ -234,24 +247,24 @@ void UGA_AttackRange::ExecuteAttack()
 		}
 	}
 
-	// (Ÿְ   쿡 ⼭ )
+	// (몽타주가 없는 예외적인 경우에만 여기서 종료)
 	if (!AttackMontage)
 	{
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 	}
 }
 
-// [Լ 4] Ÿְ   ȣ (ų )
+// [함수 4] 몽타주가 완전히 끝나면 호출 (스킬 종료)
 void UGA_AttackRange::OnMontageFinished()
 {
-	//   ä    
+	// 장판이 켜진 채로 끝났을 수도 있으니 정리
 	ResetBlockColors();
 
-	// ¥ 
+	// 진짜 종료
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
-// []   ʱȭ
+// [헬퍼] 블록 색상 초기화
 void UGA_AttackRange::ResetBlockColors()
 {
 	for (TWeakObjectPtr<ABlockBase> BlockPtr : AffectedBlocks)
@@ -262,6 +275,16 @@ void UGA_AttackRange::ResetBlockColors()
 		}
 	}
 	AffectedBlocks.Empty();
+
+	// 장판으로 등록했던 임시 위험원 해제
+	if (TelegraphCells.Num() > 0)
+	{
+		if (UBlockHazardFieldSubsystem* HazardField = GetWorld()->GetSubsystem<UBlockHazardFieldSubsystem>())
+		{
+			HazardField->RemoveHazardSources(TelegraphCells);
+		}
+		TelegraphCells.Empty();
+	}
 }
 
 void UGA_AttackRange::RestoreMontageSpeed()
@@ -269,7 +292,7 @@ void UGA_AttackRange::RestoreMontageSpeed()
 	ACharacter* Character = Cast<ACharacter>(GetAvatarActorFromActorInfo());
 	if (Character && Character->GetMesh()->GetAnimInstance())
 	{
-		// nʰ  1 !
+		// n초가 지났으니 1배속으로 쾅!
 		Character->GetMesh()->GetAnimInstance()->Montage_SetPlayRate(AttackMontage, 1.0f);
 	}
 }
\ No newline at end of file
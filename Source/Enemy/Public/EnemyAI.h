@@ -44,6 +44,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI")
 	FName BBKey_TargetActor = "TargetActor";
 
+	/** 가장 가까운 위험 셀까지의 거리 (월드 단위, 없으면 -1). 비헤이비어 트리의 회피 판단에 사용 */
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	FName BBKey_HazardDistance = "HazardDistance";
+
 	/** 타겟 탐색 타이머 핸들 */
 	FTimerHandle TimerHandle_AIUpdate;
 };
@@ -0,0 +1,301 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AbilityInputBufferComponent.h"
+#include "GA/GA_SkillBase.h"
+#include "SkillManagerComponent.h"
+#include "Interface/ISkillManagerProvider.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UAbilityInputBufferComponent::UAbilityInputBufferComponent()
+{
+	// 시전 태그/스킬 종료 이벤트로만 동작하므로 Tick 불필요
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UAbilityInputBufferComponent::InitializeWithAbilitySystem(UAbilitySystemComponent* InASC)
+{
+	if (!InASC)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AbilityInputBufferComponent: ASC is null"));
+		return;
+	}
+
+	// 다시 초기화되는 경우 이전 ASC 구독 해제
+	UnbindAbilitySystem();
+	AbilitySystem = InASC;
+
+	CastingTagHandle = InASC->RegisterGameplayTagEvent(TAG_Skill_Casting, EGameplayTagEventType::NewOrRemoved)
+		.AddUObject(this, &UAbilityInputBufferComponent::OnCastingTagChanged);
+	AbilityActivatedHandle = InASC->AbilityActivatedCallbacks.AddUObject(this, &UAbilityInputBufferComponent::OnAbilityActivated);
+	AbilityEndedHandle = InASC->AbilityEndedCallbacks.AddUObject(this, &UAbilityInputBufferComponent::OnAbilityEnded);
+}
+
+void UAbilityInputBufferComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindAbilitySystem();
+	ClearBuffer();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAbilityInputBufferComponent::UnbindAbilitySystem()
+{
+	UAbilitySystemComponent* ASC = AbilitySystem.Get();
+	if (ASC)
+	{
+		ASC->RegisterGameplayTagEvent(TAG_Skill_Casting, EGameplayTagEventType::NewOrRemoved).Remove(CastingTagHandle);
+		ASC->AbilityActivatedCallbacks.Remove(AbilityActivatedHandle);
+		ASC->AbilityEndedCallbacks.Remove(AbilityEndedHandle);
+	}
+
+	CastingTagHandle.Reset();
+	AbilityActivatedHandle.Reset();
+	AbilityEndedHandle.Reset();
+	AbilitySystem.Reset();
+}
+
+void UAbilityInputBufferComponent::HandleInputPressed(int32 InputID)
+{
+	UAbilitySystemComponent* ASC = AbilitySystem.Get();
+	if (!ASC)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AbilityInputBufferComponent: Input %d pressed before ASC initialization"), InputID);
+		return;
+	}
+
+	// 1. 시전 중이라 발동이 막힐 입력인지 먼저 확인 (전달한 뒤에는 구분할 수 없음)
+	const bool bBlockedByCasting = ASC->HasMatchingGameplayTag(TAG_Skill_Casting);
+
+	// 2. ASC에 입력 전달
+	// 실행 중인 스킬의 태스크(WaitInputPress 등)에 신호를 보내고, 비활성 스킬이면 발동을 시도
+	ASC->AbilityLocalInputPressed(InputID);
+
+	if (!bBlockedByCasting)
+	{
+		return;
+	}
+
+	// 3. 발동하지 못한 입력만 보관
+	// 이미 실행 중인 스킬의 입력은 태스크가 처리했으므로 보관하지 않음
+	const FGameplayAbilitySpec* Spec = FindSlotSpec(InputID);
+	if (!Spec || Spec->IsActive())
+	{
+		return;
+	}
+
+	const UGA_SkillBase* Skill = Cast<UGA_SkillBase>(Spec->Ability);
+	if (!Skill || !Skill->CanBufferInput())
+	{
+		return;
+	}
+
+	BufferInput(InputID, Skill->GetInputBufferPriority());
+}
+
+const FGameplayAbilitySpec* UAbilityInputBufferComponent::FindSlotSpec(int32 InputID) const
+{
+	UAbilitySystemComponent* ASC = AbilitySystem.Get();
+	if (!ASC)
+	{
+		return nullptr;
+	}
+
+	// SkillManager가 있으면 슬롯의 활성 변형 핸들로 조회
+	const ISkillManagerProvider* Provider = Cast<ISkillManagerProvider>(ASC->GetAvatarActor());
+	if (const USkillManagerComponent* SkillManager = Provider ? Provider->GetSkillManager() : nullptr)
+	{
+		const FGameplayAbilitySpecHandle Handle = SkillManager->GetActiveAbilityHandle(InputID);
+		if (Handle.IsValid())
+		{
+			return ASC->FindAbilitySpecFromHandle(Handle);
+		}
+	}
+
+	return ASC->FindAbilitySpecFromInputID(InputID);
+}
+
+void UAbilityInputBufferComponent::ClearBuffer()
+{
+	BufferedInputs.Reset();
+}
+
+void UAbilityInputBufferComponent::BufferInput(int32 InputID, int32 Priority)
+{
+	RemoveExpiredInputs();
+
+	const double Now = GetNow();
+
+	// 같은 입력을 연타하면 새로 쌓지 않고 시각만 갱신
+	for (FBufferedAbilityInput& Entry : BufferedInputs)
+	{
+		if (Entry.InputID == InputID)
+		{
+			Entry.PressTime = Now;
+			Entry.Priority = Priority;
+			return;
+		}
+	}
+
+	// 가득 찼으면 우선순위가 가장 낮고 오래된 입력을 버림 (새 입력이 더 낮으면 새 입력을 버림)
+	if (BufferedInputs.Num() >= FMath::Max(MaxBufferedInputs, 1))
+	{
+		int32 LowestIndex = 0;
+		for (int32 i = 1; i < BufferedInputs.Num(); ++i)
+		{
+			const FBufferedAbilityInput& Entry = BufferedInputs[i];
+			const FBufferedAbilityInput& Lowest = BufferedInputs[LowestIndex];
+			if (Entry.Priority < Lowest.Priority || (Entry.Priority == Lowest.Priority && Entry.PressTime < Lowest.PressTime))
+			{
+				LowestIndex = i;
+			}
+		}
+
+		if (BufferedInputs[LowestIndex].Priority > Priority)
+		{
+			return;
+		}
+		BufferedInputs.RemoveAt(LowestIndex);
+	}
+
+	FBufferedAbilityInput& NewEntry = BufferedInputs.AddDefaulted_GetRef();
+	NewEntry.InputID = InputID;
+	NewEntry.PressTime = Now;
+	NewEntry.Priority = Priority;
+}
+
+void UAbilityInputBufferComponent::OnCastingTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	if (NewCount <= 0)
+	{
+		ScheduleFlush();
+	}
+}
+
+void UAbilityInputBufferComponent::OnAbilityActivated(UGameplayAbility* Ability)
+{
+	const UGA_SkillBase* Skill = Cast<UGA_SkillBase>(Ability);
+	if (!Skill || BufferedInputs.Num() == 0)
+	{
+		return;
+	}
+
+	// 1. 다른 경로(직접 입력 등)로 발동된 스킬의 보관 입력 제거
+	if (const FGameplayAbilitySpec* Spec = Skill->GetCurrentAbilitySpec())
+	{
+		const int32 ActivatedInputID = Spec->InputID;
+		BufferedInputs.RemoveAll([ActivatedInputID](const FBufferedAbilityInput& Entry)
+		{
+			return Entry.InputID == ActivatedInputID;
+		});
+	}
+
+	// 2. 취소 규칙: 발동한 스킬의 취소 우선순위 이하인 입력을 버림
+	const int32 CancelPriority = Skill->GetInputBufferCancelPriority();
+	if (CancelPriority >= 0)
+	{
+		BufferedInputs.RemoveAll([CancelPriority](const FBufferedAbilityInput& Entry)
+		{
+			return Entry.Priority <= CancelPriority;
+		});
+	}
+}
+
+void UAbilityInputBufferComponent::OnAbilityEnded(UGameplayAbility* Ability)
+{
+	// 시전 태그 없이 끝나는 스킬도 같은 입력의 재발동을 막고 있었을 수 있음
+	ScheduleFlush();
+}
+
+void UAbilityInputBufferComponent::ScheduleFlush()
+{
+	if (bFlushScheduled || BufferedInputs.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	bFlushScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UAbilityInputBufferComponent::FlushBuffer));
+}
+
+void UAbilityInputBufferComponent::FlushBuffer()
+{
+	bFlushScheduled = false;
+
+	UAbilitySystemComponent* ASC = AbilitySystem.Get();
+	if (!ASC)
+	{
+		ClearBuffer();
+		return;
+	}
+
+	// 그 사이에 다른 스킬이 시전을 시작했으면 다음 태그 제거까지 대기
+	if (ASC->HasMatchingGameplayTag(TAG_Skill_Casting))
+	{
+		return;
+	}
+
+	RemoveExpiredInputs();
+	if (BufferedInputs.Num() == 0)
+	{
+		return;
+	}
+
+	// 1. 우선순위가 높은 입력부터, 같으면 최근 입력부터
+	BufferedInputs.Sort([](const FBufferedAbilityInput& A, const FBufferedAbilityInput& B)
+	{
+		return A.Priority != B.Priority ? A.Priority > B.Priority : A.PressTime > B.PressTime;
+	});
+
+	// 2. 하나만 발동 (발동한 스킬이 다시 시전 태그를 붙이면 나머지는 그 다음 재시도에서 처리)
+	for (int32 i = 0; i < BufferedInputs.Num(); ++i)
+	{
+		const FBufferedAbilityInput Entry = BufferedInputs[i];
+		const FGameplayAbilitySpec* Spec = FindSlotSpec(Entry.InputID);
+		if (!Spec)
+		{
+			// 슬롯에서 스킬이 빠졌으면 버림
+			BufferedInputs.RemoveAt(i--);
+			continue;
+		}
+
+		if (Spec->IsActive())
+		{
+			continue;
+		}
+
+		// 발동 콜백(OnAbilityActivated)에서 배열이 바뀌므로 먼저 제거
+		const FGameplayAbilitySpecHandle SpecHandle = Spec->Handle;
+		BufferedInputs.RemoveAt(i);
+		if (ASC->TryActivateAbility(SpecHandle))
+		{
+			return;
+		}
+
+		// 쿨타임 등으로 실패하면 만료될 때까지 그대로 보관
+		UE_LOG(LogTemp, Verbose, TEXT("AbilityInputBufferComponent: Buffered input %d failed to activate"), Entry.InputID);
+		BufferedInputs.Insert(Entry, i);
+	}
+}
+
+void UAbilityInputBufferComponent::RemoveExpiredInputs()
+{
+	const double ExpireTime = GetNow() - BufferWindow;
+	BufferedInputs.RemoveAll([ExpireTime](const FBufferedAbilityInput& Entry)
+	{
+		return Entry.PressTime < ExpireTime;
+	});
+}
+
+double UAbilityInputBufferComponent::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
@@ -0,0 +1,148 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CursorTargetingComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Block/BlockBase.h"
+#include "Grid/BlockGridSubsystem.h"
+
+UCursorTargetingComponent::UCursorTargetingComponent()
+{
+	// 요청이 들어올 때 계산하므로 Tick 불필요
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+UCursorTargetingComponent* UCursorTargetingComponent::FindOrAdd(APlayerController* PC)
+{
+	if (!PC || !PC->IsLocalController())
+	{
+		return nullptr;
+	}
+
+	if (UCursorTargetingComponent* Existing = PC->FindComponentByClass<UCursorTargetingComponent>())
+	{
+		return Existing;
+	}
+
+	UCursorTargetingComponent* NewComponent = NewObject<UCursorTargetingComponent>(PC, TEXT("CursorTargeting"));
+	if (!NewComponent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("CursorTargetingComponent: Failed to create component for %s"), *PC->GetName());
+		return nullptr;
+	}
+	NewComponent->RegisterComponent();
+	return NewComponent;
+}
+
+const FCursorTargetData& UCursorTargetingComponent::GetCursorTarget(ECollisionChannel TraceChannel)
+{
+	// 고정된 타겟이 있으면 트레이스하지 않음
+	if (bHasTargetOverride)
+	{
+		return TargetOverride;
+	}
+
+	FChannelCache* Cache = ChannelCaches.FindByPredicate([TraceChannel](const FChannelCache& Entry)
+	{
+		return Entry.Channel == TraceChannel;
+	});
+
+	if (!Cache)
+	{
+		Cache = &ChannelCaches.AddDefaulted_GetRef();
+		Cache->Channel = TraceChannel;
+	}
+
+	// 이번 프레임에 이미 계산했으면 그대로 반환
+	if (Cache->FrameNumber != GFrameCounter)
+	{
+		Cache->FrameNumber = GFrameCounter;
+		Cache->Data = FCursorTargetData();
+		ComputeCursorTarget(TraceChannel, Cache->Data);
+	}
+
+	return Cache->Data;
+}
+
+void UCursorTargetingComponent::SetTargetOverride(const FCursorTargetData& InTarget)
+{
+	TargetOverride = InTarget;
+	bHasTargetOverride = true;
+}
+
+void UCursorTargetingComponent::ClearTargetOverride()
+{
+	TargetOverride = FCursorTargetData();
+	bHasTargetOverride = false;
+
+	// 고정 전에 계산된 캐시가 같은 프레임에 다시 쓰이지 않도록 비움
+	ChannelCaches.Reset();
+}
+
+void UCursorTargetingComponent::ComputeCursorTarget(ECollisionChannel TraceChannel, FCursorTargetData& OutData) const
+{
+	APlayerController* PC = Cast<APlayerController>(GetOwner());
+	UWorld* World = GetWorld();
+	if (!PC || !World)
+	{
+		return;
+	}
+
+	// 1. 커서 역투영 (트레이스와 지면 교차점이 같은 광선을 공유)
+	FVector RayOrigin;
+	FVector RayDirection;
+	if (!PC->DeprojectMousePosition(RayOrigin, RayDirection))
+	{
+		return;
+	}
+
+	// 2. 커서 트레이스 (GetHitResultUnderCursor와 같은 거리, 복합 충돌 사용)
+	const FVector RayEnd = RayOrigin + RayDirection * PC->HitResultTraceDistance;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CursorTargeting), true);
+	World->LineTraceSingleByChannel(OutData.HitResult, RayOrigin, RayEnd, TraceChannel, QueryParams);
+
+	// 3. 셀과 면 법선
+	if (OutData.HitResult.bBlockingHit)
+	{
+		const ABlockBase* HitBlock = Cast<ABlockBase>(OutData.HitResult.GetActor());
+		UBlockGridSubsystem* Grid = World->GetSubsystem<UBlockGridSubsystem>();
+		if (HitBlock && HitBlock->IsRegisteredInGrid())
+		{
+			OutData.Cell = HitBlock->GetGridCell();
+		}
+		else
+		{
+			OutData.Cell = Grid ? Grid->WorldToCell(OutData.HitResult.Location) : FIntVector(OutData.HitResult.Location / 100.0f);
+		}
+
+		// 가장 큰 성분의 축을 면 법선으로 사용
+		const FVector Normal = OutData.HitResult.ImpactNormal;
+		const FVector AbsNormal = Normal.GetAbs();
+		if (AbsNormal.X >= AbsNormal.Y && AbsNormal.X >= AbsNormal.Z)
+		{
+			OutData.FaceNormal = FIntVector(Normal.X >= 0.0f ? 1 : -1, 0, 0);
+		}
+		else if (AbsNormal.Y >= AbsNormal.Z)
+		{
+			OutData.FaceNormal = FIntVector(0, Normal.Y >= 0.0f ? 1 : -1, 0);
+		}
+		else
+		{
+			OutData.FaceNormal = FIntVector(0, 0, Normal.Z >= 0.0f ? 1 : -1);
+		}
+	}
+
+	// 4. 폰 높이의 수평면과 광선의 교차점
+	const APawn* Pawn = PC->GetPawn();
+	if (Pawn && !FMath::IsNearlyZero(RayDirection.Z))
+	{
+		const float PlaneZ = Pawn->GetActorLocation().Z;
+		const float T = (PlaneZ - RayOrigin.Z) / RayDirection.Z;
+		if (T > 0.0f)
+		{
+			OutData.GroundPoint = RayOrigin + RayDirection * T;
+			OutData.bHasGroundPoint = true;
+		}
+	}
+}
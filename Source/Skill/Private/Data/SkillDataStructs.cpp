@@ -0,0 +1,84 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Data/SkillDataStructs.h"
+
+namespace SkillDataLimits
+{
+	// 스킬 수치의 허용 범위 (밸런스 편집 실수로 게임이 깨지지 않도록)
+	constexpr float MaxDamage = 100000.0f;
+	constexpr float MaxCooldown = 600.0f;
+	constexpr float MinRange = 0.1f;
+	constexpr float MaxRange = 10.0f;
+	constexpr float MaxRangeXY = 10000.0f;
+	constexpr float MaxSpeed = 20000.0f;
+	constexpr float MaxDuration = 60.0f;
+	constexpr float MinTickInterval = 0.05f;
+	constexpr int32 MaxBarrierCells = 9;
+}
+
+bool FSkillDataRow::Validate(FName RowName, TArray<FString>& OutErrors) const
+{
+	using namespace SkillDataLimits;
+	const int32 NumErrorsBefore = OutErrors.Num();
+
+	auto CheckRange = [&OutErrors, RowName](const TCHAR* FieldName, float Value, float MinValue, float MaxValue)
+	{
+		if (Value < MinValue || Value > MaxValue)
+		{
+			OutErrors.Add(FString::Printf(TEXT("%s.%s = %.2f (allowed %.2f ~ %.2f)"), *RowName.ToString(), FieldName, Value, MinValue, MaxValue));
+		}
+	};
+
+	// 스킬별 수치는 0 이하(미사용)이거나 허용 범위 안이어야 함
+	auto CheckOptional = [&CheckRange](const TCHAR* FieldName, float Value, float MinValue, float MaxValue)
+	{
+		if (Value > 0.0f)
+		{
+			CheckRange(FieldName, Value, MinValue, MaxValue);
+		}
+	};
+
+	if (!SkillClass)
+	{
+		OutErrors.Add(FString::Printf(TEXT("%s.SkillClass is not set"), *RowName.ToString()));
+	}
+
+	CheckRange(TEXT("BaseDamage"), BaseDamage, 0.0f, MaxDamage);
+	CheckRange(TEXT("BaseCooldown"), BaseCooldown, 0.0f, MaxCooldown);
+	CheckOptional(TEXT("BaseRange"), BaseRange, MinRange, MaxRange);
+	CheckOptional(TEXT("BaseBlockDamage"), BaseBlockDamage, 0.0f, MaxDamage);
+	CheckOptional(TEXT("RangeXY"), RangeXY, 1.0f, MaxRangeXY);
+	CheckOptional(TEXT("RangeZ"), RangeZ, 1.0f, MaxRangeXY);
+
+	CheckOptional(TEXT("ChargeSpeed"), ChargeSpeed, 1.0f, MaxSpeed);
+	CheckOptional(TEXT("MaxChargeDistance"), MaxChargeDistance, 1.0f, MaxRangeXY);
+	CheckOptional(TEXT("BarrierWidth"), BarrierWidth, 1, MaxBarrierCells);
+	CheckOptional(TEXT("BarrierHeight"), BarrierHeight, 1, MaxBarrierCells);
+	CheckOptional(TEXT("SpinDuration"), SpinDuration, MinTickInterval, MaxDuration);
+	CheckOptional(TEXT("SpinRadius"), SpinRadius, 1.0f, MaxRangeXY);
+	CheckOptional(TEXT("DamageTickInterval"), DamageTickInterval, MinTickInterval, MaxDuration);
+
+	return OutErrors.Num() == NumErrorsBefore;
+}
+
+void FSkillDataRow::ClampToValidRange()
+{
+	using namespace SkillDataLimits;
+
+	BaseDamage = FMath::Clamp(BaseDamage, 0.0f, MaxDamage);
+	BaseCooldown = FMath::Clamp(BaseCooldown, 0.0f, MaxCooldown);
+
+	// 비워둘 수 있는 수치는 사용하는 경우(0 초과)만 보정 (0 이하는 GA 기본값 사용)
+	if (BaseRange > 0.0f) BaseRange = FMath::Clamp(BaseRange, MinRange, MaxRange);
+	if (BaseBlockDamage > 0.0f) BaseBlockDamage = FMath::Clamp(BaseBlockDamage, 0.0f, MaxDamage);
+	if (RangeXY > 0.0f) RangeXY = FMath::Clamp(RangeXY, 1.0f, MaxRangeXY);
+	if (RangeZ > 0.0f) RangeZ = FMath::Clamp(RangeZ, 1.0f, MaxRangeXY);
+	if (ChargeSpeed > 0.0f) ChargeSpeed = FMath::Clamp(ChargeSpeed, 1.0f, MaxSpeed);
+	if (MaxChargeDistance > 0.0f) MaxChargeDistance = FMath::Clamp(MaxChargeDistance, 1.0f, MaxRangeXY);
+	if (BarrierWidth > 0) BarrierWidth = FMath::Clamp(BarrierWidth, 1, MaxBarrierCells);
+	if (BarrierHeight > 0) BarrierHeight = FMath::Clamp(BarrierHeight, 1, MaxBarrierCells);
+	if (SpinDuration > 0.0f) SpinDuration = FMath::Clamp(SpinDuration, MinTickInterval, MaxDuration);
+	if (SpinRadius > 0.0f) SpinRadius = FMath::Clamp(SpinRadius, 1.0f, MaxRangeXY);
+	if (DamageTickInterval > 0.0f) DamageTickInterval = FMath::Clamp(DamageTickInterval, MinTickInterval, MaxDuration);
+}
@@ -0,0 +1,146 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Data/SkillDataSubsystem.h"
+#include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Abilities/GameplayAbility.h"
+
+USkillDataSubsystem* USkillDataSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<USkillDataSubsystem>() : nullptr;
+}
+
+void USkillDataSubsystem::Deinitialize()
+{
+	UnbindTableChanged();
+	SkillDataTable = nullptr;
+	Rows.Empty();
+	IndexByID.Empty();
+	IndexByClass.Empty();
+
+	Super::Deinitialize();
+}
+
+void USkillDataSubsystem::SetSkillDataTable(UDataTable* InTable)
+{
+	if (InTable == SkillDataTable)
+	{
+		return;
+	}
+
+	if (InTable && InTable->GetRowStruct() && !InTable->GetRowStruct()->IsChildOf(FSkillDataRow::StaticStruct()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("USkillDataSubsystem::SetSkillDataTable: %s does not use FSkillDataRow"), *InTable->GetName());
+		return;
+	}
+
+	UnbindTableChanged();
+	SkillDataTable = InTable;
+
+#if WITH_EDITOR
+	// 에디터에서 테이블을 고치면 PIE 도중에도 캐시를 다시 만듦
+	if (SkillDataTable)
+	{
+		TableChangedHandle = SkillDataTable->OnDataTableChanged().AddUObject(this, &USkillDataSubsystem::HandleTableChanged);
+	}
+#endif
+
+	RebuildCache();
+}
+
+void USkillDataSubsystem::UnbindTableChanged()
+{
+#if WITH_EDITOR
+	if (SkillDataTable && TableChangedHandle.IsValid())
+	{
+		SkillDataTable->OnDataTableChanged().Remove(TableChangedHandle);
+	}
+#endif
+	TableChangedHandle.Reset();
+}
+
+void USkillDataSubsystem::HandleTableChanged()
+{
+	UE_LOG(LogTemp, Log, TEXT("USkillDataSubsystem: %s changed, rebuilding skill data"), *GetNameSafe(SkillDataTable));
+	RebuildCache();
+}
+
+void USkillDataSubsystem::RebuildCache()
+{
+	Rows.Reset();
+	IndexByID.Reset();
+	IndexByClass.Reset();
+
+	if (SkillDataTable)
+	{
+		const TMap<FName, uint8*>& RowMap = SkillDataTable->GetRowMap();
+		Rows.Reserve(RowMap.Num());
+
+		TArray<FString> Errors;
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			const FSkillDataRow* SourceRow = reinterpret_cast<const FSkillDataRow*>(Pair.Value);
+			if (!SourceRow)
+			{
+				continue;
+			}
+
+			// 1. 범위 검사 (벗어난 값은 경고 후 보정)
+			FSkillDataRow Row = *SourceRow;
+			Errors.Reset();
+			if (!Row.Validate(Pair.Key, Errors))
+			{
+				for (const FString& Error : Errors)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("USkillDataSubsystem: Invalid skill data %s"), *Error);
+				}
+				Row.ClampToValidRange();
+			}
+
+			// 2. 평탄한 배열에 추가하고 ID/클래스 인덱스 등록
+			const int32 Index = Rows.Add(MoveTemp(Row));
+			IndexByID.Add(Pair.Key, Index);
+
+			if (const UClass* AbilityClass = Rows[Index].SkillClass.Get())
+			{
+				if (IndexByClass.Contains(AbilityClass))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("USkillDataSubsystem: %s is used by more than one row, %s is ignored for class lookup"),
+						*AbilityClass->GetName(), *Pair.Key.ToString());
+				}
+				else
+				{
+					IndexByClass.Add(AbilityClass, Index);
+				}
+			}
+		}
+	}
+
+	++DataVersion;
+	UE_LOG(LogTemp, Log, TEXT("USkillDataSubsystem: Cached %d skill rows (version %d)"), Rows.Num(), DataVersion);
+
+	OnSkillDataChanged.Broadcast();
+}
+
+const FSkillDataRow* USkillDataSubsystem::FindSkillData(FName SkillID) const
+{
+	const int32* Index = IndexByID.Find(SkillID);
+	return Index ? &Rows[*Index] : nullptr;
+}
+
+const FSkillDataRow* USkillDataSubsystem::FindSkillDataByClass(const UClass* AbilityClass) const
+{
+	// 블루프린트 자식 클래스는 테이블에 없을 수 있으므로 부모 쪽으로 올라가며 검색
+	for (const UClass* Class = AbilityClass; Class; Class = Class->GetSuperClass())
+	{
+		if (const int32* Index = IndexByClass.Find(Class))
+		{
+			return &Rows[*Index];
+		}
+	}
+	return nullptr;
+}
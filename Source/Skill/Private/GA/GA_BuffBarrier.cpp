@@ -2,21 +2,25 @@
 
 
 #include "GA/GA_BuffBarrier.h"
+#include "SkillStats.h"
 #include "Block/BlockBase.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Grid/BlockRegion.h"
 #include "Interface/IAttributeSetProvider.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Engine/OverlapResult.h"
+#include "Combat/EffectQueueSubsystem.h"
 
-//    ± 
+// 페이즈 관리를 위한 태그 정의
 UE_DEFINE_GAMEPLAY_TAG(TAG_BuffBarrier_Phase1, "State.Skill.BuffBarrier.Phase1");
 UE_DEFINE_GAMEPLAY_TAG(TAG_BuffBarrier_Phase2, "State.Skill.BuffBarrier.Phase2");
 
 UGA_BuffBarrier::UGA_BuffBarrier()
 {
-	// ü  å:  (HighlightedBlocks, SpawnedWalls)  
+	// 객체 생성 정책: 멤버 변수(HighlightedBlocks, SpawnedWalls) 유지를 위해
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 }
 
@@ -40,33 +44,33 @@ void UGA_BuffBarrier::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 
 
 
-	//  ASC پִ ±׸   
+	// 현재 ASC에 붙어있는 태그를 기반으로 페이즈 결정
 	if (ASC->HasMatchingGameplayTag(TAG_BuffBarrier_Phase2))
 	{
-		// 2 ±װ  -> 3ܰ() 
+		// 2페이즈 태그가 있으면 -> 3단계(해제) 실행
 		ExecutePhase3_Cleanup();
 	}
 	else if (ASC->HasMatchingGameplayTag(TAG_BuffBarrier_Phase1))
 	{
-		// 1 ±װ  -> 2ܰ(ġ) 
+		// 1페이즈 태그가 있으면 -> 2단계(설치) 실행
 		ExecutePhase2_Deploy();
 	}
 	else
 	{
-		// ±װ  -> 1ܰ() 
+		// 태그가 없으면 -> 1단계(시작) 실행
 		ExecutePhase1_Highlight();
 	}
 }
 
 void UGA_BuffBarrier::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	// θ Ŭ EndAbility ȣ (State.Casting ±  )
+	// 부모 클래스의 EndAbility 호출 (State.Casting 태그 제거 등)
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
 void UGA_BuffBarrier::ExecutePhase1_Highlight()
 {
-	// 1.   (ù ÿ  Ҹ, Ÿ ߿)
+	// 1. 비용 지불 (첫 시전시에만 비용 소모, 쿨타임은 나중에)
 	if (!CommitAbilityCost(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GA_BuffBarrier::ExecutePhase1 - Failed to commit cost"));
@@ -74,7 +78,7 @@ void UGA_BuffBarrier::ExecutePhase1_Highlight()
 		return;
 	}
 
-	// 2.  ʱȭ (  ġ)
+	// 2. 데이터 초기화 (재사용 시 안전장치)
 	HighlightedBlocks.Empty();
 	if (SpawnedWalls.Num() > 0)
 	{
@@ -87,32 +91,32 @@ void UGA_BuffBarrier::ExecutePhase1_Highlight()
 
 	InstallCenterLocation = GetAvatarActorFromActorInfo()->GetActorLocation();
 
-	// 3.     
-	// Rune modifier   Ͽ RangeXY Ʈ (RangeZ ǵ帮 )
+	// 3. 범위 계산 및 블록 수집
+	// Rune modifier 적용된 범위를 계산하여 RangeXY 업데이트 (RangeZ는 건드리지 않음)
 	float OriginalRange = RangeXY;
-	RangeXY *= GetRuneModifiedRange(); //  
-	// RangeXY  
+	RangeXY *= GetRuneModifiedRange(); // 룬 적용
+	// RangeXY 디버그 출력
 	UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier::ExecutePhase1 - Modified RangeXY: %f"), RangeXY);
 
-	// θ Ŭ FindBlocksInRange 
+	// 부모 클래스의 FindBlocksInRange 사용
 	FindBlocksInRange(HighlightedBlocks);
 
-	// RangeXY  (   󺹱)
+	// RangeXY 복구 (다음 프레임을 위해 원상복구)
 	RangeXY = OriginalRange;
 
 	if (HighlightedBlocks.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GA_BuffBarrier::ExecutePhase1 - No blocks found in range"));
-		//    ±״ ٿ  ܰ ,  ؾ .
-		// ⼭   ǹ̰ Ƿ  
+		// 블록이 없어도 로직상 태그는 붙여서 다음 단계로 갈지, 종료할지 결정해야 함.
+		// 여기서는 블록이 없으면 의미가 없으므로 즉시 종료
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
 
-	// 4. ̶Ʈ  (Preview )
+	// 4. 하이라이트 적용 (Preview 색상)
 	BatchHighlightBlocks(HighlightedBlocks, EBlockHighlightState::Preview);
 
-	// 5. ±  (Phase 1  ˸)
+	// 5. 태그 부착 (Phase 1 시작 알림)
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (ASC)
 	{
@@ -123,16 +127,16 @@ void UGA_BuffBarrier::ExecutePhase1_Highlight()
 		UE_LOG(LogTemp, Error, TEXT("GA_BuffBarrier::ExecutePhase1 - ASC is null, cannot add tag"));
 	}
 
-	// 6. ڵ ȯ Ÿ̸ 
+	// 6. 자동 전환 타이머 설정
 	if (UWorld* World = GetWorld())
 	{
-		//  Ÿ̸Ӱ ִٸ 
+		// 기존 타이머가 있다면 정리
 		World->GetTimerManager().ClearTimer(AutoTransitionTimerHandle);
 
-		// Ÿ̸ ð ȿ üũ (0ʸ  Ǿ   )
+		// 타이머 시간 유효성 체크 (0초면 즉시 실행되어 꼬일 수 있음)
 		float WaitTime = (AutoTransitionTime > 0.0f) ? AutoTransitionTime : 0.1f;
 
-		// WeakObjectPtr Ͽ Ability  Ŀ Ÿ̸Ӱ ϰ ȣǵ 
+		// WeakObjectPtr를 사용하여 Ability 종료 후에도 타이머가 안전하게 호출되도록 함
 		TWeakObjectPtr<UGA_BuffBarrier> WeakThis(this);
 		World->GetTimerManager().SetTimer(AutoTransitionTimerHandle, [WeakThis]()
 		{
@@ -155,7 +159,7 @@ void UGA_BuffBarrier::ExecutePhase1_Highlight()
 
 	UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier: Phase 1 Highlighted %d blocks"), HighlightedBlocks.Num());
 
-	// 7. ų  (±״  ֱ Ͽ ٸ ൿ ϰ )
+	// 7. 스킬 종료 (태그는 남기고 생명주기는 종료하여 다른 행동 가능하게 함)
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
@@ -164,7 +168,7 @@ void UGA_BuffBarrier::ExecutePhase2_Deploy()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	UWorld* World = GetWorld();
 
-	// 1. Ÿ̸   ± 
+	// 1. 타이머 및 이전 태그 정리
 	if (World)
 	{
 		World->GetTimerManager().ClearTimer(AutoTransitionTimerHandle);
@@ -180,18 +184,21 @@ void UGA_BuffBarrier::ExecutePhase2_Deploy()
 		UE_LOG(LogTemp, Error, TEXT("GA_BuffBarrier::ExecutePhase2 - ASC is null"));
 	}
 
-	// 2. ڸ  ã
+	// 2. 가장자리 블록 찾기
 	TArray<ABlockBase*> EdgeBlocks;
 	FindEdgeBlocks(HighlightedBlocks, EdgeBlocks);
 
-	// 3. Ÿ 
+	// 3. 울타리 생성
 	if (WallBlockClass && World)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_SkillSpawn);
+		INC_DWORD_STAT_BY(STAT_SkillSpawnedActors, EdgeBlocks.Num());
+
 		for (ABlockBase* BaseBlock : EdgeBlocks)
 		{
 			if (!BaseBlock) continue;
 
-			//   ٷ  
+			// 기준 블록 바로 위에 생성
 			FVector SpawnLoc = BaseBlock->GetActorLocation() + FVector(0, 0, BaseBlock->GetGridSize());
 			ABlockBase* NewWall = ABlockBase::SpawnBlock(World, WallBlockClass, SpawnLoc, false);
 
@@ -210,10 +217,10 @@ void UGA_BuffBarrier::ExecutePhase2_Deploy()
 		UE_LOG(LogTemp, Error, TEXT("GA_BuffBarrier::ExecutePhase2 - WallBlockClass or World is null"));
 	}
 
-	// 4.  
+	// 4. 버프 적용
 	ApplyBuffToTargets();
 
-	// 5. ڵ ȯ Ÿ̸ 缳 (3ܰ Ѿ )
+	// 5. 자동 전환 타이머 재설정 (3단계로 넘어가기 위함)
 	if (World)
 	{
 		TWeakObjectPtr<UGA_BuffBarrier> WeakThis(this);
@@ -240,7 +247,7 @@ void UGA_BuffBarrier::ExecutePhase3_Cleanup()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	UWorld* World = GetWorld();
 
-	// 1. Ÿ̸  ± 
+	// 1. 타이머 및 태그 정리
 	if (World)
 	{
 		World->GetTimerManager().ClearTimer(AutoTransitionTimerHandle);
@@ -255,7 +262,7 @@ void UGA_BuffBarrier::ExecutePhase3_Cleanup()
 		UE_LOG(LogTemp, Error, TEXT("GA_BuffBarrier::ExecutePhase3 - ASC is null"));
 	}
 
-	// 2.  
+	// 2. 벽 제거
 	for (ABlockBase* Wall : SpawnedWalls)
 	{
 		if (Wall && IsValid(Wall))
@@ -265,11 +272,11 @@ void UGA_BuffBarrier::ExecutePhase3_Cleanup()
 	}
 	SpawnedWalls.Empty();
 
-	// 3. ٴ ̶Ʈ 
+	// 3. 바닥 하이라이트 복구
 	BatchHighlightBlocks(HighlightedBlocks, EBlockHighlightState::None);
 	HighlightedBlocks.Empty();
 
-	// 4. Ÿ  (    )
+	// 4. 쿨타임 적용 (모든 시퀀스가 끝난 시점에서 적용)
 	CommitAbilityCooldown(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 
 	UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier: Phase 3 Cleanup complete"));
@@ -281,10 +288,10 @@ void UGA_BuffBarrier::OnAutoTransition()
 {
 	UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier::OnAutoTransition - Timer Fired"));
 
-	// CachedASC ȿ ˻
+	// CachedASC 유효성 검사
 	if (CachedASC.IsValid())
 	{
-		// ٽ Ȱȭ õ
+		// 다시 활성화 시도
 		bool bSuccess = CachedASC->TryActivateAbility(CurrentSpecHandle);
 
 		if (!bSuccess)
@@ -307,58 +314,60 @@ void UGA_BuffBarrier::FindEdgeBlocks(const TArray<ABlockBase*>& InBlocks, TArray
 	OutEdges.Empty();
 	if (InBlocks.Num() == 0) return;
 
-	float GridSize = InBlocks[0]->GetGridSize();
-	float Tolerance = 5.0f;
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
 
-	// [ȭ] O(N^2) ϱ  ġ ȸ  Set  (O(N))
-	// FVector Key   ణ  ؾ ,  ׸忡 ĵǾ ִٰ 
-	TSet<FVector> BlockLocations;
-	BlockLocations.Reserve(InBlocks.Num());
+	// 1. 블록을 정수 셀로 변환하고 XY 열마다 가장 높은 블록만 남김
+	// 높이가 다른 블록도 같은 열 기준으로 이웃 판정하므로 단차가 있어도 영역이 끊기지 않음
+	TMap<FIntPoint, ABlockBase*> TopBlockByColumn;
+	TMap<FIntPoint, int32> TopHeightByColumn;
+	TopBlockByColumn.Reserve(InBlocks.Num());
+	TopHeightByColumn.Reserve(InBlocks.Num());
 
 	for (ABlockBase* Block : InBlocks)
 	{
-		if (Block)
+		if (!Block) continue;
+
+		FIntVector Cell;
+		if (Block->IsRegisteredInGrid())
+		{
+			Cell = Block->GetGridCell();
+		}
+		else if (Grid)
+		{
+			Cell = Grid->WorldToCell(Block->GetActorLocation());
+		}
+		else
+		{
+			const FVector Scaled = Block->GetActorLocation() / Block->GetGridSize();
+			Cell = FIntVector(FMath::RoundToInt(Scaled.X), FMath::RoundToInt(Scaled.Y), FMath::RoundToInt(Scaled.Z));
+		}
+
+		const FIntPoint Column(Cell.X, Cell.Y);
+		int32* TopHeight = TopHeightByColumn.Find(Column);
+		if (!TopHeight || Cell.Z > *TopHeight)
 		{
-			BlockLocations.Add(Block->GetActorLocation());
+			TopHeightByColumn.Add(Column, Cell.Z);
+			TopBlockByColumn.Add(Column, Block);
 		}
 	}
 
-	// 4 (¿)
-	FVector Directions[] = { FVector(1,0,0), FVector(-1,0,0), FVector(0,1,0), FVector(0,-1,0) };
+	// 2. 비트셋 영역으로 경계 셀 계산 (4면 중 하나라도 영역 밖이면 가장자리)
+	TArray<FIntPoint> Columns;
+	TopBlockByColumn.GenerateKeyArray(Columns);
 
-	for (ABlockBase* Block : InBlocks)
-	{
-		if (!Block) continue;
+	const FBlockRegion2D Region(Columns);
 
-		FVector MyLoc = Block->GetActorLocation();
-		int32 NeighborCount = 0;
+	TArray<FIntPoint> BoundaryCells;
+	Region.FindBoundaryCells(BoundaryCells);
 
-		for (const FVector& Dir : Directions)
-		{
-			FVector CheckLoc = MyLoc + (Dir * GridSize);
-
-			// [ȭ]  ݺ  Set ˻ (O(1))
-			// εҼ  ؾ Ѵٸ FIntVector ȯ̳  ó ʿ  ,
-			// ׸ ý Ȯϴٸ Set.Contains . 
-			//  Set ˻ Ѵٸ, Tolerance   ˻  ü ʿ  .
-			// ⼭   Tolerance(5.0f) Ͽ Set ˻  FindClosestKey  ų,
-			// ܼ ׸ ǥ Ȯϴٰ ϰ Contains .
-			if (BlockLocations.Contains(CheckLoc))
-			{
-				NeighborCount++;
-			}
-			else
-			{
-				// Ȯ ġ ʴ 츦 , Set ȸ  
-				//  ýۻ ϵ   ׸忡  ° ġȴٸ  Contains .
-				//  ̼  ִٸ   ϳ, ⼭ ȭ  ǥ ռ .
-			}
-		}
-
-		// 4  ϳ շ(̿ ) ڸ 
-		if (NeighborCount < 4)
+	// 3. 경계 셀의 블록을 결과로 반환
+	OutEdges.Reserve(BoundaryCells.Num());
+	for (const FIntPoint& Column : BoundaryCells)
+	{
+		if (ABlockBase* const* EdgeBlock = TopBlockByColumn.Find(Column))
 		{
-			OutEdges.Add(Block);
+			OutEdges.Add(*EdgeBlock);
 		}
 	}
 }
@@ -387,15 +396,15 @@ void UGA_BuffBarrier::ApplyBuffToTargets()
 
 	FVector CenterLoc = InstallCenterLocation;
 
-	//   (Phase 1   ؾ )
+	// 범위 재계산 (Phase 1에서 썼던 값과 동일해야 함)
 	float Radius = GetRuneModifiedRange() * RangeXY;
 
-	// ü   ˻
+	// 구체 형태의 오버랩 검사
 	TArray<FOverlapResult> OverlapResults;
 	FCollisionShape OverlapShape = FCollisionShape::MakeSphere(Radius);
 
 	FCollisionObjectQueryParams ObjectQueryParams;
-	ObjectQueryParams.AddObjectTypesToQuery(ECC_Pawn); // Pawn ŸԸ 1 ͸
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_Pawn); // Pawn 타입만 1차 필터링
 
 	FCollisionQueryParams QueryParams;
 
@@ -410,65 +419,83 @@ void UGA_BuffBarrier::ApplyBuffToTargets()
 
 	if (bOverlap)
 	{
-		// [߰] 2. ̹ ó ͸ ɷ  (Set)
-		// OverlapMulti Ʈ  ǹǷ(ĸ, ޽ ),  Ͱ     
-		TSet<AActor*> ProcessedActors;
+		UAbilitySystemComponent* SourceASC = GetAbilitySystemComponentFromActorInfo();
+		UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(World);
+		if (!SourceASC)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GA_BuffBarrier::ApplyBuffToTargets - SourceASC is null"));
+			return;
+		}
+
+		// 큐가 없는 월드에서는 바로 적용하고, 대상 중복은 여기서 거름
+		TSet<UAbilitySystemComponent*> DirectTargets;
 
+		// 버프 스펙은 발동당 한 번만 생성해서 모든 대상에 재사용
+		FGameplayEffectContextHandle Context = MakeEffectContext(CurrentSpecHandle, CurrentActorInfo);
+		FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(BuffEffectClass, GetAbilityLevel(), Context);
+		if (!SpecHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GA_BuffBarrier: Failed to create SpecHandle for buff"));
+			return;
+		}
+
+		FGameplayTag MagnitudeTag = FGameplayTag::RequestGameplayTag(FName("Data.Skill.Damage"));
+		SpecHandle.Data.Get()->SetSetByCallerMagnitude(MagnitudeTag, GetRuneModifiedDamage());
+
+		// OverlapMulti는 컴포넌트 단위로 검출되므로(캡슐, 메쉬 등) 한 액터가 여러 번 잡히지만,
+		// GE 적용 큐가 같은 스펙 + 같은 대상을 한 번만 적용하므로 여기서 따로 걸러내지 않음
 		for (const FOverlapResult& Result : OverlapResults)
 		{
 			AActor* TargetActor = Result.GetActor();
 			if (!TargetActor) continue;
 
-			// [߰] 3. ߺ ó 
-			if (ProcessedActors.Contains(TargetActor))
-			{
-				continue;
-			}
-			ProcessedActors.Add(TargetActor);
-
-			// 1. ȿ ˻: IAttributeSetProvider ̽   Ȯ
-			// ̰  Ϲ ͳ   Ÿ  
+			// 1. 유효성 검사: IAttributeSetProvider 인터페이스 구현 여부 확인
+			// 이것을 통해 일반 액터나 배경 등을 거를 수 있음
 			if (!TargetActor->Implements<UAttributeSetProvider>())
 			{
 				continue;
 			}
 
-			// 2. ASC 
+			// 2. ASC 가져오기
 			UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 			if (TargetASC)
 			{
-				// 2. TAG_Player ±׸  ִ Ȯ
+				// 2. TAG_Player 태그를 가지고 있는지 확인
 				if (TargetASC->HasMatchingGameplayTag(TAG_Player))
 				{
-					// 3.  
-					FGameplayEffectContextHandle Context = MakeEffectContext(CurrentSpecHandle, CurrentActorInfo);
-					FGameplayEffectSpecHandle SpecHandle = GetAbilitySystemComponentFromActorInfo()->MakeOutgoingSpec(BuffEffectClass, GetAbilityLevel(), Context);
-
-					if (SpecHandle.IsValid())
+					// 3. 버프 적용 큐에 제출 (큐가 없으면 대상당 한 번만 바로 적용)
+					bool bApplied = false;
+					if (EffectQueue)
 					{
-
-						FGameplayTag MagnitudeTag = FGameplayTag::RequestGameplayTag(FName("Data.Skill.Damage"));
-						SpecHandle.Data.Get()->SetSetByCallerMagnitude(MagnitudeTag, GetRuneModifiedDamage());
-						GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-
-						//   Ȯο α
-						UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier: Applied Buff [%s] to Player Target [%s]"),
-							*BuffEffectClass->GetName(), *TargetActor->GetName());
+						bApplied = EffectQueue->QueueEffect(SourceASC, TargetASC, SpecHandle);
 					}
 					else
 					{
-						UE_LOG(LogTemp, Warning, TEXT("GA_BuffBarrier: Failed to create SpecHandle for target %s"), *TargetActor->GetName());
+						bool bAlreadyApplied = false;
+						DirectTargets.Add(TargetASC, &bAlreadyApplied);
+						if (!bAlreadyApplied)
+						{
+							SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+							bApplied = true;
+						}
+					}
+
+					if (bApplied)
+					{
+						// 버프 적용 확인용 로그
+						UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier: Queued Buff [%s] to Player Target [%s]"),
+							*BuffEffectClass->GetName(), *TargetActor->GetName());
 					}
 				}
 				else
 				{
-					// ÷̾ ±װ   α
+					// 플레이어 태그가 없는 경우 로그
 					UE_LOG(LogTemp, Log, TEXT("GA_BuffBarrier: Target %s has ASC but no Player tag, skipping."), *TargetActor->GetName());
 				}
 			}
 			else
 			{
-				// ASC   α
+				// ASC가 없는 경우 로그
 				UE_LOG(LogTemp, Warning, TEXT("GA_BuffBarrier: Target %s has no ASC"), *TargetActor->GetName());
 			}
 		}
@@ -483,10 +510,10 @@ bool UGA_BuffBarrier::CheckCost(const FGameplayAbilitySpecHandle Handle,
 	const FGameplayAbilityActorInfo* ActorInfo,
 	FGameplayTagContainer* OptionalRelevantTags) const
 {
-	// ActorInfo ASC ȿϴٸ ± Ȯ
+	// ActorInfo나 ASC가 유효하다면 태그 확인
 	if (ActorInfo && ActorInfo->AbilitySystemComponent.IsValid())
 	{
-		// 1 2 ±װ پִٸ(̹ ų  ),  ˻縦 н(true)
+		// 1페이즈나 2페이즈 태그가 붙어있다면(이미 스킬 진행 중), 비용 검사를 패스(true)
 		if (ActorInfo->AbilitySystemComponent->HasMatchingGameplayTag(TAG_BuffBarrier_Phase1) ||
 			ActorInfo->AbilitySystemComponent->HasMatchingGameplayTag(TAG_BuffBarrier_Phase2))
 		{
@@ -494,6 +521,6 @@ bool UGA_BuffBarrier::CheckCost(const FGameplayAbilitySpecHandle Handle,
 		}
 	}
 
-	//  (ù ) ⺻  ˻ 
+	// 그 외(첫 시전)에는 기본 비용 검사 수행
 	return Super::CheckCost(Handle, ActorInfo, OptionalRelevantTags);
 }
\ No newline at end of file
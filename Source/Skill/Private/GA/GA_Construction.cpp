@@ -2,6 +2,7 @@
 
 
 #include "GA/GA_Construction.h"
+#include "SkillStats.h"
 #include "Block/DestructibleBlock.h"
 #include "Block/BlockBase.h"
 #include "GameFramework/PlayerController.h"
@@ -11,7 +12,18 @@
 #include "Components/StaticMeshComponent.h"
 #include "InputCoreTypes.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
-#include "Components/InputComponent.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "AbilitySystemComponent.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Grid/BlockPredictionSubsystem.h"
+#include "Grid/BlockGridShapes.h"
+#include "CursorTargetingComponent.h"
+#include "SkillManagerComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/OverlapResult.h"
+
+// 드래그 건설 타겟 데이터의 도형 표시 (없으면 선)
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Construction_DragRect, "Skill.Construction.DragRect");
 
 UGA_Construction::UGA_Construction() {}
 
@@ -23,14 +35,22 @@ void UGA_Construction::ActivateAbility(
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	// 프리뷰 업데이트를 위한 타이머 시작 (매 프레임)
-	if (UWorld* World = GetWorld())
-	{	
-		// 60FPS 간격으로 UpdatePreview 함수 호출
-		// 자식이 재정의한 UpdatePreview 또한 호출될 수 있음.
-		World->GetTimerManager().SetTimer(TickTimerHandle, this, &UGA_Construction::UpdatePreview, 0.016f, true);
+	// 서버에서 원격 클라이언트의 어빌리티를 실행 중이면 건설 위치(타겟 데이터)를 기다림
+	// 클라이언트가 먼저 보냈다면 CallReplicatedTargetDataDelegatesIfSet에서 바로 처리됨
+	if (HasAuthority(&ActivationInfo) && !IsLocallyControlled())
+	{
+		if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
+		{
+			ServerTargetDataHandle = ASC->AbilityTargetDataSetDelegate(Handle, ActivationInfo.GetActivationPredictionKey())
+				.AddUObject(this, &UGA_Construction::OnServerTargetDataReceived);
+			ASC->CallReplicatedTargetDataDelegatesIfSet(Handle, ActivationInfo.GetActivationPredictionKey());
+		}
 	}
 
+	// 프리뷰 시작 (커서 셀, 플레이어 셀, 범위 내 블록이 바뀔 때만 UpdatePreview 호출)
+	// 자식이 재정의한 UpdatePreview 또한 호출될 수 있음.
+	StartPreview();
+
 	// WaitInputPress 어빌리티 태스크 생성
 	WaitInputTask = UAbilityTask_WaitInputPress::WaitInputPress(this);
 	if (WaitInputTask)
@@ -46,24 +66,12 @@ void UGA_Construction::ActivateAbility(
 	}
 
 	// 좌클릭 입력 바인딩
-	// 좌클릭은 사용 범위가 넓고, 여러 어빌리티에서 공통으로 사용될 수 있으므로
-	// Ability Task 대신 직접 InputComponent에 바인딩
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// 좌클릭 키 바인딩 추가
-			PC->InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &UGA_Construction::OnLeftClickPressed);
-		}
-		else {
-			UE_LOG(LogTemp, Error, TEXT("GA_Construction: PlayerController or InputComponent is null"));
-		}
-	}
-	else {
-		UE_LOG(LogTemp, Error, TEXT("GA_Construction: OwnerPawn is null"));
-	}
+	// 좌클릭은 여러 어빌리티에서 공통으로 사용될 수 있으므로
+	// 입력 바인딩 레지스트리의 임시 매핑 컨텍스트로 등록 (가장 최근에 활성화된 어빌리티가 입력을 받음)
+	// 놓을 때 콜백은 드래그 건설 확정용
+	BindLeftClick(
+		FSimpleDelegate::CreateUObject(this, &UGA_Construction::OnLeftClickPressed),
+		FSimpleDelegate::CreateUObject(this, &UGA_Construction::OnLeftClickReleased));
 }
 
 void UGA_Construction::EndAbility(
@@ -72,14 +80,8 @@ void UGA_Construction::EndAbility(
 	const FGameplayAbilityActivationInfo ActivationInfo,
 	bool bReplicateEndAbility, bool bWasCancelled)
 {
-	// 타이머 정리
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
-
-	// 타이머 핸들 무효화
-	TickTimerHandle.Invalidate();
+	// 프리뷰 정리
+	StopPreview();
 
 	// 하이라이트 제거
 	ClearHighlights();
@@ -91,6 +93,19 @@ void UGA_Construction::EndAbility(
 		PreviewBlock = nullptr;
 	}
 
+	// 드래그 프리뷰 블록 제거
+	for (AActor* DragPreview : DragPreviewBlocks)
+	{
+		if (DragPreview)
+		{
+			DragPreview->Destroy();
+		}
+	}
+	DragPreviewBlocks.Empty();
+	DragCells.Empty();
+	bDragging = false;
+	PendingBuildCount = 1;
+
 	// Ability Task 정리
 	if (WaitInputTask)
 	{
@@ -98,22 +113,18 @@ void UGA_Construction::EndAbility(
 		WaitInputTask = nullptr;
 	}
 
-	// 좌클릭 바인딩 명시적 해제
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
+	// 좌클릭 바인딩 해제 (핸들로 이 어빌리티의 바인딩만 제거)
+	UnbindLeftClick();
+
+	// 서버 타겟 데이터 대기 해제
+	if (ServerTargetDataHandle.IsValid())
 	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
+		if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
 		{
-			// InputComponent에서 이 객체에 바인딩된 모든 키 바인딩 제거 (ASC를 사용하지 않았기에 수동 제거)
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
+			ASC->AbilityTargetDataSetDelegate(Handle, ActivationInfo.GetActivationPredictionKey()).Remove(ServerTargetDataHandle);
+			ASC->ConsumeClientReplicatedTargetData(Handle, ActivationInfo.GetActivationPredictionKey());
 		}
+		ServerTargetDataHandle.Reset();
 	}
 
 	// 끝내는 함수는 자식이 먼저 호출하고, 마지막에 부모 함수 호출
@@ -178,15 +189,21 @@ void UGA_Construction::UpdatePreview()
 		return;
 	}
 
-	// 이전 프레임의 하이라이트 초기화
+	// 이전 하이라이트 초기화
 	ClearHighlights();
 
 	// 범위 내 블록들을 찾아서 파란색 하이라이트
 	HighlightBlocksInRange();
 
-	// 마우스 커서 아래 블록 찾기
-	FHitResult HitResult;
-	PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+	// 드래그 중이면 시작 셀부터 커서 셀까지의 건설 셀을 표시
+	if (bDragging)
+	{
+		UpdateDragPreview();
+		return;
+	}
+
+	// 마우스 커서 아래 블록 (프리뷰 프레임워크가 트레이스한 결과 사용)
+	const FHitResult& HitResult = GetPreviewCursorHit();
 
 	// bBlockingHit은 Block 응답을 가진 충돌이 발생했는지 여부
 	if (HitResult.bBlockingHit)
@@ -220,32 +237,26 @@ void UGA_Construction::UpdatePreview()
 				}
 			}
 
-			// 프리뷰 블록을 타겟 블록 위에 배치
-			if (PreviewBlock)
+			// 프리뷰 블록을 타겟 블록 위 셀에 배치
+			UBlockGridSubsystem* Grid = GetWorld()->GetSubsystem<UBlockGridSubsystem>();
+			if (PreviewBlock && Grid)
 			{
-				FVector BlockLocation = HitBlock->GetActorLocation();
 				FRotator BlockRotation = HitBlock->GetActorRotation();
-				
-				// 블록 크기만큼 위로 올림 (블록이 100x100x100이라 가정)
-				FVector PreviewLocation = BlockLocation + FVector(0, 0, 100.0f);
-				
-				FCollisionQueryParams CheckParams;
-				CheckParams.AddIgnoredActor(PreviewBlock);
-				CheckParams.AddIgnoredActor(OwnerPawn); // 플레이어 충돌 제외
-
-				// 블록 크기(50)보다 약간 작게(45) 설정하여 인접 블록과의 미세한 간섭 방지
-				bool bIsOccupied = GetWorld()->OverlapBlockingTestByChannel(
-					PreviewLocation,
-					FQuat::Identity,
-					ECC_WorldStatic,
-					FCollisionShape::MakeBox(FVector(45.0f)),
-					CheckParams
-				);
+
+				// 타겟 블록 바로 위 셀
+				const FIntVector PreviewCell = Grid->WorldToCell(HitBlock->GetActorLocation()) + FIntVector(0, 0, 1);
+
+				// 건설과 같은 규칙으로 검사 (그리드 점유 조회 + 그리드에 없는 액터와의 겹침)
+				TArray<FIntVector> PreviewCells;
+				PreviewCells.Add(PreviewCell);
+				FilterBuildableCells(PreviewCells, 0.0f);
+				FilterCellsBlockedByActors(PreviewCells);
+				const bool bIsOccupied = PreviewCells.Num() == 0;
 
 				if (!bIsOccupied)
 				{
 					// 비어있는 공간이면 프리뷰 표시
-					PreviewBlock->SetActorLocation(PreviewLocation);
+					PreviewBlock->SetActorLocation(Grid->CellToWorld(PreviewCell));
 					PreviewBlock->SetActorRotation(BlockRotation);
 					PreviewBlock->SetActorHiddenInGame(false);
 				}
@@ -275,18 +286,112 @@ void UGA_Construction::UpdatePreview()
 	}
 }
 
-void UGA_Construction::SpawnBlock()
+void UGA_Construction::UpdateDragPreview()
 {
-	// Ability 활성화 커밋 (Cost, Cooldown 등 체크 및 적용)
-
-	if (!CommitAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo()))
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GA_Construction: Failed to commit ability"));
-		EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, true);
+		UE_LOG(LogTemp, Error, TEXT("GA_Construction: BlockGridSubsystem is null in UpdateDragPreview"));
 		return;
 	}
 
-	if (!PreviewBlock || PreviewBlock->IsHidden()) return;
+	// 단일 프리뷰 블록은 드래그 프리뷰로 대체
+	if (PreviewBlock)
+	{
+		PreviewBlock->SetActorHiddenInGame(true);
+	}
+
+	// 1. 끝 셀 갱신 (커서가 아무것도 가리키지 않으면 이전 끝 셀 유지)
+	// 층은 BuildDragCells에서 시작 셀로 맞춤
+	const FCursorTargetData* CursorTarget = GetCursorTarget();
+	if (CursorTarget && CursorTarget->HasHit())
+	{
+		DragEndCell = CursorTarget->Cell;
+	}
+	bDragRect = IsRectDragRequested();
+
+	// 2. 건설 셀 계산
+	BuildDragCells(DragAnchorCell, DragEndCell, bDragRect, DragCells);
+	FilterBuildableCells(DragCells, 0.0f);
+
+	// 3. 셀마다 프리뷰 블록 배치 (부족하면 생성, 남으면 숨김)
+	for (int32 i = 0; i < DragCells.Num(); ++i)
+	{
+		if (!DragPreviewBlocks.IsValidIndex(i))
+		{
+			if (!PreviewBlockClass)
+			{
+				break;
+			}
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			AActor* NewPreview = World->SpawnActor<AActor>(PreviewBlockClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+			if (!NewPreview)
+			{
+				UE_LOG(LogTemp, Error, TEXT("GA_Construction: Failed to spawn drag preview block"));
+				break;
+			}
+
+			// 충돌 비활성화
+			NewPreview->SetActorEnableCollision(false);
+			DragPreviewBlocks.Add(NewPreview);
+		}
+
+		AActor* DragPreview = DragPreviewBlocks[i];
+		DragPreview->SetActorLocation(Grid->CellToWorld(DragCells[i]));
+		DragPreview->SetActorHiddenInGame(false);
+	}
+
+	for (int32 i = DragCells.Num(); i < DragPreviewBlocks.Num(); ++i)
+	{
+		if (DragPreviewBlocks[i])
+		{
+			DragPreviewBlocks[i]->SetActorHiddenInGame(true);
+		}
+	}
+}
+
+void UGA_Construction::HideDragPreview()
+{
+	for (AActor* DragPreview : DragPreviewBlocks)
+	{
+		if (DragPreview)
+		{
+			DragPreview->SetActorHiddenInGame(true);
+		}
+	}
+	DragCells.Reset();
+}
+
+uint32 UGA_Construction::GetPreviewKeyExtra() const
+{
+	// 커서 셀은 프리뷰 키에 이미 포함되므로 드래그 여부와 도형만 추가
+	if (!bDragging)
+	{
+		return 0;
+	}
+	return IsRectDragRequested() ? 3u : 1u;
+}
+
+bool UGA_Construction::IsRectDragRequested() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	const APlayerController* PC = OwnerPawn ? Cast<APlayerController>(OwnerPawn->GetController()) : nullptr;
+	return PC && PC->IsInputKeyDown(EKeys::LeftShift);
+}
+
+void UGA_Construction::SpawnBlock()
+{
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GA_Construction: BlockGridSubsystem is null in SpawnBlock"));
+		return;
+	}
 
 	if (!BlockToSpawn)
 	{
@@ -294,45 +399,477 @@ void UGA_Construction::SpawnBlock()
 		return;
 	}
 
+	// 1. 건설할 셀 계산 (드래그 프리뷰와 같은 규칙)
+	TArray<FIntVector> Cells;
+	BuildDragCells(DragAnchorCell, DragEndCell, bDragRect, Cells);
+	FilterBuildableCells(Cells, 0.0f);
+	HideDragPreview();
+
+	// 서버/스탠드얼론은 그리드에 없는 액터와 겹치는 셀도 미리 제외 (코스트는 실제 건설할 블록 수 기준)
+	const bool bIsAuthority = HasAuthority(&CurrentActivationInfo);
+	if (bIsAuthority)
+	{
+		FilterCellsBlockedByActors(Cells);
+	}
+
+	// 건설할 셀이 없으면 스킬 취소 (누를 때 부여한 Casting 상태 해제, 타겟 데이터를 기다리는 서버 인스턴스도 함께 취소)
+	if (Cells.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("GA_Construction: No buildable cell on release, cancelling"));
+		CancelAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
+		return;
+	}
+
+	// 2. Ability 활성화 커밋 (Cost, Cooldown 등 체크 및 적용)
+	// 코스트는 건설할 블록 수에 비례, 실패하면 스킬 종료
+	auto CommitBuild = [this, &Cells]() -> bool
+	{
+		PendingBuildCount = Cells.Num();
+		const bool bCommitted = CommitAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo());
+		PendingBuildCount = 1;
+
+		if (!bCommitted)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GA_Construction: Failed to commit ability"));
+			EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, true);
+		}
+		return bCommitted;
+	};
+
+	// 3. 원격 클라이언트: 서버 왕복을 기다리지 않고 고스트 블록으로 예측
+	// 실제 블록은 서버가 같은 셀 목록을 검증 후 생성하여 복제하고, 도착하면 고스트와 교체됨
+	if (!bIsAuthority)
+	{
+		// 이번 건설 전용 예측 키 생성 (활성화 키에 종속)
+		// 커밋도 이 범위 안에서 해야 예측한 코스트/쿨다운이 서버가 확정하는 키(타겟 데이터 키)와 같아짐
+		FScopedPredictionWindow ScopedPrediction(GetAbilitySystemComponentFromActorInfo(), true);
+
+		if (!CommitBuild())
+		{
+			return;
+		}
+
+		PredictConstruction(DragAnchorCell, DragEndCell, bDragRect, Cells);
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		return;
+	}
+
+	if (!CommitBuild())
+	{
+		return;
+	}
+
+	// 4. 서버/스탠드얼론: 실제 블록 생성
+	// 코스트는 이미 지불했으므로 생성에 실패해도 스킬 종료 (Casting 상태가 남지 않게)
+	if (SpawnConstructedBlocks(Cells) == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GA_Construction: No block was spawned"));
+	}
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+}
+
+void UGA_Construction::BuildDragCells(const FIntVector& AnchorCell, const FIntVector& EndCell, bool bRect, TArray<FIntVector>& OutCells) const
+{
+	OutCells.Reset();
+
+	// 끝 셀은 시작 셀의 층으로 맞춤
+	FIntVector End(EndCell.X, EndCell.Y, AnchorCell.Z);
+	const int32 MaxCells = FMath::Max(MaxDragCells, 1);
+
+	if (!bRect)
+	{
+		// 선은 시작 셀부터 순서대로 추가되므로 상한을 넘는 뒤쪽만 자름
+		BlockGridShapes::RasterizeLine(AnchorCell, End, OutCells);
+		if (OutCells.Num() > MaxCells)
+		{
+			OutCells.SetNum(MaxCells);
+		}
+		return;
+	}
+
+	// 사각형이 상한을 넘으면 X 길이를 먼저 유지하고 Y 길이를 줄임
+	if (BlockGridShapes::CountRectCells(AnchorCell, End) > MaxCells)
+	{
+		const int32 SizeX = FMath::Min(FMath::Abs(End.X - AnchorCell.X) + 1, MaxCells);
+		const int32 SizeY = FMath::Min(FMath::Abs(End.Y - AnchorCell.Y) + 1, FMath::Max(MaxCells / SizeX, 1));
+		End.X = AnchorCell.X + FMath::Sign(End.X - AnchorCell.X) * (SizeX - 1);
+		End.Y = AnchorCell.Y + FMath::Sign(End.Y - AnchorCell.Y) * (SizeY - 1);
+	}
+	BlockGridShapes::RasterizeRect(AnchorCell, End, OutCells);
+}
+
+void UGA_Construction::FilterBuildableCells(TArray<FIntVector>& InOutCells, float RangeSlack) const
+{
+	const UWorld* World = GetWorld();
+	const UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid)
+	{
+		InOutCells.Reset();
+		return;
+	}
+
+	// 1. 사거리 밖 셀 제거
+	const FBox RangeBounds = GetPreviewBounds().ExpandBy(RangeSlack);
+	InOutCells.RemoveAll([Grid, &RangeBounds](const FIntVector& Cell)
+	{
+		return !RangeBounds.IsInsideOrOn(Grid->CellToWorld(Cell));
+	});
+
+	// 2. 블록이 있는 셀 제거 (그리드 일괄 조회, 셀 순서 유지)
+	TBitArray<> Occupied;
+	Grid->GetCellsOccupancy(InOutCells, Occupied);
+
+	int32 NumKept = 0;
+	for (int32 i = 0; i < InOutCells.Num(); ++i)
+	{
+		if (!Occupied[i])
+		{
+			InOutCells[NumKept++] = InOutCells[i];
+		}
+	}
+	InOutCells.SetNum(NumKept);
+}
+
+void UGA_Construction::FilterCellsBlockedByActors(TArray<FIntVector>& InOutCells) const
+{
 	UWorld* World = GetWorld();
-	if (!World) return;
+	const UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid || InOutCells.Num() == 0)
+	{
+		return;
+	}
+
+	// ABlockBase::IsLocationOccupied와 같은 크기 (인접 셀과 닿지 않도록 셀보다 약간 작게)
+	const FVector CellExtent(Grid->GetGridSize() * 0.4f);
+
+	// 1. 모든 셀을 덮는 박스로 한 번만 오버랩
+	FBox CellsBox(ForceInit);
+	for (const FIntVector& Cell : InOutCells)
+	{
+		CellsBox += Grid->CellToWorld(Cell);
+	}
+	CellsBox = CellsBox.ExpandBy(CellExtent);
 
-	// 프리뷰 블록 위치에 실제 블록 생성
-	FVector SpawnLocation = PreviewBlock->GetActorLocation();
-	FRotator SpawnRotation = PreviewBlock->GetActorRotation();
+	FCollisionObjectQueryParams ObjectQueryParams;
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, CellsBox.GetCenter(), FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeBox(CellsBox.GetExtent()));
 
-	ADestructibleBlock* NewBlock = World->SpawnActor<ADestructibleBlock>(BlockToSpawn, SpawnLocation, SpawnRotation, SpawnParams);
+	// 그리드의 블록은 이미 FilterBuildableCells에서 걸렀으므로 제외
+	TArray<UPrimitiveComponent*, TInlineAllocator<8>> Blockers;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (Component && !Cast<ABlockBase>(Overlap.GetActor()))
+		{
+			Blockers.AddUnique(Component);
+		}
+	}
+
+	if (Blockers.Num() == 0)
+	{
+		return;
+	}
+
+	// 2. 찾은 컴포넌트에 대해서만 셀 단위로 검사 (씬 쿼리 없이 컴포넌트 형상과 직접 비교)
+	const FCollisionShape CellShape = FCollisionShape::MakeBox(CellExtent);
+	InOutCells.RemoveAll([Grid, &Blockers, &CellShape](const FIntVector& Cell)
+	{
+		const FVector CellLocation = Grid->CellToWorld(Cell);
+		for (const UPrimitiveComponent* Blocker : Blockers)
+		{
+			if (Blocker->OverlapComponent(CellLocation, FQuat::Identity, CellShape))
+			{
+				return true;
+			}
+		}
+		return false;
+	});
+}
+
+ADestructibleBlock* UGA_Construction::SpawnConstructedBlock(const FVector& SpawnLocation, const FRotator& SpawnRotation)
+{
+	UWorld* World = GetWorld();
+	if (!World || !BlockToSpawn) return nullptr;
+
+	SCOPE_CYCLE_COUNTER(STAT_SkillSpawn);
+	INC_DWORD_STAT(STAT_SkillSpawnedActors);
+
+	// 타입을 BeginPlay 전에 정해 그리드에 한 번만 Destructible로 등록되게 함
+	const FTransform SpawnTransform(SpawnRotation, SpawnLocation);
+	ADestructibleBlock* NewBlock = World->SpawnActorDeferred<ADestructibleBlock>(BlockToSpawn, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 
 	if (NewBlock)
 	{
-		// 블록 초기화 (필요한 경우)
-		NewBlock->SpawnBlock(SpawnLocation, EBlockType::Destructible);
-		
+		NewBlock->SetInitialBlockType(EBlockType::Destructible);
+		NewBlock->FinishSpawning(SpawnTransform);
+
+		// 블록이 소환되자마자 떨어져야 하는지 검사하기 위해 Tick 켬
+		NewBlock->SetActorTickEnabled(true);
+
 		UE_LOG(LogTemp, Log, TEXT("GA_Construction: Spawned new block %s at location %s"), *NewBlock->GetName(), *SpawnLocation.ToString());
-		
-		// 스킬 종료
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 	}
 	else
 	{
 		UE_LOG(LogTemp, Error, TEXT("GA_Construction: Failed to spawn block"));
 	}
+	return NewBlock;
+}
+
+int32 UGA_Construction::SpawnConstructedBlocks(const TArray<FIntVector>& Cells)
+{
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GA_Construction: BlockGridSubsystem is null in SpawnConstructedBlocks"));
+		return 0;
+	}
+
+	// 블록 등록 이벤트와 청크 편집 번호 갱신은 스코프가 끝날 때 한 번에 처리
+	FBlockGridBatchScope BatchScope(Grid);
+
+	int32 NumSpawned = 0;
+	for (const FIntVector& Cell : Cells)
+	{
+		if (SpawnConstructedBlock(Grid->CellToWorld(Cell), FRotator::ZeroRotator))
+		{
+			++NumSpawned;
+		}
+	}
+	return NumSpawned;
+}
+
+bool UGA_Construction::PredictConstruction(const FIntVector& AnchorCell, const FIntVector& EndCell, bool bRect, const TArray<FIntVector>& Cells)
+{
+	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!ASC || !Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GA_Construction: ASC or BlockGridSubsystem is null in PredictConstruction"));
+		return false;
+	}
+
+	// 예측 키는 호출한 SpawnBlock이 연 범위의 키(ScopedPredictionKey)를 그대로 사용
+
+	// 1. 시작/끝 셀과 도형을 서버로 전송 (셀 목록은 서버가 같은 규칙으로 다시 계산)
+	// 블록 수와 관계없이 RPC 한 번
+	FGameplayAbilityTargetData_LocationInfo* LocationData = new FGameplayAbilityTargetData_LocationInfo();
+	LocationData->SourceLocation.LocationType = EGameplayAbilityTargetingLocationType::LiteralTransform;
+	LocationData->SourceLocation.LiteralTransform = FTransform(Grid->CellToWorld(AnchorCell));
+	LocationData->TargetLocation.LocationType = EGameplayAbilityTargetingLocationType::LiteralTransform;
+	LocationData->TargetLocation.LiteralTransform = FTransform(Grid->CellToWorld(EndCell));
+
+	FGameplayAbilityTargetDataHandle DataHandle(LocationData);
+	ASC->ServerSetReplicatedTargetData(
+		CurrentSpecHandle,
+		CurrentActivationInfo.GetActivationPredictionKey(),
+		DataHandle,
+		bRect ? TAG_Construction_DragRect.GetTag() : FGameplayTag(),
+		ASC->ScopedPredictionKey);
+
+	// 2. 로컬 그리드에 고스트 블록 삽입 (서버 응답에 따라 교체/롤백)
+	UBlockPredictionSubsystem* Prediction = World->GetSubsystem<UBlockPredictionSubsystem>();
+	if (!Prediction)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GA_Construction: BlockPredictionSubsystem is null, waiting for server block"));
+		return false;
+	}
+
+	TArray<FVector> Locations;
+	Locations.Reserve(Cells.Num());
+	for (const FIntVector& Cell : Cells)
+	{
+		Locations.Add(Grid->CellToWorld(Cell));
+	}
+
+	const int32 NumGhosts = Prediction->PredictBlocks(BlockToSpawn, Locations, EBlockType::Destructible, ASC, CurrentSpecHandle, ASC->ScopedPredictionKey);
+	INC_DWORD_STAT_BY(STAT_SkillSpawnedActors, NumGhosts);
+	return NumGhosts > 0;
+}
+
+void UGA_Construction::OnServerTargetDataReceived(const FGameplayAbilityTargetDataHandle& Data, FGameplayTag ApplicationTag)
+{
+	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!ASC || !Grid) return;
+
+	// 클라이언트가 이 건설에 사용한 예측 키 (ServerSetReplicatedTargetData가 범위를 열어둠)
+	const FPredictionKey ClientPredictionKey = ASC->ScopedPredictionKey;
+	ASC->ConsumeClientReplicatedTargetData(CurrentSpecHandle, CurrentActivationInfo.GetActivationPredictionKey());
+
+	// 1. 클라이언트와 같은 규칙으로 셀 목록 계산 (시작 셀이 없으면 끝 셀 한 칸)
+	const FGameplayAbilityTargetData* TargetData = Data.Get(0);
+	const bool bHasLocation = TargetData && TargetData->HasEndPoint();
+
+	TArray<FIntVector> Cells;
+	if (bHasLocation)
+	{
+		const FIntVector EndCell = Grid->WorldToCell(TargetData->GetEndPoint());
+		const FIntVector AnchorCell = TargetData->HasOrigin() ? Grid->WorldToCell(TargetData->GetOrigin().GetLocation()) : EndCell;
+		BuildDragCells(AnchorCell, EndCell, ApplicationTag.MatchesTagExact(TAG_Construction_DragRect), Cells);
+
+		// 클라이언트가 조준한 뒤 핑 동안 이동한 거리만큼 한 칸 더 허용
+		FilterBuildableCells(Cells, Grid->GetGridSize());
+		FilterCellsBlockedByActors(Cells);
+	}
+
+	// 2. 검증 후 커밋 (코스트는 실제로 건설할 블록 수 기준)
+	// 실패하면 클라이언트에 GenericCancel을 보내 고스트를 롤백시킴
+	PendingBuildCount = FMath::Max(Cells.Num(), 1);
+	const bool bCommitted = Cells.Num() > 0 && CommitAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo);
+	PendingBuildCount = 1;
+
+	if (!bCommitted)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GA_Construction: Rejected construction request (%d buildable cells)"), Cells.Num());
+		ASC->ClientSetReplicatedEvent(EAbilityGenericReplicatedEvent::GenericCancel, CurrentSpecHandle, ClientPredictionKey);
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		return;
+	}
+
+	// 3. 실제 블록 생성 (클라이언트로 복제되면 셀마다 고스트와 교체되고, 서버가 건너뛴 셀의 고스트는 시간 초과로 롤백됨)
+	if (SpawnConstructedBlocks(Cells) == 0)
+	{
+		ASC->ClientSetReplicatedEvent(EAbilityGenericReplicatedEvent::GenericCancel, CurrentSpecHandle, ClientPredictionKey);
+	}
+
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+}
+
+bool UGA_Construction::CheckCost(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	FGameplayTagContainer* OptionalRelevantTags) const
+{
+	UGameplayEffect* CostGE = GetCostGameplayEffect();
+	if (!CostGE)
+	{
+		return true;
+	}
+
+	UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	FGameplayEffectSpecHandle SpecHandle = MakeBuildCostSpec(Handle, ActorInfo);
+	if (!ASC || !SpecHandle.IsValid())
+	{
+		return false;
+	}
+
+	// 코스트 GE의 모디파이어를 적용해도 속성이 음수가 되지 않는지 검사
+	// 기본 CheckCost는 SetByCaller 값을 모르므로 블록 수가 반영된 Spec으로 직접 계산
+	FGameplayEffectSpec& Spec = *SpecHandle.Data;
+	Spec.CalculateModifierMagnitudes();
+
+	for (int32 ModIdx = 0; ModIdx < CostGE->Modifiers.Num(); ++ModIdx)
+	{
+		const FGameplayModifierInfo& ModInfo = CostGE->Modifiers[ModIdx];
+		if (ModInfo.ModifierOp != EGameplayModOp::Additive || !ASC->HasAttributeSetForAttribute(ModInfo.Attribute))
+		{
+			continue;
+		}
+
+		if (ASC->GetNumericAttribute(ModInfo.Attribute) + Spec.GetModifierMagnitude(ModIdx, true) < 0.0f)
+		{
+			if (OptionalRelevantTags)
+			{
+				OptionalRelevantTags->AddTag(UAbilitySystemGlobals::Get().ActivateFailCostTag);
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UGA_Construction::ApplyCost(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo) const
+{
+	if (!GetCostGameplayEffect())
+	{
+		return;
+	}
+
+	FGameplayEffectSpecHandle SpecHandle = MakeBuildCostSpec(Handle, ActorInfo);
+	if (!SpecHandle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GA_Construction: Failed to create Cost SpecHandle"));
+		return;
+	}
+
+	ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
+}
+
+float UGA_Construction::GetRuneModifiedBuildCost() const
+{
+	// 노랑 룬 감소율을 코스트에도 적용 (룬이 없으면 감소 없음)
+	const FResolvedSkillStats* Stats = GetResolvedSkillStats();
+	const float Reduction = Stats ? Stats->CooldownReduction : 0.0f;
+
+	// 최종 코스트 = 블록당 코스트 * 블록 수 * (1 - 감소율)
+	return CostPerBlock * FMath::Max(PendingBuildCount, 1) * (1.0f - Reduction);
+}
+
+FGameplayEffectSpecHandle UGA_Construction::MakeBuildCostSpec(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo) const
+{
+	UGameplayEffect* CostGE = GetCostGameplayEffect();
+	UAbilitySystemComponent* ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+	if (!CostGE || !ASC)
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(CostGE->GetClass(), GetAbilityLevel(Handle, ActorInfo), MakeEffectContext(Handle, ActorInfo));
+	if (SpecHandle.Data.IsValid())
+	{
+		// SetByCaller 태그(Data.Skill.Cost)에 수치 주입 (속성 감소이므로 음수)
+		SpecHandle.Data->SetSetByCallerMagnitude(TAG_Data_Cost, -GetRuneModifiedBuildCost());
+	}
+	return SpecHandle;
 }
 
 void UGA_Construction::OnLeftClickPressed()
 {
-	// 프리뷰 블록이 존재하고, 숨겨져 있지 않을 때만 블록 생성 시도
-	if (PreviewBlock && !PreviewBlock->IsHidden())
+	// 프리뷰 블록이 존재하고, 숨겨져 있지 않을 때만 드래그 시작
+	if (!PreviewBlock || PreviewBlock->IsHidden())
 	{
-		// 실제 스킬 시전 시작 알림
-		// State.Busy 태그를 부여
-		NotifySkillCastStarted();
-		// 좌클릭 시 블록 생성 시도
-		SpawnBlock();
+		return;
 	}
+
+	const UWorld* World = GetWorld();
+	const UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GA_Construction: BlockGridSubsystem is null in OnLeftClickPressed"));
+		return;
+	}
+
+	// 실제 스킬 시전 시작 알림
+	// State.Busy 태그를 부여
+	NotifySkillCastStarted();
+
+	// 프리뷰 블록 셀에서 드래그 시작 (놓으면 시작 셀부터 커서 셀까지 건설)
+	bDragging = true;
+	DragAnchorCell = Grid->WorldToCell(PreviewBlock->GetActorLocation());
+	DragEndCell = DragAnchorCell;
+	bDragRect = false;
+	InvalidatePreview();
+}
+
+void UGA_Construction::OnLeftClickReleased()
+{
+	if (!bDragging)
+	{
+		return;
+	}
+
+	// 좌클릭을 떼면 드래그한 셀에 블록 생성 시도
+	bDragging = false;
+	bDragRect = IsRectDragRequested();
+	SpawnBlock();
 }
 
 void UGA_Construction::OnCancelPressed(float TimeWaited)
@@ -340,4 +877,3 @@ void UGA_Construction::OnCancelPressed(float TimeWaited)
 	// W키 재입력 시 스킬 취소
 	CancelAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 }
-
@@ -11,8 +11,10 @@
 #include "GameFramework/PlayerController.h"
 #include "TimerManager.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
-#include "Components/InputComponent.h"
 #include "SkillManagerComponent.h"
+#include "CursorTargetingComponent.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "SkillStats.h"
 
 UGA_Destruction::UGA_Destruction() {}
 
@@ -24,12 +26,8 @@ void UGA_Destruction::ActivateAbility(
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	// 프리뷰 업데이트 타이머 시작 (매 프레임 갱신)
-	if (UWorld* World = GetWorld())
-	{
-		// 60FPS 간격으로 UpdatePreview 함수 호출
-		World->GetTimerManager().SetTimer(TickTimerHandle, this, &UGA_Destruction::UpdatePreview, 0.016f, true);
-	}
+	// 프리뷰 시작 (플레이어 위치, 마우스 방향, 룬 범위가 바뀔 때만 UpdatePreview 호출)
+	StartPreview();
 
 	// WaitInputPress 어빌리티 태스크 생성
 	WaitInputTask = UAbilityTask_WaitInputPress::WaitInputPress(this);
@@ -46,24 +44,9 @@ void UGA_Destruction::ActivateAbility(
 	}
 
 	// 좌클릭 입력 바인딩
-	// 좌클릭은 사용 범위가 넓고, 여러 어빌리티에서 공통으로 사용될 수 있으므로
-	// Ability Task 대신 직접 InputComponent에 바인딩
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// 좌클릭 키 바인딩 추가
-			PC->InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &UGA_Destruction::OnLeftClickPressed);
-		}
-		else {
-			UE_LOG(LogTemp, Error, TEXT("GA_Destruction: PlayerController or InputComponent is null"));
-		}
-	}
-	else {
-		UE_LOG(LogTemp, Error, TEXT("GA_Destruction: OwnerPawn is null"));
-	}
+	// 좌클릭은 여러 어빌리티에서 공통으로 사용될 수 있으므로
+	// 입력 바인딩 레지스트리의 임시 매핑 컨텍스트로 등록 (가장 최근에 활성화된 어빌리티가 입력을 받음)
+	BindLeftClick(FSimpleDelegate::CreateUObject(this, &UGA_Destruction::OnLeftClickPressed));
 }
 
 void UGA_Destruction::EndAbility(
@@ -73,14 +56,9 @@ void UGA_Destruction::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
-	// 타이머 정리
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
-
-	// 타이머 핸들 무효화
-	TickTimerHandle.Invalidate();
+	// 프리뷰 정리
+	StopPreview();
+	ClearHighlights();
 
 	// 프리뷰 액터 제거
 	if (RangePreviewActor)
@@ -96,23 +74,8 @@ void UGA_Destruction::EndAbility(
 		WaitInputTask = nullptr;
 	}
 
-	// 입력 바인딩 해제
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// 현재 객체에 바인딩된 델리게이트 제거
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-	}
+	// 좌클릭 바인딩 해제 (핸들로 이 어빌리티의 바인딩만 제거)
+	UnbindLeftClick();
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
@@ -131,9 +94,8 @@ void UGA_Destruction::UpdatePreview()
 		return;
 	}
 
-	// 마우스 커서 위치 가져오기
-	FHitResult HitResult;
-	PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+	// 마우스 커서 위치 가져오기 (프리뷰 프레임워크가 트레이스한 결과 사용)
+	const FHitResult& HitResult = GetPreviewCursorHit();
 
 	// 마우스가 유효한 위치를 가리키고 있어야 함
 	if (!HitResult.bBlockingHit) return;
@@ -148,18 +110,30 @@ void UGA_Destruction::UpdatePreview()
 	// 플레이어 위치에서 마우스 위치로 향하는 단위 벡터
 	FVector DirectionVector = (TargetLocation - StartLocation).GetSafeNormal();
 
-	// 해당 방향을 바라보는 회전값 생성 (FRotationMatrix::MakeFromX 활용)
-	FRotator LookAtRotation = FRotationMatrix::MakeFromX(DirectionVector).Rotator();
+	// 실제 파괴와 같은 박스 계산
+	FVector BoxCenter;
+	FQuat BoxRotation;
+	FVector AdjustedBoxExtent;
+	GetDestructionBox(StartLocation, DirectionVector, BoxCenter, BoxRotation, AdjustedBoxExtent);
+	const FRotator LookAtRotation = BoxRotation.Rotator();
 
-	// 룬 범위 배율 가져오기
-	float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
+	// 범위 안 블록 하이라이트 (실제 파괴 대상과 같은 셀 목록)
+	ClearHighlights();
 
-	// 룬 배율을 적용한 박스 크기 계산
-	FVector AdjustedBoxExtent = BoxExtent * RangeMultiplier;
+	TArray<FIntVector> Cells;
+	GatherDestructionCells(BoxCenter, BoxRotation, AdjustedBoxExtent, Cells);
 
-	// 프리뷰 박스 중심 위치 계산
-	// 플레이어 위치에서 마우스 방향으로 (BoxDistance + 박스 X길이) 만큼 떨어진 곳
-	FVector BoxCenter = StartLocation + DirectionVector * (BoxDistance + AdjustedBoxExtent.X);
+	if (const UBlockGridSubsystem* Grid = GetWorld()->GetSubsystem<UBlockGridSubsystem>())
+	{
+		for (const FIntVector& Cell : Cells)
+		{
+			if (ABlockBase* Block = Grid->GetBlockAt(Cell))
+			{
+				PreviewedBlocks.Add(Block);
+			}
+		}
+	}
+	BatchHighlightBlocks(PreviewedBlocks, EBlockHighlightState::Preview);
 
 	// 프리뷰 액터 생성 (없을 경우)
 	if (!RangePreviewActor && RangePreviewActorClass)
@@ -196,6 +170,39 @@ void UGA_Destruction::UpdatePreview()
 	}
 }
 
+uint32 UGA_Destruction::GetPreviewKeyExtra() const
+{
+	const AActor* AvatarActor = GetAvatarActorFromActorInfo();
+	const FHitResult& HitResult = GetPreviewCursorHit();
+	if (!AvatarActor || !HitResult.bBlockingHit)
+	{
+		return 0;
+	}
+
+	// 1 유닛 단위 플레이어 위치와 1도 단위 마우스 방향
+	const FVector StartLocation = AvatarActor->GetActorLocation();
+	const FVector Direction = (HitResult.Location - StartLocation).GetSafeNormal2D();
+	const int32 Yaw = FMath::RoundToInt(Direction.Rotation().Yaw);
+	const FIntVector RoundedLocation(FMath::RoundToInt(StartLocation.X), FMath::RoundToInt(StartLocation.Y), FMath::RoundToInt(StartLocation.Z));
+
+	return HashCombine(GetTypeHash(RoundedLocation), GetTypeHash(Yaw));
+}
+
+FBox UGA_Destruction::GetPreviewBounds() const
+{
+	const AActor* AvatarActor = GetAvatarActorFromActorInfo();
+	if (!AvatarActor)
+	{
+		return FBox(ForceInit);
+	}
+
+	// 박스의 가장 먼 모서리까지의 수평 거리 + 한 칸 여유
+	const FVector AdjustedBoxExtent = BoxExtent * (GetRuneModifiedRange() / BaseRange);
+	const float Margin = 100.0f;
+	const float Reach = FVector2D(BoxDistance + AdjustedBoxExtent.X * 2.0f, AdjustedBoxExtent.Y).Size() + Margin;
+	return FBox::BuildAABB(AvatarActor->GetActorLocation(), FVector(Reach, Reach, AdjustedBoxExtent.Z + Margin));
+}
+
 void UGA_Destruction::OnLeftClickPressed()
 {
 	// 실제 스킬 시전 시작 알림
@@ -231,41 +238,31 @@ void UGA_Destruction::PerformDestruction()
 	FVector DirectionVector = AvatarActor->GetActorForwardVector(); // 기본값 (실패 시)
 	FQuat BoxRotation = AvatarActor->GetActorQuat(); // 기본값 (실패 시)
 
-	if (APawn* OwnerPawn = Cast<APawn>(AvatarActor))
+	// 프리뷰와 같은 프레임 공유 커서 결과 사용
+	if (const FCursorTargetData* CursorTarget = GetCursorTarget())
 	{
-		if (APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController()))
+		if (CursorTarget->HasHit())
 		{
-			FHitResult HitResult;
-			PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
-
-			if (HitResult.bBlockingHit)
-			{
-				FVector StartLocation = OwnerPawn->GetActorLocation();
-				FVector TargetLocation = HitResult.Location;
-				TargetLocation.Z = StartLocation.Z; // 높이는 무시
-
-				DirectionVector = (TargetLocation - StartLocation).GetSafeNormal();
-				BoxRotation = FRotationMatrix::MakeFromX(DirectionVector).ToQuat();
-			}
+			FVector StartLocation = AvatarActor->GetActorLocation();
+			FVector TargetLocation = CursorTarget->HitResult.Location;
+			TargetLocation.Z = StartLocation.Z; // 높이는 무시
 
-		}
-		else {
-			UE_LOG(LogTemp, Error, TEXT("GA_Destruction: PlayerController is null in PerformDestruction"));
+			DirectionVector = (TargetLocation - StartLocation).GetSafeNormal();
+			BoxRotation = FRotationMatrix::MakeFromX(DirectionVector).ToQuat();
 		}
 	}
 	else {
-		UE_LOG(LogTemp, Error, TEXT("GA_Destruction: OwnerPawn is null in PerformDestruction"));
+		UE_LOG(LogTemp, Error, TEXT("GA_Destruction: Local PlayerController is null in PerformDestruction"));
 	}
 
-	// 룬 범위 배율 가져오기
-	float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
-
-	// 룬 배율을 적용한 박스 크기 계산
-	FVector AdjustedBoxExtent = BoxExtent * RangeMultiplier;
-	FVector OwnerLocation = AvatarActor->GetActorLocation();
+	// 프리뷰와 같은 박스 계산
+	FVector BoxCenter;
+	FVector AdjustedBoxExtent;
+	GetDestructionBox(AvatarActor->GetActorLocation(), DirectionVector, BoxCenter, BoxRotation, AdjustedBoxExtent);
 
-	// 마우스 방향(DirectionVector)을 사용하여 중심점 계산
-	FVector BoxCenter = OwnerLocation + DirectionVector * (BoxDistance + AdjustedBoxExtent.X);
+	// 블록은 물리 오버랩 대신 그리드 래스터화로 구함 (프리뷰 하이라이트와 같은 셀)
+	TArray<FIntVector> BlockCells;
+	GatherDestructionCells(BoxCenter, BoxRotation, AdjustedBoxExtent, BlockCells);
 
 	// 충돌 검사 파라미터
 	FCollisionQueryParams QueryParams;
@@ -274,8 +271,8 @@ void UGA_Destruction::PerformDestruction()
 
 	TArray<FOverlapResult> OverlapResults;
 
-	// 충돌 검사 수행
-	bool bHit = GetWorld()->OverlapMultiByChannel(
+	// 블록 외 대상(적, 플레이어) 충돌 검사 (결과의 블록은 무시됨)
+	GetWorld()->OverlapMultiByChannel(
 		OverlapResults,
 		BoxCenter,
 		BoxRotation, // 마우스 방향에 맞춘 회전값 적용
@@ -284,67 +281,44 @@ void UGA_Destruction::PerformDestruction()
 		QueryParams
 	);
 
-	if (bHit)
+	// 데미지/파괴 스펙을 발동당 한 번씩만 만들어 중복 없는 대상에 적용하고, 블록 셀은 그리드 피해로 전달
+	if (OverlapResults.Num() > 0 || BlockCells.Num() > 0)
 	{
-		for (const FOverlapResult& Overlap : OverlapResults)
-		{
-			AActor* HitActor = Overlap.GetActor();
-			if (!HitActor) continue;
-
-			// ASC 확인
-			// ASC를 가진 액터만 GE 적용 가능
-			UAbilitySystemComponent* TargetASC = nullptr;
-			if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(HitActor))
-			{
-				TargetASC = ASI->GetAbilitySystemComponent();
-			}
-
-			if (TargetASC)
-			{
-				// 데미지 Effect 적용
-				FGameplayEffectSpecHandle DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
-				if (DamageSpecHandle.IsValid())
-				{
-					GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(
-						*DamageSpecHandle.Data.Get(),
-						TargetASC
-					);
-				}
-				else {
-					UE_LOG(LogTemp, Error, TEXT("GA_Destruction: Failed to create GameplayEffectSpec for %s"), *HitActor->GetName());
-				}
-
-				// 파괴 Effect 적용
-				if (DestructionEffect)
-				{
-					FGameplayEffectContextHandle DestructionContext = GetAbilitySystemComponentFromActorInfo()->MakeEffectContext();
-					DestructionContext.AddSourceObject(AvatarActor);
-
-					FGameplayEffectSpecHandle DestructionSpecHandle = GetAbilitySystemComponentFromActorInfo()->MakeOutgoingSpec(
-						DestructionEffect,
-						GetAbilityLevel(),
-						DestructionContext
-					);
-
-					if (DestructionSpecHandle.IsValid())
-					{
-						GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(
-							*DestructionSpecHandle.Data.Get(),
-							TargetASC
-						);
-					}
-					else {
-						UE_LOG(LogTemp, Error, TEXT("GA_Destruction: Failed to create GameplayEffectSpec for %s"), *HitActor->GetName());
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("GA_Destruction: DestructionEffect is null"));
-				}
-			}
-		}
+		ApplySkillEffectsToOverlaps(OverlapResults, DestructionEffect, &BlockCells);
 	}
 
 	// 로직 수행 완료 후 정상 종료 (bWasCancelled = false)
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
+
+void UGA_Destruction::GetDestructionBox(const FVector& StartLocation, const FVector& DirectionVector, FVector& OutCenter, FQuat& OutRotation, FVector& OutExtent) const
+{
+	// 룬 범위 배율을 적용한 박스 크기
+	const float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
+	OutExtent = BoxExtent * RangeMultiplier;
+
+	// 플레이어 위치에서 방향으로 (BoxDistance + 박스 X길이) 만큼 떨어진 곳을 중심으로, 방향을 바라보도록 회전
+	OutCenter = StartLocation + DirectionVector * (BoxDistance + OutExtent.X);
+	OutRotation = FRotationMatrix::MakeFromX(DirectionVector).ToQuat();
+}
+
+void UGA_Destruction::GatherDestructionCells(const FVector& Center, const FQuat& Rotation, const FVector& Extent, TArray<FIntVector>& OutCells) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SkillRangeQuery);
+
+	const UBlockGridSubsystem* Grid = GetWorld()->GetSubsystem<UBlockGridSubsystem>();
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GA_Destruction: BlockGridSubsystem is null"));
+		return;
+	}
+
+	Grid->GetOccupiedCellsInOrientedBox(Center, Rotation, Extent, OutCells);
+	INC_DWORD_STAT_BY(STAT_SkillRangeQueryBlocks, OutCells.Num());
+}
+
+void UGA_Destruction::ClearHighlights()
+{
+	BatchHighlightBlocks(PreviewedBlocks, EBlockHighlightState::None);
+	PreviewedBlocks.Empty();
+}
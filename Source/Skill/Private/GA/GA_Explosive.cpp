@@ -3,6 +3,7 @@
 
 #include "GA/GA_Explosive.h"
 #include "Object/Explosive.h"
+#include "Object/ExplosivePoolSubsystem.h"
 #include "Block/BlockBase.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
 #include "GameFramework/PlayerController.h"
@@ -18,6 +19,19 @@ UGA_Explosive::UGA_Explosive()
 {
 }
 
+void UGA_Explosive::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnAvatarSet(ActorInfo, Spec);
+
+	// 첫 투척 때 SpawnActor 비용이 들지 않도록 폭발물을 미리 생성
+	UWorld* World = GetWorld();
+	UExplosivePoolSubsystem* Pool = World ? World->GetSubsystem<UExplosivePoolSubsystem>() : nullptr;
+	if (Pool && ExplosiveClass)
+	{
+		Pool->Prewarm(ExplosiveClass, PoolPrewarmCount);
+	}
+}
+
 void UGA_Explosive::ActivateAbility(
 	const FGameplayAbilitySpecHandle Handle,
 	const FGameplayAbilityActorInfo* ActorInfo,
@@ -26,22 +40,19 @@ void UGA_Explosive::ActivateAbility(
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	// GA_StickyBomb ޸  ź Ȯϰų ϴ  .
-	//  ô  (Preview)  .
+	// GA_StickyBomb과 달리 기존 폭탄을 확인하거나 기폭하는 로직이 없음.
+	// 즉시 투척을 위한 조준(Preview) 모드로 진입.
 
-	//  Ÿ̸ 
-	if (UWorld* World = GetWorld())
+	// 프리뷰 시작 (커서 셀, 플레이어 셀, 범위 내 블록이 바뀔 때만 UpdatePreview 호출)
+	if (!GetWorld())
 	{
-		World->GetTimerManager().SetTimer(TickTimerHandle, this, &UGA_Explosive::UpdatePreview, 0.016f, true);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("GA_Explosive: World is null, cannot start Preview Timer"));
+		UE_LOG(LogTemp, Error, TEXT("GA_Explosive: World is null, cannot start Preview"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
+	StartPreview();
 
-	//  Է  (ų Է½  )
+	// 취소 입력 대기 (스킬 재입력시 조준 취소)
 	InputTask = UAbilityTask_WaitInputPress::WaitInputPress(this);
 	if (InputTask)
 	{
@@ -53,24 +64,8 @@ void UGA_Explosive::ActivateAbility(
 		UE_LOG(LogTemp, Error, TEXT("GA_Explosive: Failed to create WaitInputTask for targeting"));
 	}
 
-	// Ŭ ε (ô Ȯ)
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			PC->InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &UGA_Explosive::OnLeftClickPressed);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("GA_Explosive: PlayerController or InputComponent is null"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("GA_Explosive: OwnerPawn is null"));
-	}
+	// 좌클릭 바인딩 (투척 확정)
+	BindLeftClick(FSimpleDelegate::CreateUObject(this, &UGA_Explosive::OnLeftClickPressed));
 }
 
 void UGA_Explosive::EndAbility(
@@ -80,49 +75,23 @@ void UGA_Explosive::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
-	// Ÿ̸ 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
-	TickTimerHandle.Invalidate();
+	// 프리뷰 정리
+	StopPreview();
 
-	// ̶Ʈ 
+	// 하이라이트 정리
 	ClearHighlights();
 
-	// ½ũ 
+	// 태스크 정리
 	if (InputTask)
 	{
 		InputTask->EndTask();
 		InputTask = nullptr;
 	}
 
-	// Է ε 
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("GA_Explosive: PC or InputComponent null during EndAbility cleanup"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("GA_Explosive: OwnerPawn null during EndAbility cleanup"));
-	}
+	// 입력 바인딩 해제
+	UnbindLeftClick();
 
-	//  Ÿ ʱȭ
+	// 저장된 타겟 초기화
 	SavedTargetBlock.Reset();
 
 	NotifySkillCastFinished();
@@ -132,32 +101,31 @@ void UGA_Explosive::EndAbility(
 
 void UGA_Explosive::UpdatePreview()
 {
-	// GA_StickyBomb   
+	// GA_StickyBomb과 동일한 로직 사용
 	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
 	if (!OwnerPawn) return;
 
 	APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
 	if (!PC) return;
 
-	// 1.   ̶Ʈ ʱȭ
+	// 1. 이전 하이라이트 초기화
 	ClearHighlights();
 
-	// 2. Ÿ   Ž
+	// 2. 사거리 내 블록 탐색
 	TArray<ABlockBase*> BlocksInRange;
 	FindBlocksInRange(BlocksInRange);
 
-	// 3. Ž ϵ鿡 ϰ 'Preview(Ķ)'  
+	// 3. 탐색된 블록들에 일괄적으로 'Preview(파랑)' 상태 적용
 	BatchHighlightBlocks(BlocksInRange, EBlockHighlightState::Preview);
 
-	// 4. ߿    
+	// 4. 나중에 끄기 위해 목록 백업
 	PreviewedBlocks = BlocksInRange;
 
-	// 5. 콺 Ŀ ġ  Ÿ ó
-	FHitResult HitResult;
-	PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+	// 5. 마우스 커서 위치의 블록 타겟팅 처리 (프리뷰 프레임워크가 트레이스한 결과 사용)
+	const FHitResult& HitResult = GetPreviewCursorHit();
 	ABlockBase* HitBlock = Cast<ABlockBase>(HitResult.GetActor());
 
-	// 콺   Ÿ(Ķ ) ȿ ԵǾ ִٸ 'Targeted(ʷ)' 
+	// 마우스 밑의 블록이 사거리(파란 영역) 안에 포함되어 있다면 'Targeted(초록)'으로 덮어쓰기
 	if (HitBlock && PreviewedBlocks.Contains(HitBlock))
 	{
 		HitBlock->SetHighlightState(EBlockHighlightState::Targeted);
@@ -171,30 +139,30 @@ void UGA_Explosive::UpdatePreview()
 
 void UGA_Explosive::OnLeftClickPressed()
 {
-	// ̶Ʈ  ȿ  
+	// 하이라이트된 블록이 유효할 때만 시전
 	if (HighlightedBlock.IsValid())
 	{
-		// ų   (Busy ±  )
+		// 스킬 시전 시작 (Busy 태그 등 적용)
 		NotifySkillCastStarted();
 
-		// ߹ ô  ų  (ܹ߼̹Ƿ  )
+		// 폭발물 투척 및 스킬 종료 (단발성이므로 즉시 종료됨)
 		SpawnExplosive();
 	}
 	else
 	{
-		// Ÿ ȿ   ƹ    (α  )
+		// 타겟이 유효하지 않을 때는 아무 동작 하지 않음 (로그 생략 가능)
 	}
 }
 
 void UGA_Explosive::OnCancelPressed(float TimeWaited)
 {
-	//    
+	// 조준 취소 및 종료
 	CancelAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 }
 
 void UGA_Explosive::SpawnExplosive()
 {
-	// ڽƮ  Ȯ
+	// 코스트 지불 확인
 	if (!CommitAbilityCost(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo()))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GA_Explosive: Failed to commit ability cost"));
@@ -209,64 +177,77 @@ void UGA_Explosive::SpawnExplosive()
 		return;
 	}
 
-	// ǥ  
+	// 목표 블록 백업
 	SavedTargetBlock = HighlightedBlock.Get();
 
-	//    Է   (EndAbility ó   )
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
+	// 프리뷰 종료 및 입력 해제 로직 (EndAbility에서 처리하지만 명시적 정리를 위해)
+	StopPreview();
 	ClearHighlights();
 
-	// Է ½ũ 
+	// 입력 태스크 종료
 	if (InputTask)
 	{
 		InputTask->EndTask();
 		InputTask = nullptr;
 	}
 
-	// ߹ 
+	// 폭발물 생성
 	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
 	if (OwnerPawn)
 	{
 		FVector SpawnLoc = OwnerPawn->GetActorLocation();
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		AExplosive* NewExplosive = GetWorld()->SpawnActor<AExplosive>(ExplosiveClass, SpawnLoc, FRotator::ZeroRotator, SpawnParams);
+		UExplosivePoolSubsystem* Pool = GetWorld()->GetSubsystem<UExplosivePoolSubsystem>();
+		AExplosive* NewExplosive = nullptr;
+		if (Pool)
+		{
+			NewExplosive = Pool->AcquireExplosive(ExplosiveClass, SpawnLoc);
+		}
+		else
+		{
+			// 풀이 없는 월드에서는 직접 생성 (반납 시 ReleaseToPool이 Destroy로 처리)
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			NewExplosive = GetWorld()->SpawnActor<AExplosive>(ExplosiveClass, SpawnLoc, FRotator::ZeroRotator, SpawnParams);
+		}
 
 		if (NewExplosive && SavedTargetBlock.IsValid())
 		{
-			//   ڵ 
+			// 데미지 스펙 핸들 생성
 			FGameplayEffectSpecHandle DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
 
-			// ߹ ʱȭ
-			// ߿: AutoDetonateDelay 0.0f Ͽ ź(OnLanded)   ϵ 
+			// 폭발물 초기화
+			// 중요: AutoDetonateDelay를 0.0f로 설정하여 착탄(OnLanded) 후 즉시 폭발하도록 함
 			NewExplosive->Initialize(
 				SpawnLoc,
 				SavedTargetBlock.Get(),
 				1.5f,			// FlightDuration
-				0.01f,			// AutoDetonateDelay ( )
+				0.01f,			// AutoDetonateDelay (즉시 폭발)
 				ExplosionRadius * GetRuneModifiedRange(),
-				1,				// MaxBombCount ( ų ǹ  1 )
+				1,				// MaxBombCount (이 스킬에선 의미 없지만 1로 전달)
 				GetAbilitySystemComponentFromActorInfo(),
 				DamageSpecHandle,
-				DestructionEffect
+				DestructionEffect,
+				GetRuneModifiedBlockDamage()
 			);
 
-			//  ź ޸ Ʈ ߰ϰų Ʈ ٸ .
-			//   ų  .
+			// 점착 폭탄과 달리 리스트에 추가하거나 델리게이트를 기다리지 않음.
+			// 던지는 행위로 스킬 사용은 끝남.
 
-			// ô  Ÿ 
+			// 투척 즉시 쿨타임 적용
 			CommitAbilityCooldown(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 
-			// ų  
+			// 스킬 정상 종료
 			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		}
 		else
 		{
 			UE_LOG(LogTemp, Error, TEXT("GA_Explosive: Failed to spawn bomb or invalid target"));
+
+			// 꺼낸 폭발물은 쓰지 않았으므로 풀에 반납
+			if (Pool && NewExplosive)
+			{
+				Pool->ReleaseExplosive(NewExplosive);
+			}
 			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		}
 	}
@@ -279,10 +260,10 @@ void UGA_Explosive::SpawnExplosive()
 
 void UGA_Explosive::ClearHighlights()
 {
-	//   ϵ ¸ 'None' 
+	// 저장된 프리뷰 블록들의 상태를 'None'으로 복구
 	BatchHighlightBlocks(PreviewedBlocks, EBlockHighlightState::None);
 
-	//  ʱȭ
+	// 목록 초기화
 	PreviewedBlocks.Empty();
 	HighlightedBlock.Reset();
 }
\ No newline at end of file
@@ -1,12 +1,20 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "GA/GA_SkillBase.h"
+#include "SkillStats.h"
 #include "Interface/ISkillManagerProvider.h"
 #include "Interface/IAttributeSetProvider.h"
 #include "SkillManagerComponent.h"
+#include "Data/SkillDataSubsystem.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
 #include "AttributeSet.h"
 #include "Engine/OverlapResult.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Combat/EffectQueueSubsystem.h"
+#include "Task/AbilityTask_SkillPreview.h"
+#include "CursorTargetingComponent.h"
+#include "GameFramework/PlayerController.h"
 
 UE_DEFINE_GAMEPLAY_TAG(TAG_Player, "Player");
 
@@ -14,6 +22,7 @@ UE_DEFINE_GAMEPLAY_TAG(TAG_Skill, "Skill");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Skill_Casting, "State.Casting");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_Damage, "Data.Skill.Damage");
 UE_DEFINE_GAMEPLAY_TAG(TAG_Data_Cooldown, "Data.Skill.Cooldown");
+UE_DEFINE_GAMEPLAY_TAG(TAG_Data_Cost, "Data.Skill.Cost");
 
 UGA_SkillBase::UGA_SkillBase()
 {
@@ -72,84 +81,90 @@ USkillManagerComponent* UGA_SkillBase::GetSkillManagerFromAvatar() const
 	return nullptr;
 }
 
-float UGA_SkillBase::GetRuneModifiedDamage() const
+const FResolvedSkillStats* UGA_SkillBase::GetResolvedSkillStats() const
 {
 	// 현재 이 스킬이 장착된 슬롯 번호(InputID) 가져오기
-	int32 SlotIndex = GetCurrentAbilitySpec()->InputID;
+	const FGameplayAbilitySpec* Spec = GetCurrentAbilitySpec();
+	if (!Spec)
+	{
+		return nullptr;
+	}
 
 	// SkillManager 가져오기
 	USkillManagerComponent* SkillManager = GetSkillManagerFromAvatar();
 	if (!SkillManager)
 	{
-		return BaseDamage; // 매니저가 없으면 기본 피해량 반환
+		return nullptr;
 	}
 
-	// 캐릭터 공격력 가져오기
-	float CharacterAttackPower = 0.0f;
-	AActor* Avatar = GetAvatarActorFromActorInfo();
-	if (Avatar)
+	// 룬 장착이 바뀔 때만 다시 계산된 값
+	return SkillManager->GetResolvedStats(Spec->InputID);
+}
+
+float UGA_SkillBase::GetCharacterAttackPower() const
+{
+	// IAttributeSetProvider 인터페이스를 구현했는지 확인
+	const IAttributeSetProvider* Provider = Cast<IAttributeSetProvider>(GetAvatarActorFromActorInfo());
+	if (!Provider)
 	{
-		// IAttributeSetProvider 인터페이스를 구현했는지 확인
-		IAttributeSetProvider* Provider = Cast<IAttributeSetProvider>(Avatar);
-		if (Provider)
-		{
-			UAttributeSet* AttributeSet = Provider->GetAttributeSet();
-			if (AttributeSet)
-			{
-				// AttackPower 속성 가져오기 (FGameplayAttribute 사용)
-				static FProperty* AttackPowerProperty = FindFProperty<FProperty>(AttributeSet->GetClass(), FName("AttackPower"));
-				if (AttackPowerProperty)
-				{
-					const FGameplayAttributeData* AttackPowerData = AttackPowerProperty->ContainerPtrToValuePtr<FGameplayAttributeData>(AttributeSet);
-					if (AttackPowerData)
-					{
-						CharacterAttackPower = AttackPowerData->GetCurrentValue();
-					}
-				}
-			}
-		}
+		return 0.0f;
+	}
+
+	// 타입이 지정된 공격력 Attribute (AttributeSet 클래스가 달라도 안전)
+	const FGameplayAttribute AttackPowerAttribute = Provider->GetAttackPowerAttribute();
+	const UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+	if (!AttackPowerAttribute.IsValid() || !ASC || !ASC->HasAttributeSetForAttribute(AttackPowerAttribute))
+	{
+		return 0.0f;
 	}
 
-	// 룬 계수 가져오기
-	float Multiplier = SkillManager->GetTotalDamageMultiplier(SlotIndex);
+	return ASC->GetNumericAttribute(AttackPowerAttribute);
+}
+
+float UGA_SkillBase::GetRuneModifiedDamage() const
+{
+	const FResolvedSkillStats* Stats = GetResolvedSkillStats();
+	if (!Stats)
+	{
+		return BaseDamage; // 매니저가 없으면 기본 피해량 반환
+	}
 
 	// 최종 피해량 = (캐릭터 공격력 + 스킬 기본 피해량) * 룬 계수
-	return (CharacterAttackPower + BaseDamage) * Multiplier;
+	return (GetCharacterAttackPower() + BaseDamage) * Stats->DamageMultiplier;
 }
 
-float UGA_SkillBase::GetRuneModifiedRange() const
+float UGA_SkillBase::GetRuneModifiedBlockDamage() const
 {
-	int32 SlotIndex = GetCurrentAbilitySpec()->InputID;
+	const FResolvedSkillStats* Stats = GetResolvedSkillStats();
+	if (!Stats)
+	{
+		return BaseBlockDamage; // 매니저가 없으면 기본 블록 피해량 반환
+	}
 
-	// SkillManager 가져오기
-	USkillManagerComponent* SkillManager = GetSkillManagerFromAvatar();
-	if (!SkillManager)
+	return BaseBlockDamage * Stats->DamageMultiplier;
+}
+
+float UGA_SkillBase::GetRuneModifiedRange() const
+{
+	const FResolvedSkillStats* Stats = GetResolvedSkillStats();
+	if (!Stats)
 	{
 		return BaseRange; // 매니저가 없으면 기본 범위 반환
 	}
 
-	float Multiplier = SkillManager->GetTotalRangeMultiplier(SlotIndex);
-
-	return BaseRange * Multiplier;
+	return BaseRange * Stats->RangeMultiplier;
 }
 
 float UGA_SkillBase::GetRuneModifiedCooldown() const
 {
-	int32 SlotIndex = GetCurrentAbilitySpec()->InputID;
-
-	// SkillManager 가져오기
-	USkillManagerComponent* SkillManager = GetSkillManagerFromAvatar();
-	if (!SkillManager)
+	const FResolvedSkillStats* Stats = GetResolvedSkillStats();
+	if (!Stats)
 	{
 		return BaseCooldown; // 매니저가 없으면 기본 쿨타임 반환
 	}
 
-	// 쿨타임 감소율 (예: 0.1 = 10%)
-	float Reduction = SkillManager->GetTotalCooldownReduction(SlotIndex);
-
 	// 최종 쿨타임 = 기본 쿨타임 * (1 - 감소율)
-	// 범위는 캐릭터 기본값이 없으므로 그대로 유지
-	return BaseCooldown * (1.0f - Reduction);
+	return BaseCooldown * (1.0f - Stats->CooldownReduction);
 }
 
 // 데미지 처리: SetByCaller로 데미지 수치 주입
@@ -259,6 +274,101 @@ void UGA_SkillBase::NotifySkillCastFinished()
 	}
 }
 
+bool UGA_SkillBase::CanActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayTagContainer* SourceTags,
+	const FGameplayTagContainer* TargetTags,
+	FGameplayTagContainer* OptionalRelevantTags) const
+{
+	// 비활성 변형은 태그/쿨타임/코스트 검사 없이 바로 거부
+	// CDO에서도 호출될 수 있으므로 캐시 대신 ActorInfo의 아바타에서 직접 조회
+	const ISkillManagerProvider* Provider = ActorInfo ? Cast<ISkillManagerProvider>(ActorInfo->AvatarActor.Get()) : nullptr;
+	const USkillManagerComponent* SkillManager = Provider ? Provider->GetSkillManager() : nullptr;
+	if (SkillManager && !SkillManager->IsActiveVariant(Handle))
+	{
+		return false;
+	}
+
+	return Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags);
+}
+
+void UGA_SkillBase::ActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData)
+{
+	// 발동 기록 (스펙 핸들별 수명은 EndAbility에서 계산)
+	ActivationStartCycles = FPlatformTime::Cycles64();
+	INC_DWORD_STAT(STAT_SkillActivations);
+	FSkillTrace::OutputActivated(Handle, this);
+
+	// 테이블 값이 바뀌었으면 발동 전에 반영
+	RefreshSkillData();
+
+	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+}
+
+void UGA_SkillBase::RefreshSkillData()
+{
+	USkillDataSubsystem* SkillData = USkillDataSubsystem::Get(GetAvatarActorFromActorInfo());
+	if (!SkillData || SkillData->GetDataVersion() == AppliedSkillDataVersion)
+	{
+		return;
+	}
+	AppliedSkillDataVersion = SkillData->GetDataVersion();
+
+	const FSkillDataRow* Data = SkillDataID.IsNone() ? SkillData->FindSkillDataByClass(GetClass()) : SkillData->FindSkillData(SkillDataID);
+	if (!Data)
+	{
+		// 테이블에 없는 스킬은 에디터 기본값 사용
+		if (!SkillDataID.IsNone())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGA_SkillBase::RefreshSkillData: %s not found in skill data table"), *SkillDataID.ToString());
+		}
+		return;
+	}
+
+	ApplySkillData(*Data);
+}
+
+void UGA_SkillBase::ApplySkillData(const FSkillDataRow& Data)
+{
+	// 비어있는(0 이하) 칸은 GA 클래스 기본값(CDO) 사용
+	// 이전에 테이블 값을 반영했다가 다시 비운 경우에도 기본값으로 돌아가도록 CDO에서 읽음
+	const UGA_SkillBase* Defaults = GetClass()->GetDefaultObject<UGA_SkillBase>();
+	BaseDamage = (Data.BaseDamage > 0.0f) ? Data.BaseDamage : Defaults->BaseDamage;
+	BaseCooldown = (Data.BaseCooldown > 0.0f) ? Data.BaseCooldown : Defaults->BaseCooldown;
+	BaseRange = (Data.BaseRange > 0.0f) ? Data.BaseRange : Defaults->BaseRange;
+	BaseBlockDamage = (Data.BaseBlockDamage > 0.0f) ? Data.BaseBlockDamage : Defaults->BaseBlockDamage;
+	RangeXY = (Data.RangeXY > 0.0f) ? Data.RangeXY : Defaults->RangeXY;
+	RangeZ = (Data.RangeZ > 0.0f) ? Data.RangeZ : Defaults->RangeZ;
+}
+
+bool UGA_SkillBase::CommitAbilityCost(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	FGameplayTagContainer* OptionalRelevantTags)
+{
+	const bool bCommitted = Super::CommitAbilityCost(Handle, ActorInfo, ActivationInfo, OptionalRelevantTags);
+	if (bCommitted)
+	{
+		FSkillTrace::OutputCommitted(Handle);
+	}
+	return bCommitted;
+}
+
+void UGA_SkillBase::CommitExecute(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo)
+{
+	Super::CommitExecute(Handle, ActorInfo, ActivationInfo);
+	FSkillTrace::OutputCommitted(Handle);
+}
+
 void UGA_SkillBase::EndAbility(
 	const FGameplayAbilitySpecHandle Handle,
 	const FGameplayAbilityActorInfo* ActorInfo,
@@ -266,6 +376,22 @@ void UGA_SkillBase::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
+	// 종료 기록 (발동 중이었던 경우만, 중복 종료 호출은 무시)
+	if (ActivationStartCycles != 0)
+	{
+		// 발동부터 종료까지의 실제 경과 시간 (대기 포함, CPU 비용은 stat Skills로 확인)
+		const double LifetimeSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - ActivationStartCycles);
+		FSkillTrace::OutputEnded(Handle, bWasCancelled, LifetimeSeconds);
+		FSkillTimingLog::RecordEnded(this, bWasCancelled, LifetimeSeconds);
+		ActivationStartCycles = 0;
+	}
+
+	// 프리뷰 정리
+	StopPreview();
+
+	// 좌클릭 바인딩 정리 (자식이 먼저 해제했다면 아무 일도 하지 않음)
+	UnbindLeftClick();
+
 	// GA 종료 시 "State.Busy" 태그 제거
 	AActor* Avatar = GetAvatarActorFromActorInfo();
 	if (Avatar)
@@ -285,6 +411,8 @@ void UGA_SkillBase::EndAbility(
 
 void UGA_SkillBase::FindBlocksInRange(TArray<ABlockBase*>& OutBlocks)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SkillRangeQuery);
+
 	// 결과 배열 초기화 (매 프레임 호출될 수 있으므로 비워줌)
 	OutBlocks.Empty();
 
@@ -366,10 +494,15 @@ void UGA_SkillBase::FindBlocksInRange(TArray<ABlockBase*>& OutBlocks)
 		// 결과 배열에 유효한 블록 추가
 		OutBlocks.Add(Block);
 	}
+
+	INC_DWORD_STAT_BY(STAT_SkillRangeQueryBlocks, OutBlocks.Num());
 }
 
 void UGA_SkillBase::BatchHighlightBlocks(const TArray<ABlockBase*>& Blocks, EBlockHighlightState State)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SkillHighlight);
+	INC_DWORD_STAT_BY(STAT_SkillHighlightedBlocks, Blocks.Num());
+
 	for (ABlockBase* Block : Blocks)
 	{
 		if (Block)
@@ -377,4 +510,330 @@ void UGA_SkillBase::BatchHighlightBlocks(const TArray<ABlockBase*>& Blocks, EBlo
 			Block->SetHighlightState(State);
 		}
 	}
-}
\ No newline at end of file
+}
+
+int32 UGA_SkillBase::ApplySkillEffectsToOverlaps(
+	const TArray<FOverlapResult>& Overlaps,
+	TSubclassOf<UGameplayEffect> ExtraEffect,
+	const TArray<FIntVector>* BlockCells)
+{
+	UAbilitySystemComponent* SourceASC = GetAbilitySystemComponentFromActorInfo();
+	if (!SourceASC)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGA_SkillBase::ApplySkillEffectsToOverlaps: SourceASC is null"));
+		return 0;
+	}
+
+	// 1. 발동당 스펙 한 번씩만 생성
+	TArray<FGameplayEffectSpecHandle, TInlineAllocator<2>> Specs;
+
+	FGameplayEffectSpecHandle DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
+	if (DamageSpecHandle.IsValid())
+	{
+		Specs.Add(DamageSpecHandle);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGA_SkillBase::ApplySkillEffectsToOverlaps: Failed to create damage spec"));
+	}
+
+	if (ExtraEffect)
+	{
+		FGameplayEffectContextHandle ExtraContext = SourceASC->MakeEffectContext();
+		ExtraContext.AddSourceObject(GetAvatarActorFromActorInfo());
+
+		FGameplayEffectSpecHandle ExtraSpecHandle = SourceASC->MakeOutgoingSpec(ExtraEffect, GetAbilityLevel(), ExtraContext);
+		if (ExtraSpecHandle.IsValid())
+		{
+			Specs.Add(ExtraSpecHandle);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("UGA_SkillBase::ApplySkillEffectsToOverlaps: Failed to create spec for %s"), *ExtraEffect->GetName());
+		}
+	}
+
+	// 2. 대상 전체에 한 번에 적용
+	// 블록 셀을 미리 구했다면 오버랩의 블록은 건너뛰고, 그 셀에만 피해를 전달
+	const float BlockDamage = GetRuneModifiedBlockDamage();
+	int32 NumBlockCells = 0;
+	const int32 NumQueued = ApplySpecsToOverlaps(SourceASC, Overlaps, Specs, BlockCells ? 0.0f : BlockDamage, &NumBlockCells);
+
+	if (BlockCells && BlockCells->Num() > 0 && BlockDamage > 0.0f)
+	{
+		if (UBlockGridSubsystem* Grid = GetWorld()->GetSubsystem<UBlockGridSubsystem>())
+		{
+			Grid->ApplyCellDamage(*BlockCells, BlockDamage);
+			NumBlockCells = BlockCells->Num();
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGA_SkillBase::ApplySkillEffectsToOverlaps: BlockGridSubsystem is null"));
+		}
+	}
+
+	FSkillTrace::OutputTargetsHit(CurrentSpecHandle, NumQueued, NumBlockCells);
+	return NumQueued;
+}
+
+int32 UGA_SkillBase::ApplySpecsToOverlaps(
+	UAbilitySystemComponent* SourceASC,
+	const TArray<FOverlapResult>& Overlaps,
+	TConstArrayView<FGameplayEffectSpecHandle> Specs,
+	float BlockDamage,
+	int32* OutNumBlockCells)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SkillApplyEffects);
+
+	if (OutNumBlockCells)
+	{
+		*OutNumBlockCells = 0;
+	}
+
+	if (!SourceASC || Overlaps.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 큐가 없는 월드(에디터 프리뷰, 자동화 테스트 등)에서는 바로 적용하고, 대상 중복은 여기서 거름
+	UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(SourceASC);
+	TSet<UAbilitySystemComponent*> DirectTargets;
+
+	// 1. 오버랩 결과를 ASC 대상과 블록 셀로 분류
+	// 한 액터의 여러 컴포넌트가 겹치거나 여러 액터가 같은 ASC를 공유해도 큐가 한 번만 적용
+	TArray<FIntVector> BlockCells;
+	int32 NumQueued = 0;
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* HitActor = Overlap.GetActor();
+		if (!HitActor)
+		{
+			continue;
+		}
+
+		// 블록은 GE 대신 그리드 셀 체력으로 처리 (셀 중복은 그리드가 제거)
+		if (const ABlockBase* HitBlock = Cast<ABlockBase>(HitActor))
+		{
+			if (BlockDamage > 0.0f && HitBlock->IsRegisteredInGrid())
+			{
+				BlockCells.Add(HitBlock->GetGridCell());
+			}
+			continue;
+		}
+
+		// ASC를 가진 액터만 GE 적용 가능
+		IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(HitActor);
+		UAbilitySystemComponent* TargetASC = ASI ? ASI->GetAbilitySystemComponent() : nullptr;
+		if (!TargetASC)
+		{
+			continue;
+		}
+
+		if (!EffectQueue)
+		{
+			bool bAlreadyApplied = false;
+			DirectTargets.Add(TargetASC, &bAlreadyApplied);
+			if (bAlreadyApplied)
+			{
+				continue;
+			}
+
+			for (const FGameplayEffectSpecHandle& Spec : Specs)
+			{
+				if (Spec.IsValid())
+				{
+					SourceASC->ApplyGameplayEffectSpecToTarget(*Spec.Data.Get(), TargetASC);
+					++NumQueued;
+				}
+			}
+			continue;
+		}
+
+		// 2. 같은 스펙을 모든 대상에 제출 (ASC가 적용 시점에 스펙을 복사하므로 재사용 가능)
+		for (const FGameplayEffectSpecHandle& Spec : Specs)
+		{
+			if (EffectQueue->QueueEffect(SourceASC, TargetASC, Spec))
+			{
+				++NumQueued;
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_SkillQueuedEffects, NumQueued);
+	if (OutNumBlockCells)
+	{
+		*OutNumBlockCells = BlockCells.Num();
+	}
+
+	// 3. 블록 셀은 그리드에 한 번에 전달
+	if (BlockCells.Num() > 0)
+	{
+		UWorld* World = SourceASC->GetWorld();
+		if (UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr)
+		{
+			Grid->ApplyCellDamage(BlockCells, BlockDamage);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGA_SkillBase::ApplySpecsToOverlaps: BlockGridSubsystem is null"));
+		}
+	}
+
+	return NumQueued;
+}
+
+void UGA_SkillBase::StartPreview()
+{
+	// 프리뷰는 화면과 커서가 있는 로컬 시전자에게만 의미가 있음
+	if (!IsLocallyControlled())
+	{
+		return;
+	}
+
+	StopPreview();
+
+	PreviewTask = UAbilityTask_SkillPreview::CreateSkillPreviewTask(this);
+	if (!PreviewTask)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGA_SkillBase::StartPreview: Failed to create preview task"));
+		return;
+	}
+
+	bPreviewDirty = true;
+	PreviewTask->ReadyForActivation();
+}
+
+void UGA_SkillBase::StopPreview()
+{
+	if (PreviewTask)
+	{
+		PreviewTask->EndTask();
+		PreviewTask = nullptr;
+	}
+
+	PreviewCursorHit = FHitResult();
+	LastPreviewMousePosition = FVector2D(-1.0f, -1.0f);
+	bPreviewDirty = true;
+}
+
+FBox UGA_SkillBase::GetPreviewBounds() const
+{
+	const AActor* Avatar = GetAvatarActorFromActorInfo();
+	if (!Avatar)
+	{
+		return FBox(ForceInit);
+	}
+
+	// 실행과 같은 범위를 보도록 룬 범위 배율 적용 (UGA_Destruction::GetPreviewBounds와 같은 방식)
+	const float RangeMultiplier = (BaseRange > 0.0f) ? GetRuneModifiedRange() / BaseRange : 1.0f;
+
+	// 범위 경계의 블록 위에 프리뷰가 놓일 수 있으므로 한 칸 여유
+	const float Margin = 100.0f;
+	const FVector Extent(RangeXY * RangeMultiplier + Margin, RangeXY * RangeMultiplier + Margin, RangeZ * RangeMultiplier + Margin * 2.0f);
+	return FBox::BuildAABB(Avatar->GetActorLocation(), Extent);
+}
+
+const FCursorTargetData* UGA_SkillBase::GetCursorTarget() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	APlayerController* PC = OwnerPawn ? Cast<APlayerController>(OwnerPawn->GetController()) : nullptr;
+
+	UCursorTargetingComponent* Targeting = UCursorTargetingComponent::FindOrAdd(PC);
+	if (!Targeting)
+	{
+		return nullptr;
+	}
+	return &Targeting->GetCursorTarget();
+}
+
+bool UGA_SkillBase::BindLeftClick(FSimpleDelegate Callback, FSimpleDelegate ReleasedCallback)
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	APlayerController* PC = OwnerPawn ? Cast<APlayerController>(OwnerPawn->GetController()) : nullptr;
+
+	UInputBindingRegistryComponent* Registry = UInputBindingRegistryComponent::FindOrAdd(PC);
+	if (!Registry)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: Local PlayerController is null, cannot bind left click"), *GetName());
+		return false;
+	}
+
+	// 기존 바인딩은 이동 대입 시 해제됨
+	LeftClickBinding = Registry->PushKeyBinding(EKeys::LeftMouseButton, MoveTemp(Callback), MoveTemp(ReleasedCallback));
+	return LeftClickBinding.IsValid();
+}
+
+void UGA_SkillBase::TickPreview()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SkillPreview);
+
+	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
+	APlayerController* PC = OwnerPawn ? Cast<APlayerController>(OwnerPawn->GetController()) : nullptr;
+	UWorld* World = GetWorld();
+	if (!PC || !World)
+	{
+		return;
+	}
+
+	UBlockGridSubsystem* Grid = World->GetSubsystem<UBlockGridSubsystem>();
+
+	// 1. 범위 안 블록 편집 번호
+	const uint32 GridEditStamp = Grid ? Grid->GetEditStampInBox(GetPreviewBounds()) : 0;
+
+	// 2. 커서 트레이스는 마우스, 카메라, 범위 내 블록, 커서 아래 액터 중 하나라도 바뀌었을 때만 수행
+	FVector2D MousePosition(-1.0f, -1.0f);
+	PC->GetMousePosition(MousePosition.X, MousePosition.Y);
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	// 커서 아래 액터가 움직였다면 (낙하 중인 블록, 이동하는 적 등) 지난 히트 위치는 더 이상 유효하지 않음
+	const AActor* LastHitActor = PreviewCursorHit.GetActor();
+	const bool bHitActorMoved = LastHitActor && !LastHitActor->GetActorTransform().Equals(LastPreviewHitActorTransform);
+
+	if (bPreviewDirty
+		|| MousePosition != LastPreviewMousePosition
+		|| !ViewLocation.Equals(LastPreviewViewLocation)
+		|| !ViewRotation.Equals(LastPreviewViewRotation)
+		|| bHitActorMoved
+		|| GridEditStamp != LastPreviewKey.GridEditStamp)
+	{
+		LastPreviewMousePosition = MousePosition;
+		LastPreviewViewLocation = ViewLocation;
+		LastPreviewViewRotation = ViewRotation;
+
+		// 트레이스는 타겟팅 컴포넌트가 프레임당 한 번만 수행
+		const FCursorTargetData* CursorTarget = GetCursorTarget();
+		PreviewCursorHit = CursorTarget ? CursorTarget->HitResult : FHitResult();
+		PreviewCursorCell = CursorTarget ? CursorTarget->Cell : FIntVector::ZeroValue;
+
+		const AActor* HitActor = PreviewCursorHit.GetActor();
+		LastPreviewHitActorTransform = HitActor ? HitActor->GetActorTransform() : FTransform::Identity;
+	}
+
+	// 3. 프리뷰 키 구성
+	FSkillPreviewKey Key;
+	Key.bCursorHit = PreviewCursorHit.bBlockingHit;
+	if (Key.bCursorHit)
+	{
+		Key.CursorCell = PreviewCursorCell;
+	}
+	Key.AvatarCell = Grid ? Grid->WorldToCell(OwnerPawn->GetActorLocation()) : FIntVector(OwnerPawn->GetActorLocation() / 100.0f);
+	Key.RangeMultiplier = GetRuneModifiedRange();
+	Key.GridEditStamp = GridEditStamp;
+	Key.Extra = GetPreviewKeyExtra();
+
+	// 4. 입력이 그대로면 지난 결과를 재사용
+	if (!bPreviewDirty && Key == LastPreviewKey)
+	{
+		return;
+	}
+
+	LastPreviewKey = Key;
+	bPreviewDirty = false;
+
+	INC_DWORD_STAT(STAT_SkillPreviewUpdates);
+	UpdatePreview();
+}
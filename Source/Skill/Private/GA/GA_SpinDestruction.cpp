@@ -1,6 +1,7 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "GA/GA_SpinDestruction.h"
+#include "Data/SkillDataStructs.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayEffect.h"
@@ -10,9 +11,29 @@
 #include "CollisionQueryParams.h"
 #include "TimerManager.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
+#include "Components/SphereComponent.h"
+#include "HAL/IConsoleManager.h"
+
+// 회전 범위 디버그 드로우 (기본 꺼짐)
+static TAutoConsoleVariable<bool> CVarSpinDestructionDebugDraw(
+	TEXT("Skill.SpinDestruction.DebugDraw"),
+	false,
+	TEXT("회전 파괴 스킬의 범위를 디버그 구로 표시합니다."),
+	ECVF_Cheat);
 
 UGA_SpinDestruction::UGA_SpinDestruction() {}
 
+void UGA_SpinDestruction::ApplySkillData(const FSkillDataRow& Data)
+{
+	Super::ApplySkillData(Data);
+
+	// 0 이하는 테이블에서 지정하지 않은 값이므로 클래스 기본값 사용
+	const UGA_SpinDestruction* Defaults = GetClass()->GetDefaultObject<UGA_SpinDestruction>();
+	SpinDuration = (Data.SpinDuration > 0.0f) ? Data.SpinDuration : Defaults->SpinDuration;
+	SpinRadius = (Data.SpinRadius > 0.0f) ? Data.SpinRadius : Defaults->SpinRadius;
+	DamageTickInterval = (Data.DamageTickInterval > 0.0f) ? Data.DamageTickInterval : Defaults->DamageTickInterval;
+}
+
 void UGA_SpinDestruction::ActivateAbility(
 	const FGameplayAbilitySpecHandle Handle,
 	const FGameplayAbilityActorInfo* ActorInfo,
@@ -40,6 +61,9 @@ void UGA_SpinDestruction::EndAbility(
 		World->GetTimerManager().ClearTimer(DebugDrawTimerHandle);
 	}
 
+	// 범위 판정 구 비활성화 (컴포넌트는 다음 회전을 위해 남겨둠)
+	DisableSpinSphere();
+
 	// 타이머 핸들 무효화
 	SpinDurationTimerHandle.Invalidate();
 	DamageTickTimerHandle.Invalidate();
@@ -90,6 +114,13 @@ void UGA_SpinDestruction::StartSpin()
 	UE_LOG(LogTemp, Warning, TEXT("[GA_SpinDestruction] Setting up timers: Duration=%.1fs, TickInterval=%.2fs, Radius=%.1f"), 
 		SpinDuration, DamageTickInterval, SpinRadius);
 
+	// 범위 판정 구 활성화 (켜는 순간 이미 겹쳐 있던 대상도 시작 이벤트로 들어옴)
+	if (!EnableSpinSphere(GetAdjustedSpinRadius()))
+	{
+		EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, true);
+		return;
+	}
+
 	// 데미지 적용 주기적 호출 (0.5초마다)
 	World->GetTimerManager().SetTimer(
 		DamageTickTimerHandle,
@@ -100,14 +131,17 @@ void UGA_SpinDestruction::StartSpin()
 		0.0f // 즉시 시작
 	);
 
-	// 디버그 드로우 업데이트 (매 프레임)
-	World->GetTimerManager().SetTimer(
-		DebugDrawTimerHandle,
-		this,
-		&UGA_SpinDestruction::UpdateDebugDraw,
-		0.016f,
-		true
-	);
+	// 디버그 드로우 업데이트 (Skill.SpinDestruction.DebugDraw가 켜져 있을 때만)
+	if (CVarSpinDestructionDebugDraw.GetValueOnGameThread())
+	{
+		World->GetTimerManager().SetTimer(
+			DebugDrawTimerHandle,
+			this,
+			&UGA_SpinDestruction::UpdateDebugDraw,
+			0.016f,
+			true
+		);
+	}
 
 	// 지속 시간 후 자동 종료
 	World->GetTimerManager().SetTimer(
@@ -130,84 +164,34 @@ void UGA_SpinDestruction::StopSpin()
 
 void UGA_SpinDestruction::ApplySpinDamage()
 {
-	AActor* AvatarActor = GetAvatarActorFromActorInfo();
-	if (!AvatarActor)
+	if (SpinOverlaps.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GA_SpinDestruction: AvatarActor is null"));
 		return;
 	}
 
-	// 플레이어 위치 기준으로 원형 범위 계산
-	FVector OwnerLocation = AvatarActor->GetActorLocation();
-
-	// 룬 적용된 반지름 계산
-	float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
-	float AdjustedRadius = SpinRadius * RangeMultiplier;
-
-	// 충돌 검사 파라미터
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(AvatarActor);
-
+	// 오버랩 집합을 결과 배열로 변환 (파괴된 컴포넌트는 정리)
 	TArray<FOverlapResult> OverlapResults;
+	OverlapResults.Reserve(SpinOverlaps.Num());
 
-	// 구형 범위로 충돌 검사
-	bool bHit = GetWorld()->OverlapMultiByChannel(
-		OverlapResults,
-		OwnerLocation,
-		FQuat::Identity,
-		ECC_Pawn,
-		FCollisionShape::MakeSphere(AdjustedRadius),
-		QueryParams
-	);
-
-	if (bHit)
+	for (auto It = SpinOverlaps.CreateIterator(); It; ++It)
 	{
-		for (const FOverlapResult& Overlap : OverlapResults)
+		UPrimitiveComponent* Component = It->Get();
+		AActor* OwnerActor = Component ? Component->GetOwner() : nullptr;
+		if (!OwnerActor)
 		{
-			AActor* HitActor = Overlap.GetActor();
-			if (!HitActor) continue;
-
-			// ASC 확인
-			UAbilitySystemComponent* TargetASC = nullptr;
-			if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(HitActor))
-			{
-				TargetASC = ASI->GetAbilitySystemComponent();
-			}
-
-			if (TargetASC)
-			{
-				// 데미지 Effect 적용
-				FGameplayEffectSpecHandle DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
-				if (DamageSpecHandle.IsValid())
-				{
-					GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(
-						*DamageSpecHandle.Data.Get(),
-						TargetASC
-					);
-				}
-
-				// 파괴 Effect 적용
-				if (DestructionEffect)
-				{
-					FGameplayEffectContextHandle DestructionContext = GetAbilitySystemComponentFromActorInfo()->MakeEffectContext();
-					DestructionContext.AddSourceObject(AvatarActor);
-
-					FGameplayEffectSpecHandle DestructionSpecHandle = GetAbilitySystemComponentFromActorInfo()->MakeOutgoingSpec(
-						DestructionEffect,
-						GetAbilityLevel(),
-						DestructionContext
-					);
-
-					if (DestructionSpecHandle.IsValid())
-					{
-						GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(
-							*DestructionSpecHandle.Data.Get(),
-							TargetASC
-						);
-					}
-				}
-			}
+			It.RemoveCurrent();
+			continue;
 		}
+
+		FOverlapResult& Result = OverlapResults.AddDefaulted_GetRef();
+		Result.OverlapObjectHandle = FActorInstanceHandle(OwnerActor);
+		Result.Component = Component;
+	}
+
+	// 데미지/파괴 스펙을 발동당 한 번씩만 만들어 중복 없는 대상에 적용하고, 블록은 그리드 피해로 전달
+	if (OverlapResults.Num() > 0)
+	{
+		ApplySkillEffectsToOverlaps(OverlapResults, DestructionEffect);
 	}
 }
 
@@ -222,9 +206,8 @@ void UGA_SpinDestruction::UpdateDebugDraw()
 	// 플레이어 위치 기준
 	FVector OwnerLocation = AvatarActor->GetActorLocation();
 
-	// 룬 적용된 반지름 계산
-	float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
-	float AdjustedRadius = SpinRadius * RangeMultiplier;
+	// 룬 적용된 반지름
+	float AdjustedRadius = GetAdjustedSpinRadius();
 
 	// 디버그 원형 그리기 (초록색)
 	DrawDebugSphere(
@@ -246,3 +229,78 @@ void UGA_SpinDestruction::OnSkillKeyPressed(float TimeWaited)
 	StopSpin();
 }
 
+float UGA_SpinDestruction::GetAdjustedSpinRadius() const
+{
+	// 룬 적용된 반지름 계산
+	float RangeMultiplier = GetRuneModifiedRange() / BaseRange;
+	return SpinRadius * RangeMultiplier;
+}
+
+bool UGA_SpinDestruction::EnableSpinSphere(float Radius)
+{
+	AActor* AvatarActor = GetAvatarActorFromActorInfo();
+	if (!AvatarActor || !AvatarActor->GetRootComponent())
+	{
+		UE_LOG(LogTemp, Error, TEXT("GA_SpinDestruction: AvatarActor or its root is null"));
+		return false;
+	}
+
+	// 1. 아바타가 바뀌었거나 처음이면 구 컴포넌트 생성
+	if (!IsValid(SpinSphere) || SpinSphere->GetOwner() != AvatarActor)
+	{
+		// 이전 아바타에 붙어 있던 구는 제거
+		if (IsValid(SpinSphere))
+		{
+			SpinSphere->DestroyComponent();
+		}
+
+		// 같은 아바타에 같은 이름의 컴포넌트가 남아 있을 수 있으므로 (다른 인스턴스, 파괴 대기 중인 이전 구) 고유 이름 사용
+		const FName SphereName = MakeUniqueObjectName(AvatarActor, USphereComponent::StaticClass(), TEXT("SpinDestructionSphere"));
+		SpinSphere = NewObject<USphereComponent>(AvatarActor, SphereName);
+		SpinSphere->SetupAttachment(AvatarActor->GetRootComponent());
+		SpinSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+		// 기존 ECC_Pawn 쿼리와 같은 대상(블록, 폰)만 겹치도록 설정
+		SpinSphere->SetCollisionObjectType(ECC_WorldDynamic);
+		SpinSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+		SpinSphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Overlap);
+		SpinSphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
+		SpinSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+		SpinSphere->SetGenerateOverlapEvents(true);
+		SpinSphere->SetCanEverAffectNavigation(false);
+
+		SpinSphere->OnComponentBeginOverlap.AddDynamic(this, &UGA_SpinDestruction::OnSpinSphereBeginOverlap);
+		SpinSphere->OnComponentEndOverlap.AddDynamic(this, &UGA_SpinDestruction::OnSpinSphereEndOverlap);
+		SpinSphere->RegisterComponent();
+	}
+
+	// 2. 룬이 반영된 반지름을 적용하고 충돌을 켬
+	SpinOverlaps.Reset();
+	SpinSphere->SetSphereRadius(Radius, false);
+	SpinSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	return true;
+}
+
+void UGA_SpinDestruction::DisableSpinSphere()
+{
+	if (IsValid(SpinSphere))
+	{
+		SpinSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+	SpinOverlaps.Reset();
+}
+
+void UGA_SpinDestruction::OnSpinSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// 시전자 자신은 제외
+	if (!OtherComp || OtherActor == GetAvatarActorFromActorInfo())
+	{
+		return;
+	}
+	SpinOverlaps.Add(OtherComp);
+}
+
+void UGA_SpinDestruction::OnSpinSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	SpinOverlaps.Remove(OtherComp);
+}
@@ -3,6 +3,7 @@
 
 #include "GA/GA_StickyBomb.h"
 #include "Object/Explosive.h"
+#include "Object/ExplosivePoolSubsystem.h"
 #include "Block/BlockBase.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
 #include "GameFramework/PlayerController.h"
@@ -18,6 +19,19 @@ UGA_StickyBomb::UGA_StickyBomb()
 {
 }
 
+void UGA_StickyBomb::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnAvatarSet(ActorInfo, Spec);
+
+	// 첫 투척 때 SpawnActor 비용이 들지 않도록 폭발물을 미리 생성
+	UWorld* World = GetWorld();
+	UExplosivePoolSubsystem* Pool = World ? World->GetSubsystem<UExplosivePoolSubsystem>() : nullptr;
+	if (Pool && ExplosiveClass)
+	{
+		Pool->Prewarm(ExplosiveClass, MaxBombCount);
+	}
+}
+
 void UGA_StickyBomb::ActivateAbility(
 	const FGameplayAbilitySpecHandle Handle,
 	const FGameplayAbilityActorInfo* ActorInfo,
@@ -26,15 +40,15 @@ void UGA_StickyBomb::ActivateAbility(
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	// ȿ (̹ ų ı) ź ã 迭 
-	// RemoveAll: ȣ   ϴ  Ҹ TArray 
-	// : TWeakObjectPtr Ű ü ȿ  
-	ExplosivesList.RemoveAll([](const TWeakObjectPtr<AExplosive>& Ptr) { return !Ptr.IsValid(); });
+	// 유효하지 않은(이미 터지거나 파괴된) 폭탄만 찾아 배열에서 정리
+	// RemoveAll: 괄호 안의 조건을 만족하는 모든 요소를 TArray에서 제거
+	// 조건: TWeakObjectPtr가 가리키는 객체가 유효하지 않거나, 이미 폭발해 풀에 반납된 경우
+	ExplosivesList.RemoveAll([](const TWeakObjectPtr<AExplosive>& Ptr) { return !Ptr.IsValid() || !Ptr->IsInUse(); });
 
-	// ź 3 𿴰ų, ̹ 3   ¶  õ
+	// 폭탄이 3개 모였거나, 이미 3개를 다 던졌던 상태라면 기폭 시도
 	if (ExplosivesList.Num() >= MaxBombCount || bIsDetonationReady)
 	{
-		//  ź ߴ ˻
+		// 모든 폭탄이 착지했는지 검사
 		bool bAllLanded = true;
 		for (const TWeakObjectPtr<AExplosive>& WeakExplosive : ExplosivesList)
 		{
@@ -58,15 +72,12 @@ void UGA_StickyBomb::ActivateAbility(
 		return;
 	}
 
-	//  3  Ǿٸ 'ô' ( ) 
+	// 아직 3개가 안 되었다면 '투척' 모드(조준 프리뷰) 진입
 
-	//  Ÿ̸ 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(TickTimerHandle, this, &UGA_StickyBomb::UpdatePreview, 0.016f, true);
-	}
+	// 프리뷰 시작 (커서 셀, 플레이어 셀, 범위 내 블록이 바뀔 때만 UpdatePreview 호출)
+	StartPreview();
 
-	//  Է  (ų Է½  )
+	// 취소 입력 대기 (스킬 재입력시 조준 취소)
 	InputTask = UAbilityTask_WaitInputPress::WaitInputPress(this);
 	if (InputTask)
 	{
@@ -77,19 +88,8 @@ void UGA_StickyBomb::ActivateAbility(
 		UE_LOG(LogTemp, Error, TEXT("GA_StickyBomb: Failed to create WaitInputTask for targeting"));
 	}
 
-	// Ŭ ε (ô Ȯ)
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			PC->InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &UGA_StickyBomb::OnLeftClickPressed);
-		}
-		else {
-			UE_LOG(LogTemp, Error, TEXT("GA_StickyBomb: PlayerController or InputComponent is null"));
-		}
-	}
+	// 좌클릭 바인딩 (투척 확정)
+	BindLeftClick(FSimpleDelegate::CreateUObject(this, &UGA_StickyBomb::OnLeftClickPressed));
 }
 
 void UGA_StickyBomb::EndAbility(
@@ -99,41 +99,23 @@ void UGA_StickyBomb::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
-	// Ÿ̸ 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
-	TickTimerHandle.Invalidate();
+	// 프리뷰 정리
+	StopPreview();
 
-	// ̶Ʈ 
+	// 하이라이트 정리
 	ClearHighlights();
 
-	// ½ũ 
+	// 태스크 정리
 	if (InputTask)
 	{
 		InputTask->EndTask();
 		InputTask = nullptr;
 	}
 
-	// Է ε 
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-	}
+	// 입력 바인딩 해제
+	UnbindLeftClick();
 
-	// ߹  Ѱ ̹Ƿ ص 
+	// 폭발물에게 정보를 넘겨줄 것이므로 리셋해도 됨
 	SavedTargetBlock.Reset();
 
 	NotifySkillCastFinished();
@@ -149,27 +131,26 @@ void UGA_StickyBomb::UpdatePreview()
 	APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
 	if (!PC) return;
 
-	// 1.   ̶Ʈ(Ķ/ʷϻ) ʱȭ
-	//    -> ź () ǵ帮  (SetHighlightState CPD 0 ϹǷ )
+	// 1. 이전 하이라이트(파란색/초록색) 초기화
+	//    -> 폭탄 색(빨강)은 건드리지 않음 (SetHighlightState는 CPD 0만 수정하므로 안전)
 	ClearHighlights();
 
-	// 2. Ÿ   Ž
+	// 2. 사거리 내 블록 탐색
 	TArray<ABlockBase*> BlocksInRange;
 	FindBlocksInRange(BlocksInRange);
 
-	// 3. Ž ϵ鿡 ϰ 'Preview(Ķ)'  
+	// 3. 탐색된 블록들에 일괄적으로 'Preview(파랑)' 상태 적용
 	BatchHighlightBlocks(BlocksInRange, EBlockHighlightState::Preview);
 
-	// 4. ߿    
+	// 4. 나중에 끄기 위해 목록 백업
 	PreviewedBlocks = BlocksInRange;
 
 
-	// 5. 콺 Ŀ ġ  Ÿ ó
-	FHitResult HitResult;
-	PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+	// 5. 마우스 커서 위치의 블록 타겟팅 처리 (프리뷰 프레임워크가 트레이스한 결과 사용)
+	const FHitResult& HitResult = GetPreviewCursorHit();
 	ABlockBase* HitBlock = Cast<ABlockBase>(HitResult.GetActor());
 
-	// 콺   Ÿ(Ķ ) ȿ ԵǾ ִٸ 'Targeted(ʷ)' 
+	// 마우스 밑의 블록이 사거리(파란 영역) 안에 포함되어 있다면 'Targeted(초록)'으로 덮어쓰기
 	if (HitBlock && PreviewedBlocks.Contains(HitBlock))
 	{
 		HitBlock->SetHighlightState(EBlockHighlightState::Targeted);
@@ -183,26 +164,26 @@ void UGA_StickyBomb::UpdatePreview()
 
 void UGA_StickyBomb::OnLeftClickPressed()
 {
-	// ̶Ʈ  ȿ  
+	// 하이라이트된 블록이 유효할 때만 시전
 	if (HighlightedBlock.IsValid())
 	{
-		// ų   (Busy ±  )
+		// 스킬 시전 시작 (Busy 태그 등 적용)
 		NotifySkillCastStarted();
 
-		// ߹ ô  ų 
+		// 폭발물 투척 및 스킬 종료
 		SpawnExplosive();
 	}
 }
 
 void UGA_StickyBomb::OnCancelPressed(float TimeWaited)
 {
-	//    
+	// 조준 취소 및 종료
 	CancelAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 }
 
 void UGA_StickyBomb::SpawnExplosive()
 {
-	// ô  Ÿ  
+	// 투척 시점에는 쿨타임이 적용되지 않음
 	if (!CommitAbilityCost(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo()))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GA_StickyBomb: Failed to commit ability"));
@@ -217,57 +198,48 @@ void UGA_StickyBomb::SpawnExplosive()
 		return;
 	}
 
-	//  ǥ  ٲ Ƿ SavedTargetBlock  
+	// 이제 목표 블록이 바뀌지 않으므로 SavedTargetBlock에 고정 백업
 	SavedTargetBlock = HighlightedBlock.Get();
 
-	//  : ߹ ư ȿ   
-	// Ÿ̸Ӹ  ̶Ʈ 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(TickTimerHandle);
-	}
-	ClearHighlights(); // ̶ HighlightedBlock null ,  SavedTargetBlock ص
+	// 프리뷰 종료: 폭발물이 날아가는 동안엔 빨간색이 꺼져야 함
+	// 프리뷰를 끄고 하이라이트를 제거
+	StopPreview();
+	ClearHighlights(); // 이때 HighlightedBlock은 null이 되지만, 위에서 SavedTargetBlock에 백업해둠
 
-	// Ŭ ε  ( ̻ ô Ұ)
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// Ű ε    ü  ε(Ŭ) 
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this &&
-					PC->InputComponent->KeyBindings[i].Chord.Key == EKeys::LeftMouseButton)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-	}
+	// 좌클릭 바인딩 해제 (더 이상 투척 불가)
+	UnbindLeftClick();
 
-	// 3.  ҿ Է ½ũ 
+	// 3. 조준 취소용 입력 태스크 종료
 	if (InputTask)
 	{
 		InputTask->EndTask();
 		InputTask = nullptr;
 	}
 
-	// 4. ߹ 
+	// 4. 폭발물 생성
+	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
 	FVector SpawnLoc = OwnerPawn->GetActorLocation();
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AExplosive* NewExplosive = GetWorld()->SpawnActor<AExplosive>(ExplosiveClass, SpawnLoc, FRotator::ZeroRotator, SpawnParams);
+	UExplosivePoolSubsystem* Pool = GetWorld()->GetSubsystem<UExplosivePoolSubsystem>();
+	AExplosive* NewExplosive = nullptr;
+	if (Pool)
+	{
+		NewExplosive = Pool->AcquireExplosive(ExplosiveClass, SpawnLoc);
+	}
+	else
+	{
+		// 풀이 없는 월드에서는 직접 생성 (반납 시 ReleaseToPool이 Destroy로 처리)
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		NewExplosive = GetWorld()->SpawnActor<AExplosive>(ExplosiveClass, SpawnLoc, FRotator::ZeroRotator, SpawnParams);
+	}
 
 	if (NewExplosive && SavedTargetBlock.IsValid())
 	{
-		// ߹ Ʈ ߰
+		// 폭발물 리스트에 추가
 		ExplosivesList.Add(NewExplosive);
 
-		// ź 3 Ǿٸ ' غ Ϸ' · ȯ
-		//  ź ϳ  2 Ǿ  ÷״ true̹Ƿ  
+		// 폭탄이 3개가 되었다면 '기폭 준비 완료' 상태로 전환
+		// 이후 폭탄 하나가 터져서 2개가 되어도 이 플래그는 true이므로 기폭 가능
 		if (ExplosivesList.Num() >= 3)
 		{
 			bIsDetonationReady = true;
@@ -275,10 +247,10 @@ void UGA_StickyBomb::SpawnExplosive()
 
 		NewExplosive->OnDetonatedDelegate.AddDynamic(this, &UGA_StickyBomb::OnExplosiveDetonated);
 
-		// GA  Ŀ Ͱ    ֵ SpecHandle Ͽ 
+		// GA가 종료된 후에도 액터가 데미지를 줄 수 있도록 SpecHandle을 생성하여 전달
 		FGameplayEffectSpecHandle DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
 
-		// ߹ ʱȭ
+		// 폭발물 초기화
 		NewExplosive->Initialize(
 			SpawnLoc,
 			SavedTargetBlock.Get(),
@@ -288,41 +260,48 @@ void UGA_StickyBomb::SpawnExplosive()
 			MaxBombCount,
 			GetAbilitySystemComponentFromActorInfo(),
 			DamageSpecHandle,
-			DestructionEffect
+			DestructionEffect,
+			GetRuneModifiedBlockDamage()
 		);
 
-		//  Ƿ bWasCancelled = false.
-		//    Ͱ  ϰų, ÷̾ ٽ ų  ó
+		// 성공적으로 던졌으므로 bWasCancelled = false.
+		// 폭발 대기는 이제 액터가 스스로 하거나, 플레이어가 다시 스킬을 눌러 처리
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 	}
 	else {
 		UE_LOG(LogTemp, Error, TEXT("GA_StickyBomb: Failed to spawn bomb or invalid target"));
+
+		// 꺼낸 폭발물은 쓰지 않았으므로 풀에 반납
+		if (Pool && NewExplosive)
+		{
+			Pool->ReleaseExplosive(NewExplosive);
+		}
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 	}
 }
 
 void UGA_StickyBomb::PerformDetonateAndEnd()
 {
-	// ߹ Ʈ  ȸ  
+	// 폭발물 리스트의 안전한 순회를 위한 복사
 	TArray<TWeakObjectPtr<AExplosive>> TempList = ExplosivesList;
 
-	//  Ʈ   (ߺ ó     )
+	// 원본 리스트는 즉시 비움 (중복 처리 방지 및 깔끔한 상태 유지)
 	ExplosivesList.Empty();
 
-	// Ʈ ִ  ȿ ߹ 
+	// 리스트에 있는 모든 유효한 폭발물 기폭
 	bool bAnyDetonated = false;
 
 	for (TWeakObjectPtr<AExplosive>& Explosive : TempList)
 	{
-		if (Explosive.IsValid())
+		if (Explosive.IsValid() && Explosive->IsInUse())
 		{
-			//   ( ߹   )
+			// 폭발 실행 (각 폭발물의 내부 로직 실행)
 			Explosive->Detonate();
 			bAnyDetonated = true;
 		}
 	}
 
-	// ߹  ʱȭ
+	// 폭발물 목록 초기화
 	ExplosivesList.Empty();
 
 	if (!bAnyDetonated)
@@ -330,46 +309,47 @@ void UGA_StickyBomb::PerformDetonateAndEnd()
 		UE_LOG(LogTemp, Warning, TEXT("GA_StickyBomb: Detonate requested but no valid bombs found."));
 	}
 
-	//  Ƿ غ  
+	// 기폭을 수행했으므로 준비 상태 해제
 	bIsDetonationReady = false;
 
-	//   Ÿ  
-	// 3   Ͷ߷Ƿ  Ÿ ƾ 
+	// 기폭 시점에 쿨타임 적용 
+	// 3개를 다 던지고 터뜨렸으므로 이제 쿨타임이 돌아야 함
 	CommitAbilityCooldown(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
-// ̶Ʈ  
+// 하이라이트 제거 로직
 void UGA_StickyBomb::ClearHighlights()
 {
-	//   ϵ ¸ 'None' 
+	// 저장된 프리뷰 블록들의 상태를 'None'으로 복구
 	BatchHighlightBlocks(PreviewedBlocks, EBlockHighlightState::None);
 
-	//  ʱȭ
+	// 목록 초기화
 	PreviewedBlocks.Empty();
 	HighlightedBlock.Reset();
 }
 
 void UGA_StickyBomb::OnExplosiveDetonated()
 {
-	// ߹  RemoveAll  
-	//  Ȳ  OnExplosiveDetonated ȣ  쵵
-	//  OnExplosiveDetonated ȣ  
+	// 폭발물이 터지면 RemoveAll에 의해 삭제됨
+	// 예외 상황으로 인해 OnExplosiveDetonated가 호출되지 않은 경우도
+	// 다음 OnExplosiveDetonated 호출 시점에 정리됨
+	// 폭발물은 풀에 반납되어 포인터가 유효하게 남으므로 사용 중인지도 확인
 	ExplosivesList.RemoveAll([](const TWeakObjectPtr<AExplosive>& Ptr) {
-		return !Ptr.IsValid();
+		return !Ptr.IsValid() || !Ptr->IsInUse();
 		});
 	
-	// ExplosivesList ִٸ  ߹  ̹Ƿ Ÿ 
-	// ( Է ֱ⵵   ߹   )
+	// ExplosivesList가 비어있다면 모든 폭발물이 터진 것이므로 쿨타임 시작
+	// (기폭 입력을 넣기도 전에 모든 폭발물이 사라진 경우 대비)
 	if (ExplosivesList.Num() == 0)
 	{
-		//  ź ǾǷ غ  
+		// 모든 폭탄이 소진되었으므로 준비 상태 해제
 		bIsDetonationReady = false;
 
-		// ų EndAbility  ¿
-		// InstancedPerActor å̶ ü Ƿ
-		// Ÿ Effect   .
+		// 스킬이 EndAbility로 종료된 상태여도
+		// InstancedPerActor 정책이라면 객체는 살아있으므로
+		// 쿨타임 Effect를 적용할 수 있음.
 		CommitAbilityCooldown(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true);
 
 		UE_LOG(LogTemp, Log, TEXT("GA_StickyBomb: All bombs detonated/destroyed. Cooldown started."));
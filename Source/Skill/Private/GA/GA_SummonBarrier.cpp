@@ -2,14 +2,19 @@
 
 
 #include "GA/GA_SummonBarrier.h"
+#include "Data/SkillDataStructs.h"
+#include "SkillStats.h"
 #include "Block/DestructibleBlock.h"
 #include "Block/BlockBase.h"
+#include "Grid/BlockGridSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Engine/OverlapResult.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputPress.h"
+#include "Task/AbilityTask_SkillTick.h"
+#include "Combat/EffectQueueSubsystem.h"
 
 UGA_SummonBarrier::UGA_SummonBarrier()
 {
@@ -33,12 +38,12 @@ void UGA_SummonBarrier::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 
 void UGA_SummonBarrier::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	// 타이머 정리
-	if (UWorld* World = GetWorld())
+	// 돌진 태스크 정리
+	if (ChargeTickTask)
 	{
-		World->GetTimerManager().ClearTimer(ChargeTimerHandle);
+		ChargeTickTask->EndTask();
+		ChargeTickTask = nullptr;
 	}
-	ChargeTimerHandle.Invalidate();
 
 	// 프리뷰 액터 정리
 	for (TObjectPtr<AActor>& PreviewActor : BarrierPreviewBlocks)
@@ -64,23 +69,7 @@ void UGA_SummonBarrier::EndAbility(const FGameplayAbilitySpecHandle Handle, cons
 
 	SpawnedBlocks.Empty();
 
-	// 남은 바인딩 제거
-	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// InputComponent에서 이 객체에 바인딩된 모든 키 바인딩 제거
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-	}
+	// 남은 좌클릭 바인딩은 부모(UGA_SkillBase::EndAbility)에서 핸들로 해제
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
@@ -104,7 +93,7 @@ void UGA_SummonBarrier::UpdatePreview()
 		return;
 	}
 
-	// 1. 이전 프레임의 하이라이트 초기화
+	// 1. 이전 하이라이트 초기화
     ClearHighlights();
 
     // 2. 사거리 내 블록 탐색 (부모 클래스 함수 활용)
@@ -118,8 +107,7 @@ void UGA_SummonBarrier::UpdatePreview()
     PreviewedBlocks = BlocksInRange;
 
     // 5. 마우스 커서 타겟팅 및 방벽 프리뷰 계산
-    FHitResult HitResult;
-    PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+    const FHitResult& HitResult = GetPreviewCursorHit();
 
     bool bValidTargetFound = false;
     TArray<FTransform> TargetTransforms;
@@ -154,6 +142,18 @@ void UGA_SummonBarrier::UpdatePreview()
 	}
 }
 
+void UGA_SummonBarrier::ApplySkillData(const FSkillDataRow& Data)
+{
+	Super::ApplySkillData(Data);
+
+	// 0 이하는 테이블에서 지정하지 않은 값이므로 클래스 기본값 사용
+	const UGA_SummonBarrier* Defaults = GetClass()->GetDefaultObject<UGA_SummonBarrier>();
+	ChargeSpeed = (Data.ChargeSpeed > 0.0f) ? Data.ChargeSpeed : Defaults->ChargeSpeed;
+	MaxChargeDistance = (Data.MaxChargeDistance > 0.0f) ? Data.MaxChargeDistance : Defaults->MaxChargeDistance;
+	BarrierWidth = (Data.BarrierWidth > 0) ? Data.BarrierWidth : Defaults->BarrierWidth;
+	BarrierHeight = (Data.BarrierHeight > 0) ? Data.BarrierHeight : Defaults->BarrierHeight;
+}
+
 void UGA_SummonBarrier::CalculateBarrierTransforms(const FVector& CenterLocation, const FVector& PlayerLocation, TArray<FTransform>& OutTransforms)
 {
 	// Player에서 Center로 향하는 방향 벡터 계산
@@ -178,31 +178,33 @@ void UGA_SummonBarrier::CalculateBarrierTransforms(const FVector& CenterLocation
 	OutTransforms.Empty();
 	/**
 	* [벽 생성 구조 및 오프셋 설명]
-	* 기준점(CenterLocation)을 중심으로 좌우 대칭인 3칸 너비, 2층 높이의 벽을 생성합니다.
-	* Offsets 배열 { 0, -1, 1 }을 사용하여 기준점으로부터의 가로 위치를 결정합니다.
+	* 기준점(CenterLocation)을 중심으로 BarrierWidth칸 너비, BarrierHeight층 높이의 벽을 생성합니다.
+	* 가로 오프셋은 0, -1, 1, -2, 2 ... 순서로 가운데에서 좌우로 번갈아 늘어납니다. (기본 3x2)
 	* 
 	*    [ -1 ] [ 0 ] [ 1 ]   <-- 2층 (UpperPos: BasePos + Z축 높이)
 	*    [ -1 ] [ 0 ] [ 1 ]   <-- 1층 (BasePos: 기준 바닥 위치)
 	*      ↑      ↑      ↑
 	*     Left  Center Right
 	* 
-	* - 0.0f : 중앙 (Center, 마우스가 가리키는 기준점)
-	* - -1.0f: 왼쪽 (Left, RightVector 반대 방향으로 1칸)
-	* - 1.0f : 오른쪽 (Right, RightVector 방향으로 1칸)
+	* - 0 : 중앙 (Center, 마우스가 가리키는 기준점)
+	* - 음수: 왼쪽 (Left, RightVector 반대 방향)
+	* - 양수: 오른쪽 (Right, RightVector 방향)
 	*/
-	float Offsets[] = { 0.0f, -1.0f, 1.0f };
+	const int32 Width = FMath::Max(BarrierWidth, 1);
+	const int32 Height = FMath::Max(BarrierHeight, 1);
+	OutTransforms.Reserve(Width * Height);
 
-	// 첫 순회에서 가운데 블록, 두 번째 순회에서 왼쪽 블록, 세 번째 순회에서 오른쪽 블록 생성
-	for (float OffsetMultiplier : Offsets)
+	// 가운데 블록부터 좌우로 번갈아 가며 한 열씩 생성
+	for (int32 Column = 0; Column < Width; ++Column)
 	{
+		const int32 OffsetMultiplier = ((Column + 1) / 2) * ((Column % 2 == 1) ? -1 : 1);
 		FVector BasePos = CenterLocation + (RightVector * (GridSize * OffsetMultiplier));
 
-		// 1층 추가
-		OutTransforms.Add(FTransform(WallRotation, BasePos));
-
-		// 2층 추가
-		FVector UpperPos = BasePos + FVector(0, 0, GridSize);
-		OutTransforms.Add(FTransform(WallRotation, UpperPos));
+		// 1층부터 위로 쌓음
+		for (int32 Floor = 0; Floor < Height; ++Floor)
+		{
+			OutTransforms.Add(FTransform(WallRotation, BasePos + FVector(0, 0, GridSize * Floor)));
+		}
 	}
 }
 
@@ -311,27 +313,9 @@ void UGA_SummonBarrier::SpawnBlock()
 	if (!World) return;
 
 	// 좌클릭 바인딩'만' 해제
+	UnbindLeftClick();
+
 	APawn* OwnerPawn = Cast<APawn>(GetAvatarActorFromActorInfo());
-	if (OwnerPawn)
-	{
-		APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController());
-		if (PC && PC->InputComponent)
-		{
-			// 좌클릭 바인딩 제거
-			for (int32 i = PC->InputComponent->KeyBindings.Num() - 1; i >= 0; --i)
-			{
-				if (PC->InputComponent->KeyBindings[i].KeyDelegate.GetUObject() == this &&
-					PC->InputComponent->KeyBindings[i].Chord.Key == EKeys::LeftMouseButton)
-				{
-					PC->InputComponent->KeyBindings.RemoveAt(i);
-				}
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("GA_SummonBarrier: PC or InputComponent is null"));
-		}
-	}
 
 	// 1. 블록 생성
 	SpawnedBlocks.Empty();
@@ -345,16 +329,17 @@ void UGA_SummonBarrier::SpawnBlock()
 		FVector SpawnLoc = Preview->GetActorLocation();
 		FRotator SpawnRot = Preview->GetActorRotation();
 
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SCOPE_CYCLE_COUNTER(STAT_SkillSpawn);
+		INC_DWORD_STAT(STAT_SkillSpawnedActors);
 
-		ADestructibleBlock* NewBlock = World->SpawnActor<ADestructibleBlock>(BlockToSpawn, SpawnLoc, SpawnRot, SpawnParams);
+		// 타입을 BeginPlay 전에 정해 그리드에 한 번만 Destructible로 등록되게 함
+		// 방벽 블록은 중력/스냅 로직을 쓰지 않으므로 Tick은 꺼진 채로 둠
+		const FTransform SpawnTransform(SpawnRot, SpawnLoc);
+		ADestructibleBlock* NewBlock = World->SpawnActorDeferred<ADestructibleBlock>(BlockToSpawn, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 		if (NewBlock)
 		{
-			NewBlock->SpawnBlock(SpawnLoc, EBlockType::Destructible);
-
-			// 생성 직후 중력/스냅 로직 끄기
-			NewBlock->SetActorTickEnabled(false);
+			NewBlock->SetInitialBlockType(EBlockType::Destructible);
+			NewBlock->FinishSpawning(SpawnTransform);
 
 			// 방벽을 구성하는 파괴가능블록은 추락 옵션 비활성화
 			NewBlock->SetCanFall(false);
@@ -453,33 +438,37 @@ void UGA_SummonBarrier::StartBarrierCharge(float TimeWaited)
 	bIsCharging = true;
 	CurrentMovedDistance = 0.0f;
 
-	for (int32 i = 0; i < SpawnedBlocks.Num(); ++i)
+	UWorld* World = GetWorld();
+	UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+
+	for (ADestructibleBlock* MyBlock : SpawnedBlocks)
 	{
-		ADestructibleBlock* MyBlock = SpawnedBlocks[i];
 		if (!MyBlock || !IsValid(MyBlock)) continue;
 
 		// 1. Tick 비활성화 (Grid Snap 방지)
 		MyBlock->SetActorTickEnabled(false);
 
-		// 2. 약간 띄우기 (바닥 마찰 방지)
+		// 2. 돌진하는 블록은 셀에 머물지 않으므로 움직이기 전에 그리드에서 제거
+		// 제거된 블록은 다시 등록되지 않으므로 파괴 시 EndPlay의 해제는 아무 일도 하지 않음
+		if (Grid)
+		{
+			Grid->UnregisterBlock(MyBlock);
+		}
+
+		// 3. 약간 띄우기 (바닥 마찰 방지)
 		MyBlock->AddActorWorldOffset(FVector(0, 0, 5.0f), false);
 
-		// 형제 블록 무시 설정
-		// AActor가 아닌 RootComponent(UPrimitiveComponent) 수준에서 설정해야 함
+		// 4. 스윕 채널과 응답은 블록 루트 컴포넌트 설정을 따름 (블록 종류가 같으므로 첫 블록 기준)
 		if (UPrimitiveComponent* RootPrim = Cast<UPrimitiveComponent>(MyBlock->GetRootComponent()))
 		{
-			for (int32 j = 0; j < SpawnedBlocks.Num(); ++j)
-			{
-				if (i == j) continue; // 자기 자신 제외
-				if (SpawnedBlocks[j] && IsValid(SpawnedBlocks[j]))
-				{
-					// 이 컴포넌트가 이동할 때 해당 액터를 무시하도록 설정
-					RootPrim->IgnoreActorWhenMoving(SpawnedBlocks[j], true);
-				}
-			}
+			ChargeSweepChannel = RootPrim->GetCollisionObjectType();
+			ChargeSweepResponse = FCollisionResponseParams(RootPrim->GetCollisionResponseToChannels());
 		}
 	}
 
+	// 형제 블록끼리의 IgnoreActorWhenMoving 설정은 필요 없음
+	// 블록을 개별 스윕으로 움직이지 않고, 스윕 쿼리에서 방벽 블록 전체를 한 번에 무시함
+
 	// 입력 태스크 종료
 	if (WaitInputTask)
 	{
@@ -487,24 +476,73 @@ void UGA_SummonBarrier::StartBarrierCharge(float TimeWaited)
 		WaitInputTask = nullptr;
 	}
 
-	// 타이머 시작
-	if (UWorld* World = GetWorld())
+	// 매 프레임 실제 프레임 시간으로 이동
+	if (ChargeTickTask)
+	{
+		ChargeTickTask->EndTask();
+	}
+	ChargeTickTask = UAbilityTask_SkillTick::CreateSkillTickTask(this);
+	if (ChargeTickTask)
+	{
+		ChargeTickTask->OnTick.AddDynamic(this, &UGA_SummonBarrier::TickBarrierCharge);
+		ChargeTickTask->ReadyForActivation();
+	}
+	else
 	{
-		World->GetTimerManager().SetTimer(ChargeTimerHandle, this, &UGA_SummonBarrier::TickBarrierCharge, 0.016f, true);
+		UE_LOG(LogTemp, Error, TEXT("GA_SummonBarrier: Failed to create ChargeTickTask"));
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 	}
 }
 
-void UGA_SummonBarrier::TickBarrierCharge()
+bool UGA_SummonBarrier::CalculateBarrierBounds(FBox& OutBounds)
 {
-	if (SpawnedBlocks.Num() == 0)
+	OutBounds = FBox(ForceInit);
+
+	// 역순 순회 (삭제 대응)
+	for (int32 i = SpawnedBlocks.Num() - 1; i >= 0; --i)
+	{
+		ADestructibleBlock* Block = SpawnedBlocks[i];
+		if (!Block || !IsValid(Block) || !Block->GetRootComponent())
+		{
+			SpawnedBlocks.RemoveAtSwap(i);
+			continue;
+		}
+
+		// 루트 충돌 박스 기준 (메시 경계는 옆 블록과 맞닿아 있어 스윕 시작부터 겹침)
+		OutBounds += Block->GetRootComponent()->Bounds.GetBox();
+	}
+
+	return SpawnedBlocks.Num() > 0 && OutBounds.IsValid;
+}
+
+void UGA_SummonBarrier::TickBarrierCharge(float DeltaTime)
+{
+	// 프레임 드랍 시에도 속도는 그대로 유지하되, 한 번에 너무 멀리 이동해서 벽을 뚫지 않도록 한 칸 미만 단위로 나누어 이동
+	const float FrameDist = ChargeSpeed * DeltaTime;
+	const float MaxStepDist = FMath::Max(GridSize * 0.5f, 1.0f);
+	const int32 NumSteps = FMath::Max(FMath::CeilToInt(FrameDist / MaxStepDist), 1);
+	const float StepDist = FrameDist / NumSteps;
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		if (!StepBarrierCharge(StepDist))
+		{
+			return;
+		}
+	}
+}
+
+bool UGA_SummonBarrier::StepBarrierCharge(float MoveDist)
+{
+	UWorld* World = GetWorld();
+	FBox GroupBounds;
+	if (!World || !CalculateBarrierBounds(GroupBounds))
 	{
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
-		return;
+		return false;
 	}
 
-	float DeltaTime = 0.016f;
-	float MoveDist = ChargeSpeed * DeltaTime;
-	FVector DeltaMove = ChargeDirection * MoveDist;
+	const FVector DeltaMove = ChargeDirection * MoveDist;
 
 	CurrentMovedDistance += MoveDist;
 
@@ -513,59 +551,108 @@ void UGA_SummonBarrier::TickBarrierCharge()
 	{
 		UE_LOG(LogTemp, Log, TEXT("GA_SummonBarrier: Max distance reached. Destroying wall."));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
-		return;
+		return false;
+	}
+
+	// 1. 방벽 블록 전체와 시전자를 무시하는 쿼리
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BarrierCharge), false);
+	QueryParams.AddIgnoredActor(GetAvatarActorFromActorInfo());
+	for (ADestructibleBlock* Block : SpawnedBlocks)
+	{
+		QueryParams.AddIgnoredActor(Block);
+	}
+
+	// 2. 묶음 경계 박스로 한 번만 스윕
+	FHitResult GroupHit;
+	const bool bGroupHit = World->SweepSingleByChannel(
+		GroupHit,
+		GroupBounds.GetCenter(),
+		GroupBounds.GetCenter() + DeltaMove,
+		FQuat::Identity,
+		ChargeSweepChannel,
+		FCollisionShape::MakeBox(GroupBounds.GetExtent()),
+		QueryParams,
+		ChargeSweepResponse
+	);
+
+	// 3. 접촉이 있을 때만 블록별 판정 (경계 박스가 더 크므로 블록별 충돌을 놓치지 않음)
+	if (bGroupHit)
+	{
+		ResolveBarrierBlockHits(DeltaMove, QueryParams);
+	}
+
+	// 4. 남은 블록을 강체처럼 함께 이동 (충돌 판정은 위에서 끝났으므로 스윕 없이)
+	for (ADestructibleBlock* Block : SpawnedBlocks)
+	{
+		Block->AddActorWorldOffset(DeltaMove, false);
 	}
 
+	if (SpawnedBlocks.Num() == 0)
+	{
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		return false;
+	}
+	return true;
+}
+
+void UGA_SummonBarrier::ResolveBarrierBlockHits(const FVector& DeltaMove, const FCollisionQueryParams& QueryParams)
+{
+	UWorld* World = GetWorld();
+	UAbilitySystemComponent* SourceASC = GetAbilitySystemComponentFromActorInfo();
+	UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(World);
+
+	// 이번 프레임 데미지 스펙 (필요할 때 한 번만 생성)
+	FGameplayEffectSpecHandle DamageSpecHandle;
+
 	// 역순 순회 (삭제 대응)
 	for (int32 i = SpawnedBlocks.Num() - 1; i >= 0; --i)
 	{
 		ADestructibleBlock* Block = SpawnedBlocks[i];
 
-		if (!Block || !IsValid(Block))
+		const FBox BlockBounds = Block->GetRootComponent()->Bounds.GetBox();
+		FHitResult HitResult;
+		const bool bHit = World->SweepSingleByChannel(
+			HitResult,
+			BlockBounds.GetCenter(),
+			BlockBounds.GetCenter() + DeltaMove,
+			FQuat::Identity,
+			ChargeSweepChannel,
+			FCollisionShape::MakeBox(BlockBounds.GetExtent()),
+			QueryParams,
+			ChargeSweepResponse
+		);
+
+		if (!bHit)
 		{
-			SpawnedBlocks.RemoveAt(i);
 			continue;
 		}
 
-		FHitResult HitResult;
-		// Sweep 이동. StartBarrierCharge에서 서로 Ignore 설정을 했으므로
-		// 이제 옆 블록에 막히지 않고 전진함
-		Block->AddActorWorldOffset(DeltaMove, true, &HitResult);
-
-		if (HitResult.bBlockingHit)
+		// 방벽 블록과 시전자는 쿼리에서 무시되므로 여기서 따로 거를 필요 없음
+		AActor* HitActor = HitResult.GetActor();
+		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(HitActor);
+		if (TargetASC && SourceASC)
 		{
-			AActor* HitActor = HitResult.GetActor();
-
-			// 부딪힌 액터가 자기 자신이거나 동료 방벽 블록이면 무시
-			if (SpawnedBlocks.Contains(HitActor)) continue;
-			if (HitActor == GetAvatarActorFromActorInfo()) continue;
-
-			UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(HitActor);
-			if (TargetASC)
+			// SkillBase의 헬퍼 함수를 사용하여 룬 데미지가 적용된 Spec 생성
+			if (!DamageSpecHandle.IsValid())
 			{
-				// SkillBase의 헬퍼 함수를 사용하여 룬 데미지가 적용된 Spec 생성
-				FGameplayEffectSpecHandle SpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
-
-				if (SpecHandle.IsValid())
-				{
-					// 시전자의 ASC를 통해 타겟 ASC에게 효과 적용
-					GetAbilitySystemComponentFromActorInfo()->ApplyGameplayEffectSpecToTarget(
-						*SpecHandle.Data.Get(),
-						TargetASC
-					);
-				}
+				DamageSpecHandle = MakeRuneDamageEffectSpec(CurrentSpecHandle, CurrentActorInfo);
 			}
 
-			UE_LOG(LogTemp, Log, TEXT("GA_SummonBarrier: Block %s hit obstacle %s"), *Block->GetName(), *GetNameSafe(HitActor));
-
-			Block->SelfDestroy();
-			SpawnedBlocks.RemoveAt(i);
+			// 같은 대상에 여러 블록이 부딪혀도 한 번만 적용 (큐가 없는 월드에서는 바로 적용)
+			if (EffectQueue)
+			{
+				EffectQueue->QueueEffect(SourceASC, TargetASC, DamageSpecHandle);
+			}
+			else if (DamageSpecHandle.IsValid())
+			{
+				SourceASC->ApplyGameplayEffectSpecToTarget(*DamageSpecHandle.Data.Get(), TargetASC);
+			}
 		}
-	}
 
-	if (SpawnedBlocks.Num() == 0)
-	{
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		UE_LOG(LogTemp, Log, TEXT("GA_SummonBarrier: Block %s hit obstacle %s"), *Block->GetName(), *GetNameSafe(HitActor));
+
+		Block->SelfDestroy();
+		SpawnedBlocks.RemoveAtSwap(i);
 	}
 }
 
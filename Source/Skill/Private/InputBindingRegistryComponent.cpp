@@ -0,0 +1,303 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InputBindingRegistryComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
+#include "EnhancedInputComponent.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputMappingContext.h"
+#include "InputAction.h"
+
+FInputBindingHandle::FInputBindingHandle(FInputBindingHandle&& Other)
+	: Registry(MoveTemp(Other.Registry))
+	, SlotIndex(Other.SlotIndex)
+	, Serial(Other.Serial)
+{
+	Other.Registry.Reset();
+	Other.SlotIndex = INDEX_NONE;
+	Other.Serial = 0;
+}
+
+FInputBindingHandle& FInputBindingHandle::operator=(FInputBindingHandle&& Other)
+{
+	if (this != &Other)
+	{
+		// 기존에 소유하던 바인딩은 먼저 해제
+		Reset();
+
+		Registry = MoveTemp(Other.Registry);
+		SlotIndex = Other.SlotIndex;
+		Serial = Other.Serial;
+
+		Other.Registry.Reset();
+		Other.SlotIndex = INDEX_NONE;
+		Other.Serial = 0;
+	}
+	return *this;
+}
+
+bool FInputBindingHandle::IsValid() const
+{
+	const UInputBindingRegistryComponent* RegistryPtr = Registry.Get();
+	return RegistryPtr && RegistryPtr->Slots.IsValidIndex(SlotIndex)
+		&& RegistryPtr->Slots[SlotIndex].bActive && RegistryPtr->Slots[SlotIndex].Serial == Serial;
+}
+
+void FInputBindingHandle::Reset()
+{
+	if (UInputBindingRegistryComponent* RegistryPtr = Registry.Get())
+	{
+		RegistryPtr->RemoveBinding(SlotIndex, Serial);
+	}
+	Registry.Reset();
+	SlotIndex = INDEX_NONE;
+	Serial = 0;
+}
+
+UInputBindingRegistryComponent::UInputBindingRegistryComponent()
+{
+	// 입력 콜백으로만 동작하므로 Tick 불필요
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+UInputBindingRegistryComponent* UInputBindingRegistryComponent::FindOrAdd(APlayerController* PC)
+{
+	if (!PC || !PC->IsLocalController())
+	{
+		return nullptr;
+	}
+
+	if (UInputBindingRegistryComponent* Existing = PC->FindComponentByClass<UInputBindingRegistryComponent>())
+	{
+		return Existing;
+	}
+
+	UInputBindingRegistryComponent* NewComponent = NewObject<UInputBindingRegistryComponent>(PC, TEXT("InputBindingRegistry"));
+	if (!NewComponent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InputBindingRegistry: Failed to create component for %s"), *PC->GetName());
+		return nullptr;
+	}
+	NewComponent->RegisterComponent();
+	return NewComponent;
+}
+
+FInputBindingHandle UInputBindingRegistryComponent::PushKeyBinding(const FKey& Key, FSimpleDelegate PressedCallback, FSimpleDelegate ReleasedCallback)
+{
+	FInputBindingHandle Result;
+
+	APlayerController* PC = Cast<APlayerController>(GetOwner());
+	if (!PC)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InputBindingRegistry: Owner is not a PlayerController"));
+		return Result;
+	}
+
+	// 로컬 플레이어가 없으면(자동화 테스트의 컨트롤러) 입력 장치가 없으므로 Enhanced Input 없이 스택만 관리
+	const bool bHeadless = PC->GetLocalPlayer() == nullptr;
+
+	UEnhancedInputComponent* EnhancedInput = Cast<UEnhancedInputComponent>(PC->InputComponent);
+	if (!EnhancedInput && !bHeadless)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InputBindingRegistry: InputComponent is not an EnhancedInputComponent"));
+		return Result;
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* InputSubsystem = bHeadless ? nullptr : ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
+	if (!InputSubsystem && !bHeadless)
+	{
+		UE_LOG(LogTemp, Error, TEXT("InputBindingRegistry: EnhancedInputLocalPlayerSubsystem is null"));
+		return Result;
+	}
+
+	// 1. 슬롯 확보 (빈 슬롯이 있으면 컨텍스트/액션째로 재사용)
+	int32 SlotIndex = INDEX_NONE;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = Slots.AddDefaulted();
+		FInputBindingSlot& NewSlot = Slots[SlotIndex];
+		NewSlot.Context = NewObject<UInputMappingContext>(this);
+		NewSlot.Action = NewObject<UInputAction>(this);
+		ActionToSlot.Add(NewSlot.Action.Get(), SlotIndex);
+	}
+
+	FInputBindingSlot& Slot = Slots[SlotIndex];
+
+	// 2. 키 매핑 (같은 키로 재사용되면 매핑을 그대로 둠)
+	if (Slot.Key != Key)
+	{
+		Slot.Context->UnmapAll();
+		Slot.Context->MapKey(Slot.Action, Key);
+		Slot.Key = Key;
+	}
+
+	// 3. 액션 콜백 등록 (뗌 콜백이 있을 때만 Completed 바인딩)
+	Slot.InputComponent = EnhancedInput;
+	Slot.PressedBindingHandle = EnhancedInput
+		? EnhancedInput->BindAction(Slot.Action, ETriggerEvent::Started, this, &UInputBindingRegistryComponent::HandleActionStarted).GetHandle()
+		: 0;
+	Slot.ReleasedBindingHandle = EnhancedInput && ReleasedCallback.IsBound()
+		? EnhancedInput->BindAction(Slot.Action, ETriggerEvent::Completed, this, &UInputBindingRegistryComponent::HandleActionCompleted).GetHandle()
+		: 0;
+	Slot.PressedCallback = MoveTemp(PressedCallback);
+	Slot.ReleasedCallback = MoveTemp(ReleasedCallback);
+	Slot.bActive = true;
+	++Slot.Serial;
+
+	// 4. 스택 맨 위 우선순위로 매핑 컨텍스트 추가
+	// 액션의 입력 소비(bConsumeInput)로 같은 키를 가진 아래 컨텍스트는 입력을 받지 않음
+	Slot.Priority = BasePriority + StackTop;
+	if (InputSubsystem)
+	{
+		InputSubsystem->AddMappingContext(Slot.Context, Slot.Priority);
+	}
+	++StackTop;
+	++NumActive;
+
+	Result.Registry = this;
+	Result.SlotIndex = SlotIndex;
+	Result.Serial = Slot.Serial;
+	return Result;
+}
+
+void UInputBindingRegistryComponent::RemoveBinding(int32 SlotIndex, uint32 Serial)
+{
+	if (!Slots.IsValidIndex(SlotIndex))
+	{
+		return;
+	}
+
+	// 이미 해제되었거나 다른 소유자가 재사용 중인 슬롯이면 무시
+	const FInputBindingSlot& Slot = Slots[SlotIndex];
+	if (!Slot.bActive || Slot.Serial != Serial)
+	{
+		return;
+	}
+
+	ReleaseSlot(SlotIndex);
+}
+
+void UInputBindingRegistryComponent::ReleaseSlot(int32 SlotIndex)
+{
+	FInputBindingSlot& Slot = Slots[SlotIndex];
+
+	// 1. 액션 콜백 해제 (핸들로 자신의 바인딩만 제거)
+	if (UEnhancedInputComponent* EnhancedInput = Slot.InputComponent.Get())
+	{
+		EnhancedInput->RemoveBindingByHandle(Slot.PressedBindingHandle);
+		if (Slot.ReleasedBindingHandle != 0)
+		{
+			EnhancedInput->RemoveBindingByHandle(Slot.ReleasedBindingHandle);
+		}
+	}
+
+	// 2. 매핑 컨텍스트 제거
+	const APlayerController* PC = Cast<APlayerController>(GetOwner());
+	UEnhancedInputLocalPlayerSubsystem* InputSubsystem = PC ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+	if (InputSubsystem)
+	{
+		InputSubsystem->RemoveMappingContext(Slot.Context);
+	}
+
+	// 3. 슬롯 반환 (일련번호는 다음 사용 때 증가)
+	Slot.PressedCallback.Unbind();
+	Slot.ReleasedCallback.Unbind();
+	Slot.InputComponent.Reset();
+	Slot.PressedBindingHandle = 0;
+	Slot.ReleasedBindingHandle = 0;
+	Slot.bActive = false;
+	FreeSlots.Push(SlotIndex);
+
+	--NumActive;
+	if (NumActive == 0)
+	{
+		StackTop = 0;
+	}
+}
+
+FInputBindingSlot* UInputBindingRegistryComponent::FindActiveSlot(const FInputActionInstance& Instance)
+{
+	const int32* SlotIndex = ActionToSlot.Find(Instance.GetSourceAction());
+	if (!SlotIndex || !Slots[*SlotIndex].bActive)
+	{
+		return nullptr;
+	}
+	return &Slots[*SlotIndex];
+}
+
+void UInputBindingRegistryComponent::HandleActionStarted(const FInputActionInstance& Instance)
+{
+	if (const FInputBindingSlot* Slot = FindActiveSlot(Instance))
+	{
+		// 콜백 안에서 바인딩이 해제될 수 있으므로 복사해서 호출
+		const FSimpleDelegate Callback = Slot->PressedCallback;
+		Callback.ExecuteIfBound();
+	}
+}
+
+void UInputBindingRegistryComponent::HandleActionCompleted(const FInputActionInstance& Instance)
+{
+	if (const FInputBindingSlot* Slot = FindActiveSlot(Instance))
+	{
+		const FSimpleDelegate Callback = Slot->ReleasedCallback;
+		Callback.ExecuteIfBound();
+	}
+}
+
+FInputBindingSlot* UInputBindingRegistryComponent::FindTopSlotForKey(const FKey& Key)
+{
+	FInputBindingSlot* TopSlot = nullptr;
+	for (FInputBindingSlot& Slot : Slots)
+	{
+		if (Slot.bActive && Slot.Key == Key && (!TopSlot || Slot.Priority > TopSlot->Priority))
+		{
+			TopSlot = &Slot;
+		}
+	}
+	return TopSlot;
+}
+
+bool UInputBindingRegistryComponent::SimulateKeyPress(const FKey& Key)
+{
+	const FInputBindingSlot* Slot = FindTopSlotForKey(Key);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	// 콜백 안에서 바인딩이 해제될 수 있으므로 복사해서 호출
+	const FSimpleDelegate Callback = Slot->PressedCallback;
+	Callback.ExecuteIfBound();
+	return true;
+}
+
+bool UInputBindingRegistryComponent::SimulateKeyRelease(const FKey& Key)
+{
+	const FInputBindingSlot* Slot = FindTopSlotForKey(Key);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	const FSimpleDelegate Callback = Slot->ReleasedCallback;
+	Callback.ExecuteIfBound();
+	return true;
+}
+
+void UInputBindingRegistryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 남은 바인딩 정리 (핸들은 이후 Reset되어도 레지스트리가 없으므로 무시됨)
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].bActive)
+		{
+			ReleaseSlot(SlotIndex);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -2,7 +2,10 @@
 
 
 #include "Object/Explosive.h"
+#include "Object/ExplosiveFlightSubsystem.h"
+#include "Object/ExplosivePoolSubsystem.h"
 #include "Block/BlockBase.h"
+#include "GA/GA_SkillBase.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "TimerManager.h"           
@@ -14,16 +17,15 @@
 // Sets default values
 AExplosive::AExplosive()
 {
-	// Set this actor to call Tick() every frame.
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = false; // Initialize ȣ  Tick Ȱȭ
+	// 비행은 UExplosiveFlightSubsystem이 일괄 처리하므로 Tick 불필요
+	PrimaryActorTick.bCanEverTick = false;
 
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
 	RootComponent = MeshComponent;
 
 	/*
-	* ߹   ǥ  ٸ ü ȣۿ 
-	*  浹 
+	* 폭발물은 블록위에 붙은 표시일 뿐 다른 객체와 상호작용하지 않음
+	* 물리엔진 충돌 끔
 	*/
 	MeshComponent->SetCollisionProfileName(TEXT("NoCollision"));
 }
@@ -42,12 +44,15 @@ void AExplosive::Initialize(
 	int32 InMaxBombCount,
 	UAbilitySystemComponent* InSourceASC,
 	FGameplayEffectSpecHandle InDamageSpecHandle,
-	TSubclassOf<UGameplayEffect> InDestructionEffectClass)
+	TSubclassOf<UGameplayEffect> InDestructionEffectClass,
+	float InBlockDamage)
 {
+	bInUse = true;
+	bAttached = false;
+
 	StartLocation = StartLoc;
 	TargetBlock = Target;
 	TotalFlightTime = FlightDuration;
-	CurrentFlightTime = 0.0f;
 
 	AutoDetonateDelay = InAutoDetonateDelay;
 	ExplosionRadius = InExplosionRadius;
@@ -55,71 +60,51 @@ void AExplosive::Initialize(
 	SourceASC = InSourceASC;
 	DamageSpecHandle = InDamageSpecHandle;
 	DestructionEffectClass = InDestructionEffectClass;
+	BlockDamage = InBlockDamage;
 
 	if (TargetBlock)
 	{
-		// ǥ :  ߽ + Z 50 ( ߾)
+		// 목표 지점: 블록 중심 + Z 50 (윗면 중앙)
 		float HarfGridSize = TargetBlock->GetGridSize() / 2.0f;
 		FVector BlockLoc = TargetBlock->GetActorLocation();
 		TargetLocation = BlockLoc + FVector(0.0f, 0.0f, HarfGridSize);
 
-		SetActorLocation(StartLocation);
-		SetActorTickEnabled(true);
-
-		//  ıǴ  ( ı    )
+		// 블록이 파괴되는지 감시 (블록이 파괴될 때 같이 터지기 위해)
 		TargetBlock->OnDestroyed.AddDynamic(this, &AExplosive::OnBlockDestroyed);
+
+		// 비행은 서브시스템에 등록해 다른 폭발물과 한 번에 계산
+		UExplosiveFlightSubsystem* FlightSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UExplosiveFlightSubsystem>() : nullptr;
+		if (FlightSubsystem)
+		{
+			FlightSubsystem->LaunchExplosive(this, StartLocation, TargetLocation, TotalFlightTime, ArcHeight);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AExplosive::Initialize: FlightSubsystem is null, landing immediately"));
+			OnLanded();
+		}
 	}
 	else
 	{
 		UE_LOG(LogTemp, Error, TEXT("AExplosive::Initialize: TargetBlock is null"));
-		Destroy();
-	}
-}
-
-void AExplosive::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (bAttached) return;
-
-	CurrentFlightTime += DeltaTime;
-
-	//  (0.0 ~ 1.0)
-	float Alpha = FMath::Clamp(CurrentFlightTime / TotalFlightTime, 0.0f, 1.0f);
-
-	//   ( ̵)
-	FVector LerpLocation = FMath::Lerp(StartLocation, TargetLocation, Alpha);
-
-	//   ߰ (4 * Height * x * (1-x))
-	float HeightOffset = ArcHeight * 4.0f * Alpha * (1.0f - Alpha);
-
-	FVector NewLocation = LerpLocation;
-	NewLocation.Z += HeightOffset;
-
-	SetActorLocation(NewLocation);
-
-	//  Ȯ
-	if (Alpha >= 1.0f)
-	{
-		OnLanded();
+		ReleaseToPool();
 	}
 }
 
 void AExplosive::OnLanded()
 {
 	bAttached = true;
-	SetActorTickEnabled(false);
 
-	// ġ 
+	// 위치 보정
 	SetActorLocation(TargetLocation);
 
-	// ٴ   
+	// 바닥 블록 빨간색으로 변경
 	if (TargetBlock)
 	{
-		// ǥ ġ ̵
+		// 목표 위치로 이동
 		SetActorLocation(TargetLocation);
 
-		// Ͽ  (ġ )
+		// 블록에 부착 (위치 고정)
 		FAttachmentTransformRules AttachmentRules(EAttachmentRule::KeepWorld, true);
 		AttachToActor(TargetBlock, AttachmentRules);
 
@@ -127,11 +112,12 @@ void AExplosive::OnLanded()
 	}
 	else
 	{
-		// ϰ  Ÿ     
+		// 도착하고 보니 타겟 블록이 없어진 경우 즉시 기폭 (풀에 반납되므로 타이머를 걸지 않음)
 		Detonate();
+		return;
 	}
 
-	// ڵ  Ÿ̸ 
+	// 자동 폭파 타이머 시작
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(DetonateTimerHandle, this, &AExplosive::OnAutoDetonate, AutoDetonateDelay, false);
@@ -144,13 +130,33 @@ void AExplosive::OnLanded()
 
 void AExplosive::Detonate()
 {
-	//  ı ɾ Ʈ 
+	// 이미 폭발해 풀에 반납된 폭발물이면 무시 (중복 기폭 방지)
+	if (!bInUse)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AExplosive::Detonate: Explosive is not in use"));
+		return;
+	}
+	bInUse = false;
+
+	// 비행 중에 기폭되면 비행을 멈추고 현재 포물선 위치에서 폭발
+	if (!bAttached)
+	{
+		UWorld* World = GetWorld();
+		UExplosiveFlightSubsystem* FlightSubsystem = World ? World->GetSubsystem<UExplosiveFlightSubsystem>() : nullptr;
+		FVector FlightLocation;
+		if (FlightSubsystem && FlightSubsystem->CancelFlight(this, &FlightLocation))
+		{
+			SetActorLocation(FlightLocation);
+		}
+	}
+
+	// 블록 파괴에 걸어둔 델리게이트 해제
 	if (TargetBlock)
 	{
 		TargetBlock->OnDestroyed.RemoveDynamic(this, &AExplosive::OnBlockDestroyed);
 	}
 
-	// Ÿ̸Ӱ  ִٸ  (   ߺ  )
+	// 타이머가 돌고 있다면 중지 (수동 기폭 시 중복 실행 방지)
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(DetonateTimerHandle);
@@ -159,7 +165,7 @@ void AExplosive::Detonate()
 		UE_LOG(LogTemp, Warning, TEXT("AExplosive::Detonate: World is null, cannot clear timer"));
 	}
 
-	// GA   ˸
+	// GA에게 폭발 사실 알림
 	if (OnDetonatedDelegate.IsBound())
 	{
 		OnDetonatedDelegate.Broadcast();
@@ -169,14 +175,14 @@ void AExplosive::Detonate()
 		UE_LOG(LogTemp, Log, TEXT("AExplosive::Detonate: No one is listening to OnDetonatedDelegate"));
 	}
 
-	//    ó 
+	// 폭발 범위 데미지 처리 
 	FVector ExplosionCenter = GetActorLocation();
 
 	TArray<FOverlapResult> OverlapResults;
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(this);
 
-	// (÷̾) ظ  ʵ 
+	// 시전자(플레이어)는 피해를 입지 않도록 제외
 	if (SourceASC.IsValid() && SourceASC->GetAvatarActor()) QueryParams.AddIgnoredActor(SourceASC->GetAvatarActor());
 
 	bool bHit = GetWorld()->OverlapMultiByChannel(
@@ -188,66 +194,47 @@ void AExplosive::Detonate()
 		QueryParams
 	);
 
-	if (bHit)
+	// 데미지/파괴 스펙을 폭발당 한 번씩만 만들어 중복 없는 대상에 적용하고, 블록은 그리드 피해로 전달
+	if (bHit && SourceASC.IsValid())
 	{
-		for (const FOverlapResult& Overlap : OverlapResults)
-		{
-			AActor* HitActor = Overlap.GetActor();
-			if (!HitActor) continue;
+		TArray<FGameplayEffectSpecHandle, TInlineAllocator<2>> Specs;
 
-			// ASC Ȯ
-			UAbilitySystemComponent* TargetASC = nullptr;
-			if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(HitActor))
-			{
-				TargetASC = ASI->GetAbilitySystemComponent();
-			}
+		// 1. 데미지 Effect (GA가 룬을 반영해 미리 만든 스펙)
+		if (DamageSpecHandle.IsValid())
+		{
+			Specs.Add(DamageSpecHandle);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AExplosive::Detonate: DamageSpecHandle is invalid"));
+		}
 
-			if (TargetASC && SourceASC.IsValid())
+		// 2. 파괴 Effect
+		if (DestructionEffectClass)
+		{
+			FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
+			Context.AddSourceObject(this);
+
+			FGameplayEffectSpecHandle DestSpecHandle = SourceASC->MakeOutgoingSpec(
+				DestructionEffectClass,
+				1.0f, // Level
+				Context
+			);
+			if (DestSpecHandle.IsValid())
 			{
-				// 1.  Effect 
-				if (DamageSpecHandle.IsValid())
-				{
-					SourceASC->ApplyGameplayEffectSpecToTarget(
-						*DamageSpecHandle.Data.Get(),
-						TargetASC
-					);
-					UE_LOG(LogTemp, Log, TEXT("AExplosive::Detonate: Applied damage to %s"), *HitActor->GetName());
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("AExplosive::Detonate: DamageSpecHandle is invalid"));
-				}
-
-				// 2. ı Effect 
-				if (DestructionEffectClass)
-				{
-					// Context 
-					FGameplayEffectContextHandle Context = SourceASC->MakeEffectContext();
-					Context.AddSourceObject(this);
-
-					// Spec 
-					FGameplayEffectSpecHandle DestSpecHandle = SourceASC->MakeOutgoingSpec(
-						DestructionEffectClass,
-						1.0f, // Level
-						Context
-					);
-
-					if (DestSpecHandle.IsValid())
-					{
-						SourceASC->ApplyGameplayEffectSpecToTarget(
-							*DestSpecHandle.Data.Get(),
-							TargetASC
-						);
-					}
-				}
+				Specs.Add(DestSpecHandle);
 			}
 		}
+
+		// 3. 대상은 GE 적용 큐에 제출하고 블록 셀은 한 번에 피해 적용
+		const int32 NumQueued = UGA_SkillBase::ApplySpecsToOverlaps(SourceASC.Get(), OverlapResults, Specs, BlockDamage);
+		UE_LOG(LogTemp, Log, TEXT("AExplosive::Detonate: Queued %d effects"), NumQueued);
 	}
 
-	//   ׸
+	// 디버그 구 그리기
 	DrawDebugSphere(GetWorld(), ExplosionCenter, ExplosionRadius, 16, FColor::Red, false, 2.0f, 0, 2.0f);
 
-	//   
+	// 블록 색상 복구
 	if (TargetBlock)
 	{
 		TargetBlock->UpdateBombCount(-1, MaxBombCount);
@@ -256,11 +243,62 @@ void AExplosive::Detonate()
 		UE_LOG(LogTemp, Warning, TEXT("AExplosive::Detonate: TargetBlock is invalid during detonation"));
 	}
 
-	//  ó
-	Destroy();
+	// 폭발 처리 (파괴하지 않고 풀에 반납)
+	ReleaseToPool();
+}
+
+void AExplosive::ResetForPool()
+{
+	// 1. 타이머 중지
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DetonateTimerHandle);
+
+		// 2. 아직 날아가는 중이라면 비행 취소
+		if (UExplosiveFlightSubsystem* FlightSubsystem = World->GetSubsystem<UExplosiveFlightSubsystem>())
+		{
+			FlightSubsystem->CancelFlight(this);
+		}
+	}
+
+	// 3. 블록 감시 해제 및 부착 해제
+	if (TargetBlock)
+	{
+		TargetBlock->OnDestroyed.RemoveDynamic(this, &AExplosive::OnBlockDestroyed);
+	}
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	// 4. 상태 및 스펙 초기화
+	TargetBlock = nullptr;
+	bAttached = false;
+	bInUse = false;
+	StartLocation = FVector::ZeroVector;
+	TargetLocation = FVector::ZeroVector;
+	SourceASC.Reset();
+	DamageSpecHandle = FGameplayEffectSpecHandle();
+	DestructionEffectClass = nullptr;
+
+	// 5. 이전 투척의 GA가 걸어둔 델리게이트 해제
+	OnDetonatedDelegate.Clear();
+
+	SetActorHiddenInGame(true);
+}
+
+void AExplosive::ReleaseToPool()
+{
+	UWorld* World = GetWorld();
+	UExplosivePoolSubsystem* Pool = World ? World->GetSubsystem<UExplosivePoolSubsystem>() : nullptr;
+	if (Pool)
+	{
+		Pool->ReleaseExplosive(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
-// Ÿ̸ ݹ
+// 타이머 콜백
 void AExplosive::OnAutoDetonate()
 {
 	UE_LOG(LogTemp, Log, TEXT("AExplosive::OnAutoDetonate: Time is up!"));
@@ -274,38 +312,38 @@ void AExplosive::SetBlockColorRed(bool bEnable)
 		UStaticMeshComponent* BlockMesh = TargetBlock->GetBlockMesh();
 		if (BlockMesh)
 		{
-			// (2.0f) Ǵ (0.0f) 
-			// CPD Index 0  (1=Preview, 2=Red/Attached, 3=Green/Targeted)
+			// 빨간색(2.0f) 또는 원래대로(0.0f) 설정
+			// CPD Index 0 사용 (1=Preview, 2=Red/Attached, 3=Green/Targeted)
 			float ColorValue = bEnable ? 2.0f : 0.0f;
 			BlockMesh->SetCustomPrimitiveDataFloat(0, ColorValue);
 		}
 		else
 		{
-			// ȿ ˻   α 
+			// 유효성 검사 실패 시 로그 출력
 			UE_LOG(LogTemp, Warning, TEXT("AExplosive::SetBlockColorRed: BlockMesh is null"));
 		}
 	}
 	else
 	{
-		// ȿ ˻   α 
+		// 유효성 검사 실패 시 로그 출력
 		UE_LOG(LogTemp, Warning, TEXT("AExplosive::SetBlockColorRed: TargetBlock is null"));
 	}
 }
 
 void AExplosive::OnBlockDestroyed(AActor* DestroyedActor)
 {
-	//  ̹ ı  Ƿ, Ÿ ͸ null     ϰ 
+	// 블록은 이미 파괴 과정에 있으므로, 타겟 포인터를 null로 비워 폭발 로직에서 접근하지 못하게 함
 	TargetBlock = nullptr;
 
-	// Ÿ  ıǾٸ?
+	// 타겟 블록이 파괴되었다면?
 	if (bAttached)
 	{
-		// ̹  ¶: ϰ Բ  ؾ 
+		// 이미 부착된 상태라면: 블록과 함께 즉시 폭발해야 함
 		Detonate();
 	}
 	else
 	{
-		// ư ̶: ⼭ Ͷ߸ 
-		// Tick   ̰, OnLanded()   TargetBlock null̹Ƿ ׶ 
+		// 날아가는 중이라면: 여기서 터뜨리지 않음
+		// 서브시스템이 비행을 계속 진행하고, OnLanded()에 도착했을 때 TargetBlock이 null이므로 그때 터짐
 	}
 }
@@ -0,0 +1,234 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/ExplosiveFlightSubsystem.h"
+#include "Object/Explosive.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+void UExplosiveFlightSubsystem::Deinitialize()
+{
+	if (FlightActor)
+	{
+		FlightActor->Destroy();
+		FlightActor = nullptr;
+	}
+	FlightMesh = nullptr;
+
+	Explosives.Empty();
+	StartLocations.Empty();
+	TargetLocations.Empty();
+	CurrentLocations.Empty();
+	Scales.Empty();
+	Durations.Empty();
+	ElapsedTimes.Empty();
+	ArcHeights.Empty();
+	bInstanced.Empty();
+	InstanceTransforms.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UExplosiveFlightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UExplosiveFlightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UExplosiveFlightSubsystem, STATGROUP_Tickables);
+}
+
+FVector UExplosiveFlightSubsystem::EvaluateArc(const FVector& Start, const FVector& Target, float ArcHeight, float Alpha)
+{
+	FVector Location = FMath::Lerp(Start, Target, Alpha);
+	Location.Z += ArcHeight * 4.0f * Alpha * (1.0f - Alpha);
+	return Location;
+}
+
+void UExplosiveFlightSubsystem::LaunchExplosive(AExplosive* Explosive, const FVector& StartLocation, const FVector& TargetLocation, float Duration, float ArcHeight)
+{
+	if (!Explosive)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExplosiveFlightSubsystem::LaunchExplosive: Explosive is null"));
+		return;
+	}
+
+	// 같은 폭발물을 다시 던지면 이전 비행은 취소
+	CancelFlight(Explosive);
+
+	const bool bUseInstance = EnsureFlightMesh(Explosive);
+
+	Explosives.Add(Explosive);
+	StartLocations.Add(StartLocation);
+	TargetLocations.Add(TargetLocation);
+	CurrentLocations.Add(StartLocation);
+	Scales.Add(Explosive->GetMeshComponent() ? Explosive->GetMeshComponent()->GetComponentScale() : Explosive->GetActorScale3D());
+	Durations.Add(FMath::Max(Duration, KINDA_SMALL_NUMBER));
+	ElapsedTimes.Add(0.0f);
+	ArcHeights.Add(ArcHeight);
+	bInstanced.Add(bUseInstance);
+
+	// 인스턴스로 그리는 동안 액터는 숨김
+	if (bUseInstance)
+	{
+		Explosive->SetActorHiddenInGame(true);
+	}
+	Explosive->SetActorLocation(StartLocation);
+}
+
+bool UExplosiveFlightSubsystem::CancelFlight(const AExplosive* Explosive, FVector* OutLocation)
+{
+	for (int32 Index = 0; Index < Explosives.Num(); ++Index)
+	{
+		if (Explosives[Index].Get() == Explosive)
+		{
+			if (OutLocation)
+			{
+				*OutLocation = CurrentLocations[Index];
+			}
+			if (AExplosive* Flying = Explosives[Index].Get())
+			{
+				Flying->SetActorHiddenInGame(false);
+			}
+			RemoveFlightAt(Index);
+			return true;
+		}
+	}
+	return false;
+}
+
+void UExplosiveFlightSubsystem::RemoveFlightAt(int32 Index)
+{
+	Explosives.RemoveAtSwap(Index);
+	StartLocations.RemoveAtSwap(Index);
+	TargetLocations.RemoveAtSwap(Index);
+	CurrentLocations.RemoveAtSwap(Index);
+	Scales.RemoveAtSwap(Index);
+	Durations.RemoveAtSwap(Index);
+	ElapsedTimes.RemoveAtSwap(Index);
+	ArcHeights.RemoveAtSwap(Index);
+	bInstanced.RemoveAtSwap(Index);
+
+	bVisualDirty = true;
+}
+
+void UExplosiveFlightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 1. 모든 비행을 한 루프에서 진행 (착지한 폭발물은 루프가 끝난 뒤 처리)
+	TArray<AExplosive*, TInlineAllocator<8>> LandedExplosives;
+
+	for (int32 Index = Explosives.Num() - 1; Index >= 0; --Index)
+	{
+		AExplosive* Explosive = Explosives[Index].Get();
+		if (!Explosive)
+		{
+			RemoveFlightAt(Index);
+			continue;
+		}
+
+		ElapsedTimes[Index] += DeltaTime;
+		const float Alpha = FMath::Clamp(ElapsedTimes[Index] / Durations[Index], 0.0f, 1.0f);
+		CurrentLocations[Index] = EvaluateArc(StartLocations[Index], TargetLocations[Index], ArcHeights[Index], Alpha);
+
+		if (Alpha >= 1.0f)
+		{
+			LandedExplosives.Add(Explosive);
+			RemoveFlightAt(Index);
+			continue;
+		}
+
+		// 인스턴스 메시와 다른 메시를 쓰는 폭발물만 액터를 직접 이동
+		if (!bInstanced[Index])
+		{
+			Explosive->SetActorLocation(CurrentLocations[Index]);
+		}
+	}
+
+	// 2. 인스턴스 메시 일괄 갱신
+	UpdateFlightMesh();
+
+	// 3. 착지한 폭발물은 부착/기폭 로직으로 넘김
+	for (AExplosive* Explosive : LandedExplosives)
+	{
+		Explosive->SetActorHiddenInGame(false);
+		Explosive->OnLanded();
+	}
+}
+
+bool UExplosiveFlightSubsystem::EnsureFlightMesh(const AExplosive* Explosive)
+{
+	UWorld* World = GetWorld();
+	const UStaticMeshComponent* SourceMesh = Explosive ? Explosive->GetMeshComponent() : nullptr;
+	if (!World || !SourceMesh || !SourceMesh->GetStaticMesh() || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	// 이미 만들어져 있으면 같은 메시인지만 확인
+	if (FlightMesh)
+	{
+		return FlightMesh->GetStaticMesh() == SourceMesh->GetStaticMesh();
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	FlightActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!FlightActor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExplosiveFlightSubsystem: Failed to spawn flight actor"));
+		return false;
+	}
+
+	USceneComponent* Root = NewObject<USceneComponent>(FlightActor);
+	FlightActor->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	FlightMesh = NewObject<UInstancedStaticMeshComponent>(FlightActor);
+	FlightMesh->SetStaticMesh(SourceMesh->GetStaticMesh());
+	for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+	{
+		FlightMesh->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+	}
+	FlightMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	FlightMesh->SetupAttachment(Root);
+	FlightMesh->RegisterComponent();
+
+	return true;
+}
+
+void UExplosiveFlightSubsystem::UpdateFlightMesh()
+{
+	if (!FlightMesh)
+	{
+		bVisualDirty = false;
+		return;
+	}
+
+	// 인스턴스는 늘기만 하고 줄지 않음 (쓰지 않는 인스턴스는 크기 0)
+	const int32 NumFlights = Explosives.Num();
+	if (InstanceTransforms.Num() < NumFlights)
+	{
+		const int32 NumToAdd = NumFlights - InstanceTransforms.Num();
+		TArray<FTransform> NewInstances;
+		NewInstances.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), NumToAdd);
+		FlightMesh->AddInstances(NewInstances, false, true);
+		InstanceTransforms.Append(NewInstances);
+	}
+
+	for (int32 Index = 0; Index < InstanceTransforms.Num(); ++Index)
+	{
+		const bool bVisible = Index < NumFlights && bInstanced[Index];
+		InstanceTransforms[Index] = bVisible
+			? FTransform(FQuat::Identity, CurrentLocations[Index], Scales[Index])
+			: FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	}
+
+	// 프레임당 한 번의 일괄 갱신
+	FlightMesh->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+	bVisualDirty = false;
+}
@@ -0,0 +1,138 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/ExplosivePoolSubsystem.h"
+#include "Object/Explosive.h"
+#include "SkillStats.h"
+#include "Engine/World.h"
+
+void UExplosivePoolSubsystem::Deinitialize()
+{
+	// 월드가 내려갈 때 액터도 함께 정리되므로 참조만 비움
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UExplosivePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AExplosive* UExplosivePoolSubsystem::SpawnPooledExplosive(TSubclassOf<AExplosive> ExplosiveClass, FExplosivePool& Pool)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExplosivePoolSubsystem::SpawnPooledExplosive: World is null"));
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SkillSpawn);
+	INC_DWORD_STAT(STAT_SkillSpawnedActors);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AExplosive* Explosive = World->SpawnActor<AExplosive>(ExplosiveClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (!Explosive)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExplosivePoolSubsystem::SpawnPooledExplosive: Failed to spawn %s"), *GetNameSafe(ExplosiveClass));
+		return nullptr;
+	}
+
+	Explosive->SetActorHiddenInGame(true);
+	++Pool.NumSpawned;
+	return Explosive;
+}
+
+void UExplosivePoolSubsystem::Prewarm(TSubclassOf<AExplosive> ExplosiveClass, int32 Count)
+{
+	if (!ExplosiveClass)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ExplosivePoolSubsystem::Prewarm: ExplosiveClass is null"));
+		return;
+	}
+
+	FExplosivePool& Pool = Pools.FindOrAdd(ExplosiveClass);
+	const int32 TargetCount = FMath::Min(Count, MaxPooledPerClass);
+
+	while (Pool.NumSpawned < TargetCount)
+	{
+		AExplosive* Explosive = SpawnPooledExplosive(ExplosiveClass, Pool);
+		if (!Explosive)
+		{
+			return;
+		}
+		Pool.FreeExplosives.Add(Explosive);
+	}
+}
+
+AExplosive* UExplosivePoolSubsystem::AcquireExplosive(TSubclassOf<AExplosive> ExplosiveClass, const FVector& Location)
+{
+	if (!ExplosiveClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ExplosivePoolSubsystem::AcquireExplosive: ExplosiveClass is null"));
+		return nullptr;
+	}
+
+	FExplosivePool& Pool = Pools.FindOrAdd(ExplosiveClass);
+
+	// 1. 대기 목록에서 꺼냄 (레벨 정리 등으로 파괴된 항목은 건너뜀)
+	AExplosive* Explosive = nullptr;
+	while (!Explosive && Pool.FreeExplosives.Num() > 0)
+	{
+		AExplosive* Candidate = Pool.FreeExplosives.Pop(EAllowShrinking::No);
+		if (IsValid(Candidate))
+		{
+			Explosive = Candidate;
+		}
+		else
+		{
+			--Pool.NumSpawned;
+		}
+	}
+
+	// 2. 대기 목록이 비었으면 새로 생성
+	if (!Explosive)
+	{
+		Explosive = SpawnPooledExplosive(ExplosiveClass, Pool);
+		if (!Explosive)
+		{
+			return nullptr;
+		}
+		UE_LOG(LogTemp, Log, TEXT("ExplosivePoolSubsystem: Pool for %s grew to %d"), *GetNameSafe(ExplosiveClass), Pool.NumSpawned);
+	}
+
+	Explosive->SetActorLocation(Location);
+	Explosive->SetActorHiddenInGame(false);
+	return Explosive;
+}
+
+void UExplosivePoolSubsystem::ReleaseExplosive(AExplosive* Explosive)
+{
+	if (!IsValid(Explosive))
+	{
+		return;
+	}
+
+	// 타이머, 부착, 델리게이트, 스펙 등 이전 투척의 상태를 모두 초기화
+	Explosive->ResetForPool();
+
+	FExplosivePool& Pool = Pools.FindOrAdd(Explosive->GetClass());
+	if (Pool.FreeExplosives.Contains(Explosive))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ExplosivePoolSubsystem::ReleaseExplosive: %s is already in the pool"), *Explosive->GetName());
+		return;
+	}
+
+	// 대기 목록이 가득 찼으면 풀에 넣지 않고 파괴
+	if (Pool.FreeExplosives.Num() >= MaxPooledPerClass)
+	{
+		--Pool.NumSpawned;
+		Explosive->Destroy();
+		return;
+	}
+
+	Pool.FreeExplosives.Add(Explosive);
+}
@@ -1,9 +1,14 @@
 ﻿// Fill out your copyright notice in the Description page of Project Settings.
 
 #include "SkillManagerComponent.h"
+#include "Data/SkillDataSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "Abilities/GameplayAbility.h"
 #include "Rune/DA_Rune.h"
+#include "Net/UnrealNetwork.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 // FSkillSlot의 UpdateGreenRuneCache 구현
 void FSkillSlot::UpdateGreenRuneCache()
@@ -32,6 +37,17 @@ USkillManagerComponent::USkillManagerComponent()
 
 	// 기본 슬롯 개수를 3개로 설정 (블루프린트에서 변경 가능)
 	SkillSlots.SetNum(3);
+
+	// 활성 변형 인덱스를 소유 클라이언트에 복제 (입력 라우팅용)
+	SetIsReplicatedByDefault(true);
+}
+
+void USkillManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 입력은 소유 클라이언트만 처리하므로 다른 클라이언트에는 보내지 않음
+	DOREPLIFETIME_CONDITION(USkillManagerComponent, SlotVariants, COND_OwnerOnly);
 }
 
 
@@ -39,9 +55,35 @@ USkillManagerComponent::USkillManagerComponent()
 void USkillManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 스킬 정의 테이블 등록 (모든 스킬이 발동 시 이 캐시를 읽음)
+	if (SkillDataTable)
+	{
+		if (USkillDataSubsystem* SkillData = USkillDataSubsystem::Get(this))
+		{
+			SkillData->SetSkillDataTable(SkillDataTable);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("USkillManagerComponent::BeginPlay: SkillDataSubsystem is null"));
+		}
+	}
+
+	// BP 기본값으로 장착된 룬 반영
+	for (int32 SlotIndex = 0; SlotIndex < SkillSlots.Num(); ++SlotIndex)
+	{
+		ResolveSlotStats(SlotIndex);
+	}
 }
 
 
+void USkillManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindCooldownTracking();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // Called every frame
 void USkillManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
@@ -50,7 +92,14 @@ void USkillManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 void USkillManagerComponent::SkillManagerInitialize(UAbilitySystemComponent* InAbilitySystemComponent)
 {
+	// 같은 ASC로 다시 호출되면 (서버에서 캐릭터 초기화 후 InitializeSkills) 바인딩 유지
+	if (CachedAbilitySystemComponent == InAbilitySystemComponent && CachedAbilitySystemComponent)
+	{
+		return;
+	}
+
 	// ASC 참조를 캐싱
+	UnbindCooldownTracking();
 	CachedAbilitySystemComponent = InAbilitySystemComponent;
 
 	if (!CachedAbilitySystemComponent)
@@ -59,6 +108,9 @@ void USkillManagerComponent::SkillManagerInitialize(UAbilitySystemComponent* InA
 		return;
 	}
 
+	// 쿨타임 GE 추가/제거만 감시 (HUD가 매 프레임 ASC를 조회하지 않도록)
+	BindCooldownTracking();
+
 	UE_LOG(LogTemp, Log, TEXT("USkillManagerComponent::SkillManagerInitialize: Successfully initialized with ASC"));
 }
 
@@ -91,21 +143,38 @@ bool USkillManagerComponent::EquipSkill(int32 SlotIndex, TSubclassOf<UGameplayAb
 		UnequipSkill(SlotIndex);
 	}
 
+	// 기본 스킬과 초록 룬 교체 스킬을 모두 한 번에 부여
+	// 룬이 바뀌면 활성 변형 인덱스만 바꾸므로 스펙을 다시 부여하지 않고, 입력 계층이 캐싱한 핸들도 유지됨
+	FSkillSlot& SkillSlot = SkillSlots[SlotIndex];
+	SkillSlot.UpdateGreenRuneCache();
+	CollectVariantSkills(SlotIndex, SkillClass, SkillSlot.VariantSkills);
+
+	if (SlotVariants.Num() < SkillSlots.Num())
+	{
+		SlotVariants.SetNum(SkillSlots.Num());
+	}
+	FSkillSlotVariants& Variants = SlotVariants[SlotIndex];
+	Variants.Handles.Reset();
+	Variants.ActiveIndex = 0;
+
 	// GA Spec 생성
 	// @param SkillClass 장착할 GA 클래스
 	// @param Level 1로 시작
-	// @param InputID는 SlotIndex로 설정
+	// @param InputID는 SlotIndex로 설정 (모든 변형이 같은 InputID를 쓰고, 비활성 변형은 CanActivateAbility에서 거부됨)
 	// @param Source_object 이 컴포넌트의 소유자(플레이어)
-	FGameplayAbilitySpec AbilitySpec(SkillClass, 1, SlotIndex, GetOwner());
-
 	// ASC에 GA 부여 (GiveAbility)
-	// @param AbilitySpec 생성한 GA Spec
 	// @return 부여된 GA의 SpecHandle
-	FGameplayAbilitySpecHandle NewHandle = CachedAbilitySystemComponent->GiveAbility(AbilitySpec);
+	Variants.Handles.Add(CachedAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(SkillClass, 1, SlotIndex, GetOwner())));
+	for (const TSubclassOf<UGameplayAbility>& VariantSkill : SkillSlot.VariantSkills)
+	{
+		Variants.Handles.Add(CachedAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(VariantSkill, 1, SlotIndex, GetOwner())));
+	}
 
-	// 슬롯에 스킬 정보 저장
-	SkillSlots[SlotIndex].EquippedSkill = SkillClass;
-	SkillSlots[SlotIndex].AbilityHandle = NewHandle;
+	// 슬롯에 스킬 정보 저장 후 장착된 초록 룬에 맞는 변형 선택
+	SkillSlot.EquippedSkill = SkillClass;
+	SkillSlot.AbilityHandle = Variants.Handles[0];
+	UpdateActiveVariant(SlotIndex);
+	ResolveSlotStats(SlotIndex);
 
 	/*UE_LOG(LogTemp, Log, TEXT("USkillManagerComponent::EquipSkill: Equipped %s to slot %d"), 
 		*SkillClass->GetName(), SlotIndex);*/
@@ -136,13 +205,25 @@ bool USkillManagerComponent::UnequipSkill(int32 SlotIndex)
 		return true;
 	}
 
-	// ASC에서 스킬 제거
-	CachedAbilitySystemComponent->ClearAbility(SkillSlots[SlotIndex].AbilityHandle);
+	// ASC에서 모든 변형 제거
+	if (SlotVariants.IsValidIndex(SlotIndex))
+	{
+		for (const FGameplayAbilitySpecHandle& Handle : SlotVariants[SlotIndex].Handles)
+		{
+			CachedAbilitySystemComponent->ClearAbility(Handle);
+		}
+		SlotVariants[SlotIndex] = FSkillSlotVariants();
+	}
+	else
+	{
+		CachedAbilitySystemComponent->ClearAbility(SkillSlots[SlotIndex].AbilityHandle);
+	}
 
 	// 슬롯 정보 초기화
 	UE_LOG(LogTemp, Log, TEXT("USkillManagerComponent::UnequipSkill: Unequipped skill from slot %d"), SlotIndex);
 	
 	SkillSlots[SlotIndex].EquippedSkill = nullptr;
+	SkillSlots[SlotIndex].VariantSkills.Reset();
 
 	// FGameplayAbilitySpecHandle()는 유효하지 않은 핸들을 반환
 	// @return INDEX_NONE
@@ -201,8 +282,10 @@ bool USkillManagerComponent::EquipRune(int32 SlotIndex, int32 RuneSlotIndex, UDA
 	// 5. 룬 장착 (배열의 해당 인덱스를 덮어씀)
 	SkillSlots[SlotIndex].RuneSlots[RuneSlotIndex].RuneAsset = RuneData;
 
-	// 초록 룬 캐시 업데이트
+	// 초록 룬 캐시 업데이트 후 활성 변형 전환 (스펙은 그대로)
 	SkillSlots[SlotIndex].UpdateGreenRuneCache();
+	UpdateActiveVariant(SlotIndex);
+	ResolveSlotStats(SlotIndex);
 
 	return true;
 }
@@ -218,33 +301,159 @@ bool USkillManagerComponent::UnequipRune(int32 SlotIndex, int32 RuneSlotIndex)
 	// 해당 칸을 비움 (nullptr)
 	SkillSlots[SlotIndex].RuneSlots[RuneSlotIndex].RuneAsset = nullptr;
 
-	// 초록 룬 캐시 업데이트
+	// 초록 룬 캐시 업데이트 후 활성 변형 전환 (스펙은 그대로)
 	SkillSlots[SlotIndex].UpdateGreenRuneCache();
+	UpdateActiveVariant(SlotIndex);
+	ResolveSlotStats(SlotIndex);
 
 	return true;
 }
 
-float USkillManagerComponent::GetTotalDamageMultiplier(int32 SlotIndex) const
+FGameplayAbilitySpecHandle USkillManagerComponent::GetActiveAbilityHandle(int32 SlotIndex) const
 {
-	if (!IsValidSlotIndex(SlotIndex)) {
-		UE_LOG(LogTemp, Warning, TEXT("GetTotalDamageMultiplier: Invalid SlotIndex %d"), SlotIndex);
-		return 1.0f; // 기본값 반환
+	if (!SlotVariants.IsValidIndex(SlotIndex))
+	{
+		return FGameplayAbilitySpecHandle();
 	}
 
-	// 기본 배율은 1.0 (100%)
-	float TotalMultiplier = 1.0f;
+	const FSkillSlotVariants& Variants = SlotVariants[SlotIndex];
+	return Variants.Handles.IsValidIndex(Variants.ActiveIndex) ? Variants.Handles[Variants.ActiveIndex] : FGameplayAbilitySpecHandle();
+}
 
-	// 해당 스킬 슬롯에 장착된 3개의 룬을 순회
-	for (const FRuneSlot& Slot : SkillSlots[SlotIndex].RuneSlots)
+bool USkillManagerComponent::IsActiveVariant(const FGameplayAbilitySpecHandle& Handle) const
+{
+	for (const FSkillSlotVariants& Variants : SlotVariants)
 	{
-		const UDA_Rune* Rune = Slot.RuneAsset;
-		if (Rune && Rune->RuneTag == TAG_Rune_Red)
+		const int32 VariantIndex = Variants.Handles.IndexOfByKey(Handle);
+		if (VariantIndex != INDEX_NONE)
 		{
-			// 곱셈 방식으로 변경: RuneValue가 2.0이면 2배가 됨
-			TotalMultiplier *= Rune->RuneValue;
+			return VariantIndex == Variants.ActiveIndex;
 		}
 	}
-	return TotalMultiplier;
+
+	// 슬롯 변형이 아닌 스펙 (예: 기본 공격)은 막지 않음
+	return true;
+}
+
+void USkillManagerComponent::OnRep_SlotVariants()
+{
+	// 클라이언트의 슬롯 정보도 활성 변형 핸들로 맞춤
+	for (int32 SlotIndex = 0; SlotIndex < SlotVariants.Num() && SlotIndex < SkillSlots.Num(); ++SlotIndex)
+	{
+		SkillSlots[SlotIndex].AbilityHandle = GetActiveAbilityHandle(SlotIndex);
+		ScheduleCooldownRefresh(SlotIndex);
+	}
+}
+
+void USkillManagerComponent::CollectVariantSkills(int32 SlotIndex, TSubclassOf<UGameplayAbility> SkillClass, TArray<TSubclassOf<UGameplayAbility>>& OutVariants) const
+{
+	OutVariants.Reset();
+
+	auto AddVariant = [&OutVariants, SkillClass](const UDA_Rune* Rune)
+	{
+		if (!Rune || Rune->RuneTag != TAG_Rune_Green || !Rune->OriginalSkillClass || !Rune->ReplacementSkillClass)
+		{
+			return;
+		}
+
+		// 이 스킬을 원본으로 하는 초록 룬만 (활성 인덱스가 1바이트이므로 최대 255개)
+		if (SkillClass->IsChildOf(Rune->OriginalSkillClass) && Rune->ReplacementSkillClass != SkillClass && OutVariants.Num() < MAX_uint8)
+		{
+			OutVariants.AddUnique(Rune->ReplacementSkillClass);
+		}
+	};
+
+	// 1. 룬 데이터 테이블에 있는 모든 초록 룬 (전투 중 어떤 룬으로 바꿔도 미리 부여되어 있도록)
+	if (RuneDataTable)
+	{
+		static const FString ContextString(TEXT("Rune Variant Lookup"));
+		RuneDataTable->ForeachRow<FRuneDataRow>(ContextString, [&AddVariant](const FName& Key, const FRuneDataRow& Row)
+		{
+			AddVariant(Row.RuneAsset);
+		});
+	}
+
+	// 2. 테이블에 없더라도 이미 장착된 초록 룬
+	if (IsValidSlotIndex(SlotIndex))
+	{
+		AddVariant(SkillSlots[SlotIndex].EquippedGreenRune);
+	}
+}
+
+void USkillManagerComponent::UpdateActiveVariant(int32 SlotIndex)
+{
+	// 활성 변형은 서버가 결정하고 복제
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	if (!IsValidSlotIndex(SlotIndex) || !SlotVariants.IsValidIndex(SlotIndex) || SlotVariants[SlotIndex].Handles.Num() == 0)
+	{
+		return;
+	}
+
+	FSkillSlot& SkillSlot = SkillSlots[SlotIndex];
+	FSkillSlotVariants& Variants = SlotVariants[SlotIndex];
+
+	// 1. 장착된 초록 룬에 맞는 변형 찾기 (없으면 기본 스킬)
+	int32 NewIndex = 0;
+	const UDA_Rune* GreenRune = SkillSlot.EquippedGreenRune;
+	if (GreenRune && GreenRune->OriginalSkillClass && GreenRune->ReplacementSkillClass
+		&& SkillSlot.EquippedSkill && SkillSlot.EquippedSkill->IsChildOf(GreenRune->OriginalSkillClass))
+	{
+		int32 VariantIndex = SkillSlot.VariantSkills.IndexOfByKey(GreenRune->ReplacementSkillClass);
+
+		// 장착 시 알 수 없던 초록 룬 (룬 테이블에 없음)은 이 변형만 추가로 부여
+		if (VariantIndex == INDEX_NONE && CachedAbilitySystemComponent && SkillSlot.VariantSkills.Num() < MAX_uint8)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("USkillManagerComponent::UpdateActiveVariant: %s is not in RuneDataTable, granting it now"),
+				*GreenRune->ReplacementSkillClass->GetName());
+
+			VariantIndex = SkillSlot.VariantSkills.Add(GreenRune->ReplacementSkillClass);
+			Variants.Handles.Add(CachedAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(GreenRune->ReplacementSkillClass, 1, SlotIndex, GetOwner())));
+		}
+
+		if (VariantIndex != INDEX_NONE)
+		{
+			NewIndex = VariantIndex + 1;
+		}
+	}
+
+	// 2. 바뀐 경우에만 전환 (교체되는 변형이 실행 중이면 취소)
+	if (Variants.ActiveIndex != NewIndex)
+	{
+		if (CachedAbilitySystemComponent && Variants.Handles.IsValidIndex(Variants.ActiveIndex))
+		{
+			CachedAbilitySystemComponent->CancelAbilityHandle(Variants.Handles[Variants.ActiveIndex]);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[Slot %d] Active skill variant %d -> %d"), SlotIndex, Variants.ActiveIndex, NewIndex);
+		Variants.ActiveIndex = static_cast<uint8>(NewIndex);
+
+		// 변형마다 쿨타임 태그가 다를 수 있으므로 슬롯 쿨타임 다시 계산
+		ScheduleCooldownRefresh(SlotIndex);
+	}
+
+	SkillSlot.AbilityHandle = Variants.Handles[Variants.ActiveIndex];
+}
+
+const FResolvedSkillStats* USkillManagerComponent::GetResolvedStats(int32 SlotIndex) const
+{
+	if (!IsValidSlotIndex(SlotIndex))
+	{
+		return nullptr;
+	}
+	return &SkillSlots[SlotIndex].ResolvedStats;
+}
+
+float USkillManagerComponent::GetTotalDamageMultiplier(int32 SlotIndex) const
+{
+	if (!IsValidSlotIndex(SlotIndex)) {
+		UE_LOG(LogTemp, Warning, TEXT("GetTotalDamageMultiplier: Invalid SlotIndex %d"), SlotIndex);
+		return 1.0f; // 기본값 반환
+	}
+	return SkillSlots[SlotIndex].ResolvedStats.DamageMultiplier;
 }
 
 float USkillManagerComponent::GetTotalCooldownReduction(int32 SlotIndex) const
@@ -253,44 +462,251 @@ float USkillManagerComponent::GetTotalCooldownReduction(int32 SlotIndex) const
 		UE_LOG(LogTemp, Warning, TEXT("GetTotalCooldownReduction: Invalid SlotIndex %d"), SlotIndex);
 		return 0.0f; // 기본값 반환
 	}
+	return SkillSlots[SlotIndex].ResolvedStats.CooldownReduction;
+}
 
-	// 쿨타임 감소량 합계 (0.0에서 시작)
-	float TotalReduction = 0.0f;
+float USkillManagerComponent::GetTotalRangeMultiplier(int32 SlotIndex) const
+{
+	if (!IsValidSlotIndex(SlotIndex)) {
+		UE_LOG(LogTemp, Warning, TEXT("GetTotalRangeMultiplier: Invalid SlotIndex %d"), SlotIndex);
+		return 1.0f; // 기본값 반환
+	}
+	return SkillSlots[SlotIndex].ResolvedStats.RangeMultiplier;
+}
 
-	for (const FRuneSlot& Slot : SkillSlots[SlotIndex].RuneSlots)
+void USkillManagerComponent::ResolveSlotStats(int32 SlotIndex)
+{
+	if (!IsValidSlotIndex(SlotIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ResolveSlotStats: Invalid SlotIndex %d"), SlotIndex);
+		return;
+	}
+
+	FSkillSlot& SkillSlot = SkillSlots[SlotIndex];
+
+	// 기본 배율 1.0 (100%), 쿨타임 감소량 0.0에서 시작
+	float DamageMultiplier = 1.0f;
+	float CooldownReduction = 0.0f;
+	float RangeMultiplier = 1.0f;
+
+	// 해당 스킬 슬롯에 장착된 룬을 한 번만 순회
+	for (const FRuneSlot& Slot : SkillSlot.RuneSlots)
 	{
 		const UDA_Rune* Rune = Slot.RuneAsset;
-		if (Rune && Rune->RuneTag == TAG_Rune_Yellow)
+		if (!Rune)
 		{
-			TotalReduction += Rune->RuneValue;
+			continue;
+		}
+
+		// 곱셈 방식: RuneValue가 2.0이면 2배가 됨
+		if (Rune->RuneTag == TAG_Rune_Red)
+		{
+			DamageMultiplier *= Rune->RuneValue;
+		}
+		else if (Rune->RuneTag == TAG_Rune_Yellow)
+		{
+			CooldownReduction += Rune->RuneValue;
+		}
+		else if (Rune->RuneTag == TAG_Rune_Blue)
+		{
+			RangeMultiplier *= Rune->RuneValue;
 		}
 	}
 
+	SkillSlot.ResolvedStats.DamageMultiplier = DamageMultiplier;
 	// 최대 쿨감 제한 (예: 99% 이상 쿨감 방지)
-	return FMath::Clamp(TotalReduction, 0.0f, 0.99f);
+	SkillSlot.ResolvedStats.CooldownReduction = FMath::Clamp(CooldownReduction, 0.0f, 0.99f);
+	SkillSlot.ResolvedStats.RangeMultiplier = RangeMultiplier;
+	SkillSlot.ResolvedStats.Version = NextStatsVersion++;
 }
 
-float USkillManagerComponent::GetTotalRangeMultiplier(int32 SlotIndex) const
+FSkillCooldownState USkillManagerComponent::GetSlotCooldown(int32 SlotIndex) const
 {
-	if (!IsValidSlotIndex(SlotIndex)) {
-		UE_LOG(LogTemp, Warning, TEXT("GetTotalRangeMultiplier: Invalid SlotIndex %d"), SlotIndex);
-		return 1.0f; // 기본값 반환
+	return SlotCooldowns.IsValidIndex(SlotIndex) ? SlotCooldowns[SlotIndex] : FSkillCooldownState();
+}
+
+float USkillManagerComponent::GetCooldownRemaining(int32 SlotIndex) const
+{
+	const UWorld* World = GetWorld();
+	if (!World || !SlotCooldowns.IsValidIndex(SlotIndex) || SlotCooldowns[SlotIndex].Duration <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	const FSkillCooldownState& Cooldown = SlotCooldowns[SlotIndex];
+	return FMath::Max(0.0f, Cooldown.StartTime + Cooldown.Duration - World->GetTimeSeconds());
+}
+
+void USkillManagerComponent::BindCooldownTracking()
+{
+	if (!CachedAbilitySystemComponent)
+	{
+		return;
 	}
 
-	// 기본 배율 1.0배
-	float TotalMultiplier = 1.0f;
+	CachedAbilitySystemComponent->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &USkillManagerComponent::OnActiveEffectAdded);
+	CachedAbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &USkillManagerComponent::OnActiveEffectRemoved);
 
-	for (const FRuneSlot& Slot : SkillSlots[SlotIndex].RuneSlots)
+	// 바인딩 전에 이미 적용된 쿨타임 반영
+	for (int32 SlotIndex = 0; SlotIndex < SkillSlots.Num(); ++SlotIndex)
 	{
-		const UDA_Rune* Rune = Slot.RuneAsset;
-		if (Rune && Rune->RuneTag == TAG_Rune_Blue)
+		ScheduleCooldownRefresh(SlotIndex);
+	}
+}
+
+void USkillManagerComponent::UnbindCooldownTracking()
+{
+	if (CachedAbilitySystemComponent)
+	{
+		CachedAbilitySystemComponent->OnActiveGameplayEffectAddedDelegateToSelf.RemoveAll(this);
+		CachedAbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().RemoveAll(this);
+	}
+
+	PendingCooldownSlots = 0;
+}
+
+void USkillManagerComponent::OnActiveEffectAdded(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	// 지속 시간이 있는 GE만 쿨타임이 될 수 있음
+	if (Spec.GetDuration() <= 0.0f)
+	{
+		return;
+	}
+
+	FGameplayTagContainer GrantedTags;
+	Spec.GetAllGrantedTags(GrantedTags);
+	ScheduleCooldownRefresh(GrantedTags);
+}
+
+void USkillManagerComponent::OnActiveEffectRemoved(const FActiveGameplayEffect& Effect)
+{
+	if (Effect.GetDuration() <= 0.0f)
+	{
+		return;
+	}
+
+	FGameplayTagContainer GrantedTags;
+	Effect.Spec.GetAllGrantedTags(GrantedTags);
+	ScheduleCooldownRefresh(GrantedTags);
+}
+
+void USkillManagerComponent::ScheduleCooldownRefresh(const FGameplayTagContainer& GrantedTags)
+{
+	if (GrantedTags.IsEmpty())
+	{
+		return;
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < SkillSlots.Num(); ++SlotIndex)
+	{
+		const FGameplayTagContainer* CooldownTags = GetSlotCooldownTags(SlotIndex);
+		if (CooldownTags && GrantedTags.HasAny(*CooldownTags))
+		{
+			ScheduleCooldownRefresh(SlotIndex);
+		}
+	}
+}
+
+void USkillManagerComponent::ScheduleCooldownRefresh(int32 SlotIndex)
+{
+	// 슬롯 마스크는 32비트 (슬롯은 몇 개 안 되므로 충분)
+	if (!IsValidSlotIndex(SlotIndex) || SlotIndex >= 32 || !CachedAbilitySystemComponent)
+	{
+		return;
+	}
+
+	PendingCooldownSlots |= (1u << SlotIndex);
+
+	UWorld* World = GetWorld();
+	if (bCooldownRefreshScheduled || !World)
+	{
+		return;
+	}
+
+	// 같은 프레임의 추가/제거(예측 GE가 서버 GE로 교체되는 경우 등)를 한 번에 처리
+	bCooldownRefreshScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+	{
+		bCooldownRefreshScheduled = false;
+		RefreshPendingCooldowns();
+	}));
+}
+
+void USkillManagerComponent::RefreshPendingCooldowns()
+{
+	const UWorld* World = GetWorld();
+	if (!CachedAbilitySystemComponent || !World)
+	{
+		PendingCooldownSlots = 0;
+		return;
+	}
+
+	if (SlotCooldowns.Num() < SkillSlots.Num())
+	{
+		SlotCooldowns.SetNum(SkillSlots.Num());
+	}
+
+	const float Now = World->GetTimeSeconds();
+
+	for (int32 SlotIndex = 0; SlotIndex < SkillSlots.Num() && PendingCooldownSlots != 0; ++SlotIndex)
+	{
+		const uint32 SlotBit = 1u << SlotIndex;
+		if ((PendingCooldownSlots & SlotBit) == 0)
 		{
-			// 곱셈 방식으로 변경: RuneValue가 2.0이면 2배가 됨
-			TotalMultiplier *= Rune->RuneValue;
+			continue;
 		}
+		PendingCooldownSlots &= ~SlotBit;
+
+		// 1. 슬롯 쿨타임 태그를 가진 GE 중 가장 늦게 끝나는 것 (변경이 있을 때만 한 번 조회)
+		FSkillCooldownState NewState;
+		if (const FGameplayTagContainer* CooldownTags = GetSlotCooldownTags(SlotIndex))
+		{
+			const FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(*CooldownTags);
+			float BestRemaining = 0.0f;
+			for (const TPair<float, float>& RemainingAndDuration : CachedAbilitySystemComponent->GetActiveEffectsTimeRemainingAndDuration(Query))
+			{
+				if (RemainingAndDuration.Key > BestRemaining)
+				{
+					BestRemaining = RemainingAndDuration.Key;
+					NewState.Duration = RemainingAndDuration.Value;
+				}
+			}
+
+			if (BestRemaining > 0.0f && NewState.Duration > 0.0f)
+			{
+				NewState.StartTime = Now - (NewState.Duration - BestRemaining);
+			}
+			else
+			{
+				NewState.Duration = 0.0f;
+			}
+		}
+
+		// 2. 바뀐 경우에만 알림 (같은 GE의 재조회로 생기는 미세한 시간 오차는 무시)
+		FSkillCooldownState& OldState = SlotCooldowns[SlotIndex];
+		const bool bChanged =
+			!FMath::IsNearlyEqual(OldState.Duration, NewState.Duration, 0.01f) ||
+			(NewState.Duration > 0.0f && !FMath::IsNearlyEqual(OldState.StartTime, NewState.StartTime, 0.05f));
+		if (!bChanged)
+		{
+			continue;
+		}
+
+		OldState = NewState;
+		OnCooldownChanged.Broadcast(SlotIndex, NewState);
+	}
+}
+
+const FGameplayTagContainer* USkillManagerComponent::GetSlotCooldownTags(int32 SlotIndex) const
+{
+	if (!CachedAbilitySystemComponent)
+	{
+		return nullptr;
 	}
 
-	return TotalMultiplier;
+	const FGameplayAbilitySpec* Spec = CachedAbilitySystemComponent->FindAbilitySpecFromHandle(GetActiveAbilityHandle(SlotIndex));
+	const FGameplayTagContainer* CooldownTags = (Spec && Spec->Ability) ? Spec->Ability->GetCooldownTags() : nullptr;
+	return (CooldownTags && !CooldownTags->IsEmpty()) ? CooldownTags : nullptr;
 }
 
 bool USkillManagerComponent::IsValidSlotIndex(int32 SlotIndex) const
@@ -0,0 +1,173 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SkillStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_STAT(STAT_SkillPreview);
+DEFINE_STAT(STAT_SkillRangeQuery);
+DEFINE_STAT(STAT_SkillHighlight);
+DEFINE_STAT(STAT_SkillApplyEffects);
+DEFINE_STAT(STAT_SkillSpawn);
+
+DEFINE_STAT(STAT_SkillPreviewUpdates);
+DEFINE_STAT(STAT_SkillRangeQueryBlocks);
+DEFINE_STAT(STAT_SkillHighlightedBlocks);
+DEFINE_STAT(STAT_SkillQueuedEffects);
+DEFINE_STAT(STAT_SkillSpawnedActors);
+
+DEFINE_STAT(STAT_SkillActivations);
+
+#if UE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(SkillChannel);
+
+UE_TRACE_EVENT_BEGIN(Skill, AbilityActivated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SpecHandle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, AbilityName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Skill, AbilityCommitted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SpecHandle)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Skill, AbilityEnded)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SpecHandle)
+	UE_TRACE_EVENT_FIELD(bool, bWasCancelled)
+	UE_TRACE_EVENT_FIELD(double, LifetimeSeconds)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Skill, TargetsHit)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SpecHandle)
+	UE_TRACE_EVENT_FIELD(uint32, NumTargets)
+	UE_TRACE_EVENT_FIELD(uint32, NumBlocks)
+UE_TRACE_EVENT_END()
+
+#endif // UE_TRACE_ENABLED
+
+void FSkillTrace::OutputActivated(const FGameplayAbilitySpecHandle& SpecHandle, const UObject* Ability)
+{
+#if UE_TRACE_ENABLED
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(SkillChannel))
+	{
+		return;
+	}
+
+	const FString AbilityName = Ability ? Ability->GetClass()->GetName() : FString();
+	UE_TRACE_LOG(Skill, AbilityActivated, SkillChannel)
+		<< AbilityActivated.Cycle(FPlatformTime::Cycles64())
+		<< AbilityActivated.SpecHandle(GetTypeHash(SpecHandle))
+		<< AbilityActivated.AbilityName(*AbilityName, AbilityName.Len());
+#endif
+}
+
+void FSkillTrace::OutputCommitted(const FGameplayAbilitySpecHandle& SpecHandle)
+{
+#if UE_TRACE_ENABLED
+	UE_TRACE_LOG(Skill, AbilityCommitted, SkillChannel)
+		<< AbilityCommitted.Cycle(FPlatformTime::Cycles64())
+		<< AbilityCommitted.SpecHandle(GetTypeHash(SpecHandle));
+#endif
+}
+
+void FSkillTrace::OutputEnded(const FGameplayAbilitySpecHandle& SpecHandle, bool bWasCancelled, double LifetimeSeconds)
+{
+#if UE_TRACE_ENABLED
+	UE_TRACE_LOG(Skill, AbilityEnded, SkillChannel)
+		<< AbilityEnded.Cycle(FPlatformTime::Cycles64())
+		<< AbilityEnded.SpecHandle(GetTypeHash(SpecHandle))
+		<< AbilityEnded.bWasCancelled(bWasCancelled)
+		<< AbilityEnded.LifetimeSeconds(LifetimeSeconds);
+#endif
+}
+
+void FSkillTrace::OutputTargetsHit(const FGameplayAbilitySpecHandle& SpecHandle, int32 NumTargets, int32 NumBlocks)
+{
+#if UE_TRACE_ENABLED
+	UE_TRACE_LOG(Skill, TargetsHit, SkillChannel)
+		<< TargetsHit.Cycle(FPlatformTime::Cycles64())
+		<< TargetsHit.SpecHandle(GetTypeHash(SpecHandle))
+		<< TargetsHit.NumTargets(uint32(NumTargets))
+		<< TargetsHit.NumBlocks(uint32(NumBlocks));
+#endif
+}
+
+// 어빌리티 수명 기록 (기본 꺼짐)
+static TAutoConsoleVariable<bool> CVarSkillRecordTimings(
+	TEXT("Skill.RecordTimings"),
+	false,
+	TEXT("어빌리티 클래스별 발동~종료 수명(실제 경과 시간)을 누적합니다. Skill.LogTimings로 출력"),
+	ECVF_Default);
+
+namespace SkillTimingLog
+{
+	struct FEntry
+	{
+		int32 NumEnded = 0;
+		int32 NumCancelled = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+	};
+
+	// 어빌리티는 게임 스레드에서 종료되지만, 콘솔 명령은 다른 스레드에서 들어올 수 있으므로 잠금
+	static FCriticalSection Lock;
+	static TMap<FName, FEntry> Entries;
+}
+
+void FSkillTimingLog::RecordEnded(const UObject* Ability, bool bWasCancelled, double LifetimeSeconds)
+{
+	if (!Ability || !CVarSkillRecordTimings.GetValueOnAnyThread())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&SkillTimingLog::Lock);
+	SkillTimingLog::FEntry& Entry = SkillTimingLog::Entries.FindOrAdd(Ability->GetClass()->GetFName());
+	++Entry.NumEnded;
+	Entry.NumCancelled += bWasCancelled ? 1 : 0;
+	Entry.TotalSeconds += LifetimeSeconds;
+	Entry.MaxSeconds = FMath::Max(Entry.MaxSeconds, LifetimeSeconds);
+}
+
+void FSkillTimingLog::LogSummary()
+{
+	FScopeLock ScopeLock(&SkillTimingLog::Lock);
+
+	// 실행마다 같은 순서로 출력되도록 클래스 이름 순 정렬
+	TArray<FName> Names;
+	SkillTimingLog::Entries.GetKeys(Names);
+	Names.Sort(FNameLexicalLess());
+
+	UE_LOG(LogTemp, Display, TEXT("SkillTimings: %d ability classes"), Names.Num());
+	for (const FName& Name : Names)
+	{
+		const SkillTimingLog::FEntry& Entry = SkillTimingLog::Entries.FindChecked(Name);
+		UE_LOG(LogTemp, Display, TEXT("SkillTimings: %s Ended=%d Cancelled=%d AvgLifetimeSec=%.3f MaxLifetimeSec=%.3f"),
+			*Name.ToString(),
+			Entry.NumEnded,
+			Entry.NumCancelled,
+			Entry.NumEnded > 0 ? Entry.TotalSeconds / Entry.NumEnded : 0.0,
+			Entry.MaxSeconds);
+	}
+}
+
+void FSkillTimingLog::Reset()
+{
+	FScopeLock ScopeLock(&SkillTimingLog::Lock);
+	SkillTimingLog::Entries.Reset();
+}
+
+static FAutoConsoleCommand SkillLogTimingsCommand(
+	TEXT("Skill.LogTimings"),
+	TEXT("Skill.RecordTimings로 누적한 어빌리티 클래스별 수명을 로그로 출력합니다."),
+	FConsoleCommandDelegate::CreateStatic(&FSkillTimingLog::LogSummary));
+
+static FAutoConsoleCommand SkillResetTimingsCommand(
+	TEXT("Skill.ResetTimings"),
+	TEXT("누적한 어빌리티 수명을 초기화합니다."),
+	FConsoleCommandDelegate::CreateStatic(&FSkillTimingLog::Reset));
@@ -0,0 +1,29 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Task/AbilityTask_SkillPreview.h"
+#include "GA/GA_SkillBase.h"
+
+UAbilityTask_SkillPreview::UAbilityTask_SkillPreview(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// 매 프레임 TickTask 호출
+	bTickingTask = true;
+}
+
+UAbilityTask_SkillPreview* UAbilityTask_SkillPreview::CreateSkillPreviewTask(UGA_SkillBase* OwningAbility)
+{
+	UAbilityTask_SkillPreview* Task = NewAbilityTask<UAbilityTask_SkillPreview>(OwningAbility);
+	Task->OwningSkill = OwningAbility;
+	return Task;
+}
+
+void UAbilityTask_SkillPreview::TickTask(float DeltaTime)
+{
+	Super::TickTask(DeltaTime);
+
+	if (UGA_SkillBase* Skill = OwningSkill.Get())
+	{
+		Skill->TickPreview();
+	}
+}
@@ -0,0 +1,26 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Task/AbilityTask_SkillTick.h"
+
+UAbilityTask_SkillTick::UAbilityTask_SkillTick(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// 매 프레임 TickTask 호출
+	bTickingTask = true;
+}
+
+UAbilityTask_SkillTick* UAbilityTask_SkillTick::CreateSkillTickTask(UGameplayAbility* OwningAbility)
+{
+	return NewAbilityTask<UAbilityTask_SkillTick>(OwningAbility);
+}
+
+void UAbilityTask_SkillTick::TickTask(float DeltaTime)
+{
+	Super::TickTask(DeltaTime);
+
+	if (ShouldBroadcastAbilityTaskDelegates())
+	{
+		OnTick.Broadcast(DeltaTime);
+	}
+}
@@ -0,0 +1,200 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+
+// 테스트 전용 타입(SkillTestTypes.h)은 에디터 데이터가 있는 빌드에만 포함됨
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITORONLY_DATA
+
+#include "Tests/SkillTestTypes.h"
+#include "CursorTargetingComponent.h"
+#include "InputBindingRegistryComponent.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemTestPawn.h"
+#include "AbilitySystemTestAttributeSet.h"
+#include "Block/DestructibleBlock.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Grid/BlockFieldGenerator.h"
+#include "Combat/EffectQueueSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "InputCoreTypes.h"
+
+namespace SkillAutomationTests
+{
+	// 한 번의 시나리오 실행 결과
+	struct FDestructionRunResult
+	{
+		uint32 InitialHash = 0;
+		uint32 FinalHash = 0;
+		TArray<FString> Events;
+	};
+
+	/**
+	 * 시드 지형 위에서 파괴 스킬을 한 번 시전하고 결과를 기록
+	 * 월드를 틱하지 않으므로 블록 낙하와 큐의 프레임 끝 적용이 끼어들지 않고, 같은 시드면 항상 같은 결과가 나온다.
+	 * 시전자는 셀 (0, 0, 0), 지형은 (1, -1, 0)부터 3x3 기둥, 커서는 +X 방향의 (3, 0, 0)에 고정한다.
+	 * 파괴 박스(기본 BoxExtent)는 시전자 앞의 바닥 셀 (1, 0, 0), (2, 0, 0)과 겹친다.
+	 * @param Test: 검사 결과를 기록할 테스트
+	 * @param Seed: 지형 시드
+	 * @param OutResult: 해시와 이벤트 순서
+	 * @return 시나리오를 끝까지 실행했으면 true
+	 */
+	bool RunDestructionScenario(FAutomationTestBase& Test, int32 Seed, FDestructionRunResult& OutResult)
+	{
+		// 1. 게임 월드 생성
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		ON_SCOPE_EXIT
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		};
+
+		UBlockGridSubsystem* Grid = World->GetSubsystem<UBlockGridSubsystem>();
+		UEffectQueueSubsystem* EffectQueue = UEffectQueueSubsystem::Get(World);
+		if (!Test.TestNotNull(TEXT("BlockGridSubsystem"), Grid) || !Test.TestNotNull(TEXT("EffectQueueSubsystem"), EffectQueue))
+		{
+			return false;
+		}
+
+		// 2. 시드 지형 생성
+		BlockFieldGenerator::FBlockFieldParams Params;
+		Params.OriginCell = FIntVector(1, -1, 0);
+		Params.SizeX = 3;
+		Params.SizeY = 3;
+		Params.MaxHeight = 3;
+		Params.Seed = Seed;
+
+		const int32 NumSpawned = BlockFieldGenerator::SpawnBlockField(World, ADestructibleBlock::StaticClass(), Params);
+		Test.TestTrue(TEXT("Field spawned at least one block per column"), NumSpawned >= Params.SizeX * Params.SizeY);
+		OutResult.InitialHash = Grid->GetStateHash();
+
+		// 3. 시전자와 대상 생성
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		APlayerController* PC = World->SpawnActor<APlayerController>(SpawnParams);
+		AAbilitySystemTestPawn* Caster = World->SpawnActor<AAbilitySystemTestPawn>(Grid->CellToWorld(FIntVector(0, 0, 0)), FRotator::ZeroRotator, SpawnParams);
+		AAbilitySystemTestPawn* Target = World->SpawnActor<AAbilitySystemTestPawn>(Grid->CellToWorld(FIntVector(1, 0, 0)), FRotator::ZeroRotator, SpawnParams);
+		if (!Test.TestNotNull(TEXT("PlayerController"), PC) || !Test.TestNotNull(TEXT("Caster"), Caster) || !Test.TestNotNull(TEXT("Target"), Target))
+		{
+			return false;
+		}
+
+		PC->Possess(Caster);
+		UAbilitySystemComponent* CasterASC = Caster->GetAbilitySystemComponent();
+		UAbilitySystemComponent* TargetASC = Target->GetAbilitySystemComponent();
+		CasterASC->InitAbilityActorInfo(Caster, Caster);
+		TargetASC->InitAbilityActorInfo(Target, Target);
+
+		const FGameplayAttribute HealthAttribute(FindFieldChecked<FProperty>(UAbilitySystemTestAttributeSet::StaticClass(), GET_MEMBER_NAME_CHECKED(UAbilitySystemTestAttributeSet, Health)));
+		const float InitialHealth = TargetASC->GetNumericAttribute(HealthAttribute);
+
+		// 4. 어빌리티 부여
+		const FGameplayAbilitySpecHandle Handle = CasterASC->GiveAbility(FGameplayAbilitySpec(USkillTestDestruction::StaticClass(), 1));
+		const float ExpectedDamage = GetDefault<USkillTestDestruction>()->GetTestBaseDamage();
+
+		// 5. 이벤트 순서 기록
+		TArray<FString>& Events = OutResult.Events;
+		const FDelegateHandle ActivatedHandle = CasterASC->AbilityActivatedCallbacks.AddLambda([&Events](UGameplayAbility*) { Events.Add(TEXT("Activated")); });
+		const FDelegateHandle CommittedHandle = CasterASC->AbilityCommittedCallbacks.AddLambda([&Events](UGameplayAbility*) { Events.Add(TEXT("Committed")); });
+		const FDelegateHandle EndedHandle = CasterASC->AbilityEndedCallbacks.AddLambda([&Events](UGameplayAbility*) { Events.Add(TEXT("Ended")); });
+		// 블록 제거 순서는 그리드 래스터화 순서를 따르므로 종류만 기록하고, 제거된 셀은 7단계에서 검사
+		const FDelegateHandle GridHandle = Grid->OnBlockEvent.AddLambda([&Events](const FBlockGridEvent& Event)
+		{
+			if (Event.Type == EBlockGridEventType::Removed)
+			{
+				Events.Add(TEXT("Removed"));
+			}
+		});
+
+		// 6. 커서 타겟 고정 후 발동, 좌클릭으로 확정
+		FCursorTargetData CursorTarget;
+		CursorTarget.Cell = FIntVector(3, 0, 0);
+		CursorTarget.FaceNormal = FIntVector(0, 0, 1);
+		CursorTarget.HitResult.bBlockingHit = true;
+		CursorTarget.HitResult.Location = Grid->CellToWorld(CursorTarget.Cell);
+		CursorTarget.HitResult.ImpactPoint = CursorTarget.HitResult.Location;
+
+		UCursorTargetingComponent* Targeting = UCursorTargetingComponent::FindOrAdd(PC);
+		UInputBindingRegistryComponent* Registry = UInputBindingRegistryComponent::FindOrAdd(PC);
+		if (!Test.TestNotNull(TEXT("CursorTargetingComponent"), Targeting) || !Test.TestNotNull(TEXT("InputBindingRegistryComponent"), Registry))
+		{
+			return false;
+		}
+		Targeting->SetTargetOverride(CursorTarget);
+
+		Test.TestTrue(TEXT("Ability activated"), CasterASC->TryActivateAbility(Handle));
+		Test.TestEqual(TEXT("Left click bound while previewing"), Registry->GetNumActiveBindings(), 1);
+		Test.TestTrue(TEXT("Left click reached the ability"), Registry->SimulateKeyPress(EKeys::LeftMouseButton));
+		Test.TestEqual(TEXT("Left click unbound after the ability ended"), Registry->GetNumActiveBindings(), 0);
+
+		// 7. 블록 피해는 즉시, 대상 GE는 큐를 비운 뒤에 반영
+		Test.TestFalse(TEXT("Floor cell (1,0,0) destroyed"), Grid->IsCellOccupied(FIntVector(1, 0, 0)));
+		Test.TestFalse(TEXT("Floor cell (2,0,0) destroyed"), Grid->IsCellOccupied(FIntVector(2, 0, 0)));
+		Test.TestTrue(TEXT("Cell beside the destruction box untouched"), Grid->IsCellOccupied(FIntVector(1, 1, 0)));
+		Test.TestEqual(TEXT("Target health unchanged before the effect queue flush"), TargetASC->GetNumericAttribute(HealthAttribute), InitialHealth);
+
+		EffectQueue->Flush();
+		Test.TestEqual(TEXT("Target damaged once by the base damage"), TargetASC->GetNumericAttribute(HealthAttribute), InitialHealth - ExpectedDamage);
+		Test.TestEqual(TEXT("Cooldown applied once"), CasterASC->GetGameplayEffectCount(USkillTestCooldownEffect::StaticClass(), nullptr), 1);
+
+		OutResult.FinalHash = Grid->GetStateHash();
+
+		// 8. 정리 (월드 파괴 중 콜백이 지역 변수를 참조하지 않도록)
+		Targeting->ClearTargetOverride();
+		CasterASC->AbilityActivatedCallbacks.Remove(ActivatedHandle);
+		CasterASC->AbilityCommittedCallbacks.Remove(CommittedHandle);
+		CasterASC->AbilityEndedCallbacks.Remove(EndedHandle);
+		Grid->OnBlockEvent.Remove(GridHandle);
+		return true;
+	}
+}
+
+// 시드 지형에서 파괴 스킬을 시전하고 그리드 해시, 대상 체력, 어빌리티 이벤트 순서를 검사
+// 같은 시드로 두 번 실행해 결과 해시가 같은지(재현 가능성)도 확인한다.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkillDestructionSeededFieldTest, "Winter2025.Skill.Destruction.SeededField",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSkillDestructionSeededFieldTest::RunTest(const FString& Parameters)
+{
+	// 테스트 폰은 ISkillManagerProvider가 없으므로 룬 없이 기본 수치를 사용한다는 경고가 나옴
+	AddExpectedMessage(TEXT("does not implement ISkillManagerProvider"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 0, false);
+
+	const int32 Seed = 2025;
+
+	SkillAutomationTests::FDestructionRunResult FirstRun;
+	if (!SkillAutomationTests::RunDestructionScenario(*this, Seed, FirstRun))
+	{
+		return false;
+	}
+
+	const TArray<FString> ExpectedEvents = {
+		TEXT("Activated"),
+		TEXT("Committed"),
+		TEXT("Removed"),
+		TEXT("Removed"),
+		TEXT("Ended")
+	};
+	TestEqual(TEXT("Ability event order"), FString::Join(FirstRun.Events, TEXT(", ")), FString::Join(ExpectedEvents, TEXT(", ")));
+	TestNotEqual(TEXT("Grid state changed by the skill"), FirstRun.FinalHash, FirstRun.InitialHash);
+
+	SkillAutomationTests::FDestructionRunResult SecondRun;
+	if (!SkillAutomationTests::RunDestructionScenario(*this, Seed, SecondRun))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Same seed gives the same field"), SecondRun.InitialHash, FirstRun.InitialHash);
+	TestEqual(TEXT("Same seed gives the same result"), SecondRun.FinalHash, FirstRun.FinalHash);
+	TestEqual(TEXT("Same seed gives the same event order"), FString::Join(SecondRun.Events, TEXT(", ")), FString::Join(FirstRun.Events, TEXT(", ")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_EDITORONLY_DATA
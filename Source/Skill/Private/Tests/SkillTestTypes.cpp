@@ -0,0 +1,42 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Tests/SkillTestTypes.h"
+
+#if WITH_EDITORONLY_DATA
+
+#include "AbilitySystemTestAttributeSet.h"
+#include "GA/GA_SkillBase.h"
+
+USkillTestDamageEffect::USkillTestDamageEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat DamageMagnitude;
+	DamageMagnitude.DataTag = TAG_Data_Damage;
+
+	FGameplayModifierInfo HealthModifier;
+	HealthModifier.Attribute = FGameplayAttribute(FindFieldChecked<FProperty>(UAbilitySystemTestAttributeSet::StaticClass(), GET_MEMBER_NAME_CHECKED(UAbilitySystemTestAttributeSet, Health)));
+	HealthModifier.ModifierOp = EGameplayModOp::Additive;
+	HealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(DamageMagnitude);
+	Modifiers.Add(HealthModifier);
+}
+
+USkillTestCooldownEffect::USkillTestCooldownEffect()
+{
+	FSetByCallerFloat CooldownMagnitude;
+	CooldownMagnitude.DataTag = TAG_Data_Cooldown;
+
+	DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	DurationMagnitude = FGameplayEffectModifierMagnitude(CooldownMagnitude);
+}
+
+USkillTestDestruction::USkillTestDestruction()
+{
+	DamageEffect = USkillTestDamageEffect::StaticClass();
+	CooldownGameplayEffectClass = USkillTestCooldownEffect::StaticClass();
+
+	// 기본값(10)과 다른 값으로 테이블/룬 없이 기본 피해가 그대로 쓰였는지 확인
+	BaseDamage = 25.0f;
+}
+
+#endif // WITH_EDITORONLY_DATA
@@ -0,0 +1,53 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GA/GA_Destruction.h"
+#include "SkillTestTypes.generated.h"
+
+/**
+ * 스킬 자동화 테스트(SkillAutomationTests.cpp) 전용 타입
+ * UHT는 UCLASS를 감싸는 전처리 조건으로 WITH_EDITORONLY_DATA만 허용하므로,
+ * WITH_DEV_AUTOMATION_TESTS 대신 WITH_EDITORONLY_DATA로 감싸 쿠킹된 게임/Shipping 빌드에서는 빠지게 한다.
+ * 에셋 없이 실행되도록 모든 설정을 생성자에서 채운다.
+ * 대상 어트리뷰트는 엔진 테스트용 UAbilitySystemTestAttributeSet(AAbilitySystemTestPawn)을 사용한다.
+ */
+
+#if WITH_EDITORONLY_DATA
+
+// 스킬 데미지(SetByCaller Data.Skill.Damage, 음수로 전달됨)를 Health에 더하는 즉시 GE
+UCLASS(NotBlueprintable, HideDropdown)
+class USkillTestDamageEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	USkillTestDamageEffect();
+};
+
+// 지속 시간을 SetByCaller Data.Skill.Cooldown으로 받는 쿨타임 GE
+UCLASS(NotBlueprintable, HideDropdown)
+class USkillTestCooldownEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	USkillTestCooldownEffect();
+};
+
+// 테스트 GE를 사용하는 파괴 스킬 (박스 크기, 거리는 UGA_Destruction 기본값)
+UCLASS(NotBlueprintable, HideDropdown)
+class USkillTestDestruction : public UGA_Destruction
+{
+	GENERATED_BODY()
+
+public:
+	USkillTestDestruction();
+
+	// 테스트가 기대값을 계산할 때 사용
+	float GetTestBaseDamage() const { return BaseDamage; }
+};
+
+#endif // WITH_EDITORONLY_DATA
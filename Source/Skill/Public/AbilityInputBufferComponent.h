@@ -0,0 +1,103 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "AbilityInputBufferComponent.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FGameplayAbilitySpec;
+
+/**
+ * 스킬 입력 버퍼 컴포넌트
+ * 다른 스킬 시전 중(State.Casting)에 눌린 스킬 입력은 ActivationBlockedTags 때문에 발동되지 않고 버려진다.
+ * 이 컴포넌트는 그런 입력을 눌린 시각과 함께 최대 MaxBufferedInputs개까지 보관했다가,
+ * 시전 태그가 제거되거나(NotifySkillCastFinished) 스킬이 끝나면 BufferWindow 안의 입력을 다시 발동한다.
+ * 재시도 순서와 버릴 입력은 각 스킬의 입력 버퍼 설정(UGA_SkillBase)을 따른다.
+ * @note 로컬 조종 캐릭터의 입력 핸들러에서만 사용한다. 발동은 일반 입력과 같이 로컬 예측으로 처리된다.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SKILL_API UAbilityInputBufferComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAbilityInputBufferComponent();
+
+	// ASC의 시전 태그와 스킬 발동/종료 이벤트를 구독 (ASC 초기화 후 호출)
+	// @param InASC: 입력을 전달할 ASC
+	void InitializeWithAbilitySystem(UAbilitySystemComponent* InASC);
+
+	// 스킬 입력 눌림 처리
+	// ASC에 그대로 전달하고, 시전 중이라 발동하지 못한 입력이면 버퍼에 보관
+	// @param InputID: 스킬 슬롯 InputID
+	void HandleInputPressed(int32 InputID);
+
+	// 보관 중인 입력을 모두 버림
+	void ClearBuffer();
+
+	// 보관 중인 입력 수 (만료된 입력 포함)
+	int32 GetNumBufferedInputs() const { return BufferedInputs.Num(); }
+
+	// 입력을 보관하는 시간 (초). 이 시간이 지난 입력은 다시 발동하지 않음
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input Buffer", meta = (ClampMin = "0.0"))
+	float BufferWindow = 0.4f;
+
+	// 동시에 보관하는 최대 입력 수 (넘치면 우선순위가 가장 낮고 오래된 입력부터 버림)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input Buffer", meta = (ClampMin = "1"))
+	int32 MaxBufferedInputs = 3;
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	// 보관된 입력 하나
+	struct FBufferedAbilityInput
+	{
+		int32 InputID = INDEX_NONE;
+		double PressTime = 0.0;
+		int32 Priority = 0;
+	};
+
+	// 입력 보관 (같은 InputID가 이미 있으면 시각만 갱신)
+	void BufferInput(int32 InputID, int32 Priority);
+
+	// 입력 슬롯에서 현재 입력을 받는 스펙 (초록 룬 변형이 같은 InputID를 공유하므로 활성 변형을 선택)
+	const FGameplayAbilitySpec* FindSlotSpec(int32 InputID) const;
+
+	// 시전 태그 개수 변경 (0이 되면 버퍼 재시도 예약)
+	void OnCastingTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+	// 스킬 발동/종료 콜백
+	void OnAbilityActivated(UGameplayAbility* Ability);
+	void OnAbilityEnded(UGameplayAbility* Ability);
+
+	// 다음 틱에 버퍼 재시도 (태그 제거 콜백 안에서 바로 다른 스킬을 발동하지 않도록)
+	void ScheduleFlush();
+
+	// 보관된 입력 중 우선순위가 가장 높은 입력부터 발동 시도 (하나가 발동되면 멈춤)
+	void FlushBuffer();
+
+	// BufferWindow가 지난 입력 제거
+	void RemoveExpiredInputs();
+
+	// 현재 시각 (초)
+	double GetNow() const;
+
+	// 구독 해제
+	void UnbindAbilitySystem();
+
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+
+	TArray<FBufferedAbilityInput, TInlineAllocator<4>> BufferedInputs;
+
+	FDelegateHandle CastingTagHandle;
+	FDelegateHandle AbilityActivatedHandle;
+	FDelegateHandle AbilityEndedHandle;
+
+	// 다음 틱 재시도가 이미 예약되었는지
+	bool bFlushScheduled = false;
+};
@@ -0,0 +1,93 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/HitResult.h"
+#include "CursorTargetingComponent.generated.h"
+
+class APlayerController;
+
+/**
+ * 한 프레임의 커서 타겟팅 결과
+ * 모든 스킬이 같은 프레임에 같은 값을 읽도록 UCursorTargetingComponent가 캐싱한다.
+ */
+USTRUCT(BlueprintType)
+struct SKILL_API FCursorTargetData
+{
+	GENERATED_BODY()
+
+	// 커서 아래 트레이스 결과 (HitResult.GetActor()가 히트 액터)
+	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
+	FHitResult HitResult;
+
+	// 커서가 가리키는 셀. 블록을 가리키면 블록의 셀, 아니면 히트 지점의 셀
+	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
+	FIntVector Cell = FIntVector::ZeroValue;
+
+	// 히트한 면의 축 정렬 법선 (블록 면 기준 (±1,0,0), (0,±1,0), (0,0,±1))
+	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
+	FIntVector FaceNormal = FIntVector::ZeroValue;
+
+	// 커서 광선과 폰 높이의 수평면이 만나는 지점 (허공을 가리켜도 조준 방향을 구할 수 있음)
+	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
+	FVector GroundPoint = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
+	bool bHasGroundPoint = false;
+
+	bool HasHit() const { return HitResult.bBlockingHit; }
+	AActor* GetHitActor() const { return HitResult.GetActor(); }
+};
+
+/**
+ * 커서 타겟팅 컴포넌트
+ * 로컬 플레이어 컨트롤러에 하나 붙어서 커서 역투영과 트레이스를 프레임당 한 번만 수행한다.
+ * 스킬과 캐릭터는 직접 GetHitResultUnderCursor를 호출하지 않고 GetCursorTarget으로 읽는다.
+ * 첫 요청이 들어온 프레임에만 계산하므로 Tick을 사용하지 않는다.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SKILL_API UCursorTargetingComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCursorTargetingComponent();
+
+	// 컨트롤러에 붙은 타겟팅 컴포넌트를 찾고, 없으면 생성해서 붙인다
+	// 로컬 컨트롤러가 아니면 커서가 없으므로 nullptr 반환
+	// @param PC: 대상 플레이어 컨트롤러
+	static UCursorTargetingComponent* FindOrAdd(APlayerController* PC);
+
+	// 이번 프레임의 커서 타겟팅 결과 반환. 채널별로 프레임당 한 번만 트레이스
+	// @param TraceChannel: 커서 트레이스 채널
+	const FCursorTargetData& GetCursorTarget(ECollisionChannel TraceChannel = ECC_Visibility);
+
+	// 커서 타겟 고정 (자동화 테스트, 재현용)
+	// 설정된 동안 GetCursorTarget은 트레이스 없이 모든 채널에서 이 값을 반환한다.
+	// @param InTarget: 고정할 타겟팅 결과
+	void SetTargetOverride(const FCursorTargetData& InTarget);
+
+	// 커서 타겟 고정 해제 (다음 요청부터 다시 트레이스)
+	void ClearTargetOverride();
+
+	bool HasTargetOverride() const { return bHasTargetOverride; }
+
+private:
+	// 역투영, 트레이스, 셀/면/지면 교차점 계산
+	void ComputeCursorTarget(ECollisionChannel TraceChannel, FCursorTargetData& OutData) const;
+
+	// 채널별 캐시 (대부분 ECC_Visibility 하나만 사용)
+	struct FChannelCache
+	{
+		ECollisionChannel Channel = ECC_Visibility;
+		uint64 FrameNumber = 0;
+		FCursorTargetData Data;
+	};
+	TArray<FChannelCache, TInlineAllocator<2>> ChannelCaches;
+
+	// 고정된 커서 타겟
+	FCursorTargetData TargetOverride;
+	bool bHasTargetOverride = false;
+};
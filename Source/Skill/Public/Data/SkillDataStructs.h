@@ -39,6 +39,51 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats")
 	float BaseRange = 1.0f;
 
+	// 블록 한 칸에 주는 기본 피해량 (0 이하면 GA 기본값 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats")
+	float BaseBlockDamage = 0.0f;
+
+	// 사용 범위 (XY 반지름, 0 이하면 GA 기본값 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats")
+	float RangeXY = 0.0f;
+
+	// 사용 범위 (Z 위아래, 0 이하면 GA 기본값 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats")
+	float RangeZ = 0.0f;
+
+	/**
+	 * 스킬별 수치
+	 * 0 이하면 해당 GA의 기본값을 그대로 사용
+	 */
+
+	// 방벽 돌진 속도 (GA_SummonBarrier)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	float ChargeSpeed = 0.0f;
+
+	// 방벽 최대 돌진 거리 (GA_SummonBarrier)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	float MaxChargeDistance = 0.0f;
+
+	// 방벽 가로 칸 수 (GA_SummonBarrier)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	int32 BarrierWidth = 0;
+
+	// 방벽 층 수 (GA_SummonBarrier)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	int32 BarrierHeight = 0;
+
+	// 회전 지속 시간 (GA_SpinDestruction)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	float SpinDuration = 0.0f;
+
+	// 회전 반지름 (GA_SpinDestruction)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	float SpinRadius = 0.0f;
+
+	// 회전 데미지 주기 (GA_SpinDestruction)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill Stats|Specific")
+	float DamageTickInterval = 0.0f;
+
 	// 스킬 설명 (UI용)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	FText Description;
@@ -46,4 +91,13 @@ public:
 	// 스킬 아이콘 (UI용)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	TObjectPtr<UTexture2D> SkillIcon;
+
+	// 수치가 허용 범위 안인지 검사
+	// @param RowName: 오류 메시지에 표시할 행 이름
+	// @param OutErrors: 범위를 벗어난 항목 설명 (추가만 함)
+	// @return 모든 값이 허용 범위 안이면 true
+	bool Validate(FName RowName, TArray<FString>& OutErrors) const;
+
+	// 범위를 벗어난 값을 허용 범위로 보정
+	void ClampToValidRange();
 };
@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Data/SkillDataStructs.h"
+#include "SkillDataSubsystem.generated.h"
+
+class UDataTable;
+class UGameplayAbility;
+
+// 스킬 데이터 캐시가 다시 만들어졌을 때 (테이블 교체 또는 에디터에서 테이블 수정)
+DECLARE_MULTICAST_DELEGATE(FOnSkillDataChanged);
+
+/**
+ * 스킬 정의 테이블(FSkillDataRow) 캐시 서브시스템
+ * 테이블을 한 번 읽어 평탄한 배열로 보관하고, 행 이름(ID)과 스킬 클래스로 인덱스를 찾는다.
+ * 각 UGA_SkillBase는 발동할 때 DataVersion을 비교해 바뀐 경우에만 값을 다시 반영한다.
+ * 에디터에서는 테이블 수정 이벤트를 구독하므로 PIE 도중 밸런스를 고쳐도 다음 발동부터 바로 적용된다.
+ * 범위를 벗어난 값은 경고를 남기고 허용 범위로 보정해 캐시에 넣는다.
+ */
+UCLASS()
+class SKILL_API USkillDataSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// 사용할 스킬 정의 테이블 지정 (같은 테이블이면 아무것도 하지 않음)
+	// @param InTable: FSkillDataRow 행 구조의 데이터 테이블
+	void SetSkillDataTable(UDataTable* InTable);
+
+	// 행 이름(ID)으로 스킬 데이터 검색
+	// @return 없으면 nullptr
+	const FSkillDataRow* FindSkillData(FName SkillID) const;
+
+	// 스킬 클래스로 검색 (블루프린트 자식 클래스면 부모 클래스 순으로 검색)
+	// @return 없으면 nullptr
+	const FSkillDataRow* FindSkillDataByClass(const UClass* AbilityClass) const;
+
+	// 캐시가 다시 만들어질 때마다 증가하는 번호 (0이면 아직 테이블 없음)
+	int32 GetDataVersion() const { return DataVersion; }
+
+	// 캐시가 다시 만들어졌을 때 호출
+	FOnSkillDataChanged OnSkillDataChanged;
+
+	// 월드 컨텍스트로 서브시스템을 찾는 헬퍼
+	static USkillDataSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+	// 테이블을 읽어 평탄한 캐시를 다시 만듦
+	void RebuildCache();
+
+	// 에디터에서 테이블이 수정되었을 때 호출
+	void HandleTableChanged();
+
+	// 테이블 수정 이벤트 구독 해제
+	void UnbindTableChanged();
+
+	UPROPERTY()
+	TObjectPtr<UDataTable> SkillDataTable;
+
+	// 평탄한 스킬 데이터 (인덱스 = IndexByID, IndexByClass의 값)
+	UPROPERTY()
+	TArray<FSkillDataRow> Rows;
+
+	TMap<FName, int32> IndexByID;
+	TMap<const UClass*, int32> IndexByClass;
+
+	int32 DataVersion = 0;
+
+	FDelegateHandle TableChangedHandle;
+};
@@ -6,15 +6,15 @@
 #include "GA/GA_SkillBase.h"
 #include "GA_BuffBarrier.generated.h"
 
-//    ± 
-UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_BuffBarrier_Phase1); // ٴڿ  ǥ 
-UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_BuffBarrier_Phase2); //  ȯ 
+// 페이즈 관리를 위한 태그 선언
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_BuffBarrier_Phase1); // 바닥에 범위를 표시한 상태
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_BuffBarrier_Phase2); // 블록을 소환한 상태
 
 /**
- * 3ܰ  ߵǴ /庮 ų
- * 1. ų   ٴڿ  ǥ
- * 2. ڸ     
- * 3.    Ÿ 
+ * 3단계로 나뉘어 발동되는 버프/장벽 스킬
+ * 1. 스킬 사용 시 바닥에 범위 표시
+ * 2. 가장자리 벽 생성 및 버프 적용
+ * 3. 벽 제거 및 쿨타임 적용
  */
 UCLASS()
 class SKILL_API UGA_BuffBarrier : public UGA_SkillBase
@@ -37,15 +37,15 @@ public:
 		bool bWasCancelled) override;
 
 protected:
-	//    Ŭ
+	// 생성할 벽 블록 클래스
 	UPROPERTY(EditDefaultsOnly, Category = "Skill|Barrier")
 	TSubclassOf<class ABlockBase> WallBlockClass;
 
-	//   GE
+	// 적용할 버프 GE
 	UPROPERTY(EditDefaultsOnly, Category = "Skill|Barrier")
 	TSubclassOf<class UGameplayEffect> BuffEffectClass;
 
-	// ڵ ȯ ð (⺻ 3)
+	// 자동 전환 시간 (기본 3초)
 	UPROPERTY(EditDefaultsOnly, Category = "Skill|Barrier")
 	float AutoTransitionTime = 3.0f;
 
@@ -55,41 +55,41 @@ protected:
 	UPROPERTY()
 	TWeakObjectPtr<UAbilitySystemComponent> CachedASC;
 
-	//     ˻ ø  ̵
+	// 페이즈 진행 중 비용 검사 무시를 위해 오버라이드
 	virtual bool CheckCost(const FGameplayAbilitySpecHandle Handle,
 		const FGameplayAbilityActorInfo* ActorInfo,
 		FGameplayTagContainer* OptionalRelevantTags) const override;
 
 private:
-	// 1ܰ迡 ã ٴ ϵ (InstancedPerActor å   )
+	// 1단계에서 찾은 바닥 블록들 (InstancedPerActor 정책으로 인해 데이터 유지됨)
 	UPROPERTY()
 	TArray<class ABlockBase*> HighlightedBlocks;
 
-	// 2ܰ迡   ϵ
+	// 2단계에서 생성한 벽 블록들
 	UPROPERTY()
 	TArray<class ABlockBase*> SpawnedWalls;
 
-	// ڵ ȯ  Ÿ̸ ڵ
+	// 자동 전환을 위한 타이머 핸들
 	FTimerHandle AutoTransitionTimerHandle;
 
-	// ---   Լ ---
+	// --- 내부 로직 함수들 ---
 
-	// 1ܰ:  ǥ 
+	// 1단계: 범위 표시 로직
 	void ExecutePhase1_Highlight();
 
-	// 2ܰ:     
+	// 2단계: 벽 생성 및 버프 로직
 	void ExecutePhase2_Deploy();
 
-	// 3ܰ:   Ÿ 
+	// 3단계: 해제 및 쿨타임 로직
 	void ExecutePhase3_Cleanup();
 
-	// Ÿ̸ӿ  ȣǾ  ܰ踦 ڵ ϴ Լ
+	// 타이머에 의해 호출되어 다음 단계를 자동 실행하는 함수
 	UFUNCTION()
 	void OnAutoTransition();
 
-	// ڸ  Ǻ 
+	// 가장자리 블록 판별 로직 (XY 열 단위 정수 셀 영역의 경계 셀)
 	void FindEdgeBlocks(const TArray<class ABlockBase*>& InBlocks, TArray<class ABlockBase*>& OutEdges);
 
-	//   Ʊ  
+	// 범위 내 아군에게 버프 적용
 	void ApplyBuffToTargets();
 };
@@ -10,9 +10,14 @@
 class ABlockBase;
 class ADestructibleBlock;
 class UAbilityTask_WaitInputPress;
+struct FGameplayAbilityTargetDataHandle;
 
 /**
  * 블록 건설 스킬 - 스킬 키로 활성화하여 범위 내 블록을 찾고 생성할 수 있음
+ * 좌클릭을 누른 채 드래그하면 시작 셀부터 커서 셀까지 선(Bresenham)으로, Shift를 함께 누르면 사각형으로 여러 블록을 한 번에 건설한다.
+ * 원격 클라이언트는 놓는 즉시 고스트 블록으로 건설을 예측하고(UBlockPredictionSubsystem),
+ * 시작/끝 셀과 도형만 타겟 데이터 하나로 서버에 보낸다. 서버는 같은 셀 목록을 다시 계산해 검증한 뒤 실제 블록을 만들거나 GenericCancel로 거부한다.
+ * 코스트는 건설한 블록 수에 비례하며 노랑 룬의 감소율이 적용된다.
  */
 UCLASS()
 class SKILL_API UGA_Construction : public UGA_SkillBase
@@ -41,9 +46,6 @@ protected:
 	UPROPERTY()
 	TObjectPtr<AActor> PreviewBlock;
 
-	// 타이머 핸들
-	FTimerHandle TickTimerHandle;
-
 	// W키 재입력 감지를 위한 Ability Task
 	UPROPERTY()
 	TObjectPtr<UAbilityTask_WaitInputPress> WaitInputTask;
@@ -57,12 +59,104 @@ protected:
 	// 하이라이트 제거
 	virtual void ClearHighlights();
 
-	// 마우스 커서 아래 블록 찾기 및 프리뷰 업데이트
-	virtual void UpdatePreview();
+	// 마우스 커서 아래 블록 찾기 및 프리뷰 업데이트 (프리뷰 입력이 바뀌었을 때만 호출됨)
+	virtual void UpdatePreview() override;
+
+	// 드래그 중 프리뷰 (시작 셀부터 커서 셀까지의 건설 셀 표시)
+	void UpdateDragPreview();
+
+	// 드래그 프리뷰 블록 숨김 (개수는 유지하여 다음 드래그에 재사용)
+	void HideDragPreview();
+
+	// 드래그 중 도형과 커서 셀을 프리뷰 키에 포함
+	virtual uint32 GetPreviewKeyExtra() const override;
+
+	// 사각형 건설 입력 중인지 (드래그 중 Shift)
+	bool IsRectDragRequested() const;
 
 	// 블록 생성
 	virtual void SpawnBlock();
 
+	// 시작 셀과 끝 셀로 건설할 셀 목록을 구함 (클라이언트와 서버가 같은 결과를 얻도록 정수 연산만 사용)
+	// 끝 셀의 Z는 시작 셀의 층으로 맞추고, MaxDragCells를 넘으면 끝 셀을 시작 셀 쪽으로 당긴다.
+	// @param AnchorCell: 드래그를 시작한 셀
+	// @param EndCell: 드래그를 놓은 셀
+	// @param bRect: true면 사각형, false면 선
+	// @param OutCells: 결과 셀 목록
+	void BuildDragCells(const FIntVector& AnchorCell, const FIntVector& EndCell, bool bRect, TArray<FIntVector>& OutCells) const;
+
+	// 건설할 수 없는 셀을 제거 (범위 밖, 그리드에 블록이 있는 셀)
+	// 점유 여부는 그리드에 한 번에 조회하며 물리 쿼리는 하지 않는다.
+	// @param RangeSlack: 범위 검사에 추가로 허용할 거리 (서버는 핑 동안의 이동을 고려해 한 칸 허용)
+	void FilterBuildableCells(TArray<FIntVector>& InOutCells, float RangeSlack) const;
+
+	// 서버: 그리드에 없는 액터(캐릭터, 배치된 메시 등)와 겹치는 셀을 제거
+	// 셀 전체를 덮는 박스로 한 번만 오버랩한 뒤, 찾은 컴포넌트에 대해서만 셀 단위로 검사한다.
+	void FilterCellsBlockedByActors(TArray<FIntVector>& InOutCells) const;
+
+	// 실제 블록 생성 (서버/스탠드얼론)
+	// @return 생성된 블록 (실패 시 nullptr)
+	ADestructibleBlock* SpawnConstructedBlock(const FVector& SpawnLocation, const FRotator& SpawnRotation);
+
+	// 여러 블록을 그리드 일괄 쓰기 안에서 생성 (등록 이벤트와 프리뷰 캐시 무효화가 한 번만 일어남)
+	// @return 생성된 블록 수
+	int32 SpawnConstructedBlocks(const TArray<FIntVector>& Cells);
+
+	// 원격 클라이언트: 고스트 블록으로 건설을 예측하고 시작/끝 셀을 서버에 전송
+	// @param Cells: 클라이언트가 건설할 셀 목록 (고스트 생성용)
+	// @return 예측 고스트 생성 여부
+	bool PredictConstruction(const FIntVector& AnchorCell, const FIntVector& EndCell, bool bRect, const TArray<FIntVector>& Cells);
+
+	// 서버: 클라이언트의 건설 위치 수신
+	void OnServerTargetDataReceived(const FGameplayAbilityTargetDataHandle& Data, FGameplayTag ApplicationTag);
+
+	// 서버: 타겟 데이터 델리게이트 핸들 (EndAbility에서 해제)
+	FDelegateHandle ServerTargetDataHandle;
+
+	// 코스트 검사/적용 (건설할 블록 수 x 블록당 코스트, 노랑 룬 감소율 적용)
+	virtual bool CheckCost(const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
+
+	virtual void ApplyCost(const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo) const override;
+
+	// 룬이 반영된 이번 건설의 코스트 (PendingBuildCount 기준)
+	float GetRuneModifiedBuildCost() const;
+
+	// 코스트 GE Spec 생성 (SetByCaller로 코스트 주입)
+	FGameplayEffectSpecHandle MakeBuildCostSpec(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo) const;
+
+	// 블록 하나당 코스트 (코스트 GE의 Data.Skill.Cost SetByCaller로 전달)
+	UPROPERTY(EditDefaultsOnly, Category = "Construction")
+	float CostPerBlock = 1.0f;
+
+	// 드래그 한 번에 건설할 수 있는 최대 블록 수
+	UPROPERTY(EditDefaultsOnly, Category = "Construction", meta = (ClampMin = "1"))
+	int32 MaxDragCells = 128;
+
+	// 드래그 프리뷰 블록 (셀 수만큼 재사용)
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> DragPreviewBlocks;
+
+	// 드래그 상태
+	bool bDragging = false;
+	FIntVector DragAnchorCell = FIntVector::ZeroValue;
+
+	// 마지막 드래그 프리뷰의 끝 셀과 도형 (놓을 때 이 값으로 셀 목록을 다시 계산)
+	FIntVector DragEndCell = FIntVector::ZeroValue;
+	bool bDragRect = false;
+
+	// 드래그 프리뷰에 표시 중인 건설 셀
+	TArray<FIntVector> DragCells;
+
+	// 다음 커밋에서 코스트를 계산할 블록 수
+	int32 PendingBuildCount = 1;
+
+	// 좌클릭을 뗄 때 콜백 (드래그 건설 확정)
+	virtual void OnLeftClickReleased();
+
 	// 좌클릭 입력 콜백
 	virtual void OnLeftClickPressed();
 
@@ -61,8 +61,9 @@ protected:
 	UPROPERTY()
 	TObjectPtr<AActor> RangePreviewActor;
 
-	// 타이머 핸들
-	FTimerHandle TickTimerHandle;
+	// 프리뷰 범위에 들어와 하이라이트된 블록 (실제 파괴 대상과 같은 셀 목록에서 구함)
+	UPROPERTY()
+	TArray<ABlockBase*> PreviewedBlocks;
 
 	// 스킬 키 재입력 감지를 위한 Ability Task
 	UPROPERTY()
@@ -72,8 +73,26 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Debug")
 	float DebugDrawDuration = 1.0f;
 
-	// 매 프레임 프리뷰 위치 및 크기 업데이트
-	void UpdatePreview();
+	// 프리뷰 위치 및 크기 업데이트 (프리뷰 입력이 바뀌었을 때만 호출됨)
+	virtual void UpdatePreview() override;
+
+	// 프리뷰 박스는 플레이어에 붙어 마우스 방향으로 회전하므로 셀 단위보다 세밀한 위치/방향을 키에 추가
+	virtual uint32 GetPreviewKeyExtra() const override;
+
+	// 파괴 박스는 마우스 방향으로 회전하므로, 모든 방향의 박스를 덮는 범위에서 블록 편집을 감시
+	virtual FBox GetPreviewBounds() const override;
+
+	// 시전자 위치와 목표 방향으로 파괴 박스 계산 (프리뷰와 실제 파괴가 공유)
+	// @param StartLocation: 시전자 위치
+	// @param DirectionVector: 수평 단위 방향
+	// @param OutCenter, OutRotation, OutExtent: 룬 범위가 반영된 월드 박스
+	void GetDestructionBox(const FVector& StartLocation, const FVector& DirectionVector, FVector& OutCenter, FQuat& OutRotation, FVector& OutExtent) const;
+
+	// 파괴 박스와 겹치는 블록 셀 (프리뷰 하이라이트와 실제 피해가 같은 결과를 사용)
+	void GatherDestructionCells(const FVector& Center, const FQuat& Rotation, const FVector& Extent, TArray<FIntVector>& OutCells) const;
+
+	// 프리뷰 하이라이트 해제
+	void ClearHighlights();
 
 	// 실제 파괴 로직 수행 (좌클릭 시 호출)
 	void PerformDestruction();
@@ -11,7 +11,7 @@ class UAbilityTask_WaitInputPress;
 class ABlockBase;
 
 /**
- * ܹ߼ ߹ ô ų.
+ * 단발성 폭발물 투척 스킬.
  */
 UCLASS()
 class SKILL_API UGA_Explosive : public UGA_SkillBase
@@ -34,62 +34,64 @@ public:
 		bool bReplicateEndAbility,
 		bool bWasCancelled) override;
 
+	// 어빌리티가 부여되어 아바타가 정해지면 폭발물 풀을 미리 채움
+	virtual void OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+
 protected:
-	// ---  Լ ---
+	// --- 기능 함수 ---
 
-	//  ƽ ȣǾ ؼ() Ʈ
-	UFUNCTION()
-	void UpdatePreview();
+	// 조준선(프리뷰) 업데이트 (프리뷰 입력이 바뀌었을 때만 호출됨)
+	virtual void UpdatePreview() override;
 
-	// Ŭ  ȣ (ô Ȯ)
+	// 좌클릭 시 호출 (투척 확정)
 	UFUNCTION()
 	void OnLeftClickPressed();
 
-	//  Ű Է  ȣ
+	// 취소 키 입력 시 호출
 	UFUNCTION()
 	void OnCancelPressed(float TimeWaited);
 
-	//  ߹   ô ó 
+	// 실제 폭발물 생성 및 투척 처리 로직
 	void SpawnExplosive();
 
-	// ̶Ʈ() ʱȭ
+	// 하이라이트(프리뷰) 초기화
 	void ClearHighlights();
 
 
-	// ---    ---
-
-	//  Ʈ  Ÿ̸
-	UPROPERTY()
-	FTimerHandle TickTimerHandle;
+	// --- 변수 및 설정 ---
 
-	// Է  ½ũ
+	// 입력 대기 태스크
 	UPROPERTY()
 	UAbilityTask_WaitInputPress* InputTask;
 
-	//  ߹ Ŭ
+	// 생성할 폭발물 클래스
 	UPROPERTY(EditDefaultsOnly, Category = "Explosive")
 	TSubclassOf<AExplosive> ExplosiveClass;
 
-	//  ݰ
+	// 폭발 반경
 	UPROPERTY(EditDefaultsOnly, Category = "Explosive")
 	float ExplosionRadius = 300.0f;
 
-	// ı   Ʈ ( ı)
+	// 미리 만들어 둘 폭발물 수 (연속 투척 시 생성 비용 방지)
+	UPROPERTY(EditDefaultsOnly, Category = "Explosive")
+	int32 PoolPrewarmCount = 2;
+
+	// 파괴 시 적용할 이펙트 (구조물 파괴용)
 	UPROPERTY(EditDefaultsOnly, Category = "Explosive")
 	TSubclassOf<UGameplayEffect> DestructionEffect;
 
 
-	// ---   ---
+	// --- 상태 저장용 ---
 
-	//   (Ķ)  
+	// 현재 프리뷰 중인(파란색) 블록 목록
 	UPROPERTY()
 	TArray<ABlockBase*> PreviewedBlocks;
 
-	//  콺 (ʷϻ/Ÿ) 
+	// 현재 마우스 오버된(초록색/타겟) 블록
 	UPROPERTY()
 	TWeakObjectPtr<ABlockBase> HighlightedBlock;
 
-	// ô Ȯ   Ÿ 
+	// 투척 확정 시 저장된 타겟 블록
 	UPROPERTY()
 	TWeakObjectPtr<ABlockBase> SavedTargetBlock;
 };
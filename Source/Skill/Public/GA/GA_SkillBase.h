@@ -6,9 +6,15 @@
 #include "Abilities/GameplayAbility.h"
 #include "NativeGameplayTags.h"
 #include "Block/BlockBase.h"
+#include "InputBindingRegistryComponent.h"
 #include "GA_SkillBase.generated.h"
 
 class USkillManagerComponent;
+class UAbilityTask_SkillPreview;
+struct FCursorTargetData;
+struct FResolvedSkillStats;
+struct FOverlapResult;
+struct FSkillDataRow;
 
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Player);
 
@@ -16,6 +22,37 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Skill); // 스킬임을 표시하는 태그
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Skill_Casting); // 스킬 시전 중임을 시전자에게 부여하는 태그
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_Damage);   // 데미지 태그용
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_Cooldown); // 쿨타임 태그용
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Data_Cost);     // 코스트 태그용
+
+/**
+ * 스킬 프리뷰의 입력 값
+ * 이 값이 이전 프레임과 같다면 프리뷰 결과도 같으므로 다시 계산하지 않는다.
+ */
+struct FSkillPreviewKey
+{
+	// 커서가 가리키는 셀 (블록을 가리키면 그 블록의 셀)
+	FIntVector CursorCell = FIntVector::ZeroValue;
+	bool bCursorHit = false;
+
+	// 시전자가 서 있는 셀
+	FIntVector AvatarCell = FIntVector::ZeroValue;
+
+	// 주황 룬 범위 배율
+	float RangeMultiplier = 1.0f;
+
+	// 프리뷰 범위 안의 그리드 편집 번호 (블록 생성/파괴/낙하 시 바뀜)
+	uint32 GridEditStamp = 0;
+
+	// 스킬별 추가 입력 (GetPreviewKeyExtra)
+	uint32 Extra = 0;
+
+	bool operator==(const FSkillPreviewKey& Other) const
+	{
+		return CursorCell == Other.CursorCell && bCursorHit == Other.bCursorHit && AvatarCell == Other.AvatarCell
+			&& RangeMultiplier == Other.RangeMultiplier && GridEditStamp == Other.GridEditStamp && Extra == Other.Extra;
+	}
+	bool operator!=(const FSkillPreviewKey& Other) const { return !(*this == Other); }
+};
 
 /**
  * 모든 액티브 스킬의 부모 클래스
@@ -46,6 +83,28 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Stats")
 	float RangeZ = 200.0f;
 
+	// 블록 한 칸에 주는 기본 피해량 (블록 기본 체력 100과 같아 한 번에 파괴됨)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Stats")
+	float BaseBlockDamage = 100.0f;
+
+	// 다른 스킬 시전 중에 눌린 이 스킬의 입력을 UAbilityInputBufferComponent에 보관할지
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Input Buffer")
+	bool bAllowInputBuffer = true;
+
+	// 버퍼에 여러 입력이 남아있을 때 재시도 순서 (클수록 먼저, 같으면 최근 입력 먼저)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Input Buffer")
+	int32 InputBufferPriority = 0;
+
+	// 이 스킬이 발동되면 버퍼에 남은 입력 중 우선순위가 이 값 이하인 입력을 버림 (-1이면 버리지 않음)
+	// 예: 회피 스킬이 발동되면 그 전에 눌러둔 공격 입력이 회피 직후에 나가지 않도록
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Input Buffer")
+	int32 InputBufferCancelPriority = -1;
+
+	// 스킬 정의 테이블(USkillDataSubsystem)에서 찾을 행 이름
+	// None이면 테이블의 SkillClass가 이 GA 클래스(또는 부모 클래스)인 행을 사용
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Stats")
+	FName SkillDataID;
+
 	// 데미지 적용을 위한 GE 클래스
 	// 데미지 적용을 위한 GE 클래스
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Effects")
@@ -66,15 +125,56 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Skill|Calculation")
 	float GetRuneModifiedCooldown() const;
 
+	// 빨강 룬 배율이 적용된 블록 피해량을 계산해서 반환 (캐릭터 공격력은 반영하지 않음)
+	UFUNCTION(BlueprintCallable, Category = "Skill|Calculation")
+	float GetRuneModifiedBlockDamage() const;
+
 	// SkillManager를 가져오는 헬퍼 함수
 	// 성능 최적화를 위해 캐싱된 값이 있으면 재사용
 	USkillManagerComponent* GetSkillManagerFromAvatar() const;
 
+	// 이 스킬이 장착된 슬롯의 룬 반영 능력치 (SkillManager가 장착 변경 시에만 계산)
+	// @return 스펙이나 SkillManager가 없으면 nullptr
+	const FResolvedSkillStats* GetResolvedSkillStats() const;
+
+	// 시전자의 현재 공격력 (IAttributeSetProvider::GetAttackPowerAttribute로 조회, 없으면 0)
+	float GetCharacterAttackPower() const;
+
 	// 데미지 GE Spec을 생성할 때 수치를 주입해서 반환하는 함수
 	FGameplayEffectSpecHandle MakeRuneDamageEffectSpec(
 		const FGameplayAbilitySpecHandle Handle,
 		const FGameplayAbilityActorInfo* ActorInfo) const;
 
+	// 발동 가능 여부 검사
+	// 초록 룬 변형은 모두 같은 InputID로 부여되므로, 슬롯의 활성 변형이 아니면 발동하지 않음
+	virtual bool CanActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayTagContainer* SourceTags = nullptr,
+		const FGameplayTagContainer* TargetTags = nullptr,
+		FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
+
+	// GA 발동 시 호출되는 함수
+	// 발동 트레이스/통계 기록 후 부모 클래스 호출
+	virtual void ActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		const FGameplayEventData* TriggerEventData) override;
+
+	// 코스트 커밋 (성공 시 커밋 트레이스 기록)
+	virtual bool CommitAbilityCost(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		FGameplayTagContainer* OptionalRelevantTags = nullptr) override;
+
+	// CommitAbility 성공 시 호출 (커밋 트레이스 기록)
+	virtual void CommitExecute(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo) override;
+
 	// GA 종료 시 호출되는 함수
 	// State.Busy 태그 제거 수행
 	virtual void EndAbility(
@@ -84,6 +184,14 @@ protected:
 		bool bReplicateEndAbility,
 		bool bWasCancelled) override;
 
+	// 스킬 정의 테이블이 바뀌었으면 값을 다시 반영 (ActivateAbility에서 호출)
+	void RefreshSkillData();
+
+	// 테이블 행의 값을 이 GA에 반영 (스킬별 수치는 자식 클래스에서 재정의)
+	// 0 이하인 값은 비어있는 것으로 보고 GA 클래스 기본값(CDO)을 사용한다.
+	// @param Data: 범위 검사를 거친 스킬 데이터
+	virtual void ApplySkillData(const FSkillDataRow& Data);
+
 	// 쿨타임 적용 로직을 오버라이드 (노랑 룬 적용을 위해)
 	virtual void ApplyCooldown(
 		const FGameplayAbilitySpecHandle Handle,
@@ -106,8 +214,115 @@ protected:
 	// 범위 내 블록들의 하이라이트 상태를 일괄 변경하는 헬퍼 함수
 	void BatchHighlightBlocks(const TArray<ABlockBase*>& Blocks, EBlockHighlightState State);
 
+	/**
+	 * 프리뷰 프레임워크
+	 * StartPreview 이후 매 프레임 프리뷰 입력(커서 셀, 시전자 셀, 룬 범위, 범위 내 블록 편집)을 검사하고
+	 * 바뀌었을 때만 UpdatePreview를 호출한다. 입력이 그대로면 지난 결과(하이라이트, 프리뷰 액터)를 그대로 둔다.
+	 * 프리뷰는 로컬 조종 중인 시전자에서만 동작하므로 리슨 서버에서 다른 플레이어의 스킬은 비용이 들지 않는다.
+	 */
+
+	// 프리뷰 시작 (EndAbility에서 자동으로 종료됨)
+	void StartPreview();
+
+	// 프리뷰 종료 (투척 확정 등 어빌리티보다 먼저 프리뷰를 끝낼 때)
+	void StopPreview();
+
+	// 다음 프레임에 입력과 관계없이 프리뷰를 다시 계산
+	void InvalidatePreview() { bPreviewDirty = true; }
+
+	// 프리뷰 입력이 바뀌었을 때만 호출되는 프리뷰 계산 함수 (자식 클래스에서 재정의)
+	virtual void UpdatePreview() {}
+
+	// 스킬별로 프리뷰 키에 추가할 입력 (예: 커서 방향). 기본값 0
+	virtual uint32 GetPreviewKeyExtra() const { return 0; }
+
+	// 블록 편집을 감시할 프리뷰 범위 (기본: 시전자 중심의 룬 배율이 적용된 RangeXY, RangeZ 박스 + 한 칸 여유)
+	virtual FBox GetPreviewBounds() const;
+
+	// 이번 프리뷰 계산에 사용할 커서 히트 결과 (UpdatePreview 안에서 직접 트레이스하지 않고 사용)
+	const FHitResult& GetPreviewCursorHit() const { return PreviewCursorHit; }
+
+	// 시전자 로컬 컨트롤러의 이번 프레임 커서 타겟팅 결과 (UCursorTargetingComponent 공유 캐시)
+	// 로컬 컨트롤러가 없으면 nullptr
+	const FCursorTargetData* GetCursorTarget() const;
+
+	// 어빌리티가 활성화된 동안만 쓰는 좌클릭 바인딩 (UInputBindingRegistryComponent의 임시 매핑 컨텍스트)
+	// 이미 바인딩되어 있으면 교체하고, EndAbility에서 자동으로 해제됨
+	// @param Callback: 좌클릭 시 호출할 콜백
+	// @param ReleasedCallback: 좌클릭을 뗄 때 호출할 콜백 (드래그 입력용, 없으면 생략)
+	// @return 로컬 컨트롤러가 없거나 등록에 실패하면 false
+	bool BindLeftClick(FSimpleDelegate Callback, FSimpleDelegate ReleasedCallback = FSimpleDelegate());
+
+	// 좌클릭 바인딩 해제 (투척 확정 등 어빌리티보다 먼저 입력을 끝낼 때)
+	void UnbindLeftClick() { LeftClickBinding.Reset(); }
+
+	// 이 스킬의 룬 데미지 스펙과 추가 GE 스펙을 발동당 한 번씩만 만들어 범위 안 대상 전체에 적용
+	// 블록은 GE 대신 룬이 반영된 블록 피해로 그리드에 한 번에 전달
+	// @param Overlaps: 범위 검사 결과
+	// @param ExtraEffect: 데미지 외에 함께 적용할 GE (예: 파괴 GE, 없으면 nullptr)
+	// @param BlockCells: 그리드에서 직접 구한 블록 셀 (있으면 오버랩 결과의 블록은 무시하고 이 셀에 피해)
+	// @return GE 적용 큐에 새로 들어간 기록 수
+	int32 ApplySkillEffectsToOverlaps(
+		const TArray<FOverlapResult>& Overlaps,
+		TSubclassOf<UGameplayEffect> ExtraEffect,
+		const TArray<FIntVector>* BlockCells = nullptr);
+
+public:
+	// 입력 버퍼 설정 조회 (UAbilityInputBufferComponent에서 사용)
+	bool CanBufferInput() const { return bAllowInputBuffer; }
+	int32 GetInputBufferPriority() const { return InputBufferPriority; }
+	int32 GetInputBufferCancelPriority() const { return InputBufferCancelPriority; }
+
+	// 범위 검사 결과를 ASC 대상과 블록 셀로 나누어 한 번에 처리하는 공용 헬퍼
+	// ASC 대상은 UEffectQueueSubsystem에 제출하므로 같은 액터/ASC가 여러 번 겹쳐도 한 번만 적용되고,
+	// 모든 대상이 같은 스펙을 재사용한다. 블록 셀은 그리드의 ApplyCellDamage로 한 번에 전달
+	// 스킬 외의 액터(예: AExplosive)도 사용할 수 있도록 static
+	// @param SourceASC: GE를 적용하는 시전자 ASC
+	// @param Overlaps: 범위 검사 결과
+	// @param Specs: 미리 만든 GE 스펙 목록 (유효하지 않은 스펙은 무시)
+	// @param BlockDamage: 블록 셀에 줄 피해 (0 이하면 블록은 무시)
+	// @param OutNumBlockCells: 피해를 전달한 블록 셀 수 (필요 없으면 nullptr)
+	// @return GE 적용 큐에 새로 들어간 기록 수
+	static int32 ApplySpecsToOverlaps(
+		UAbilitySystemComponent* SourceASC,
+		const TArray<FOverlapResult>& Overlaps,
+		TConstArrayView<FGameplayEffectSpecHandle> Specs,
+		float BlockDamage,
+		int32* OutNumBlockCells = nullptr);
+
 private:
+	// 프리뷰 태스크가 매 프레임 호출. 입력이 바뀌었는지 검사하고 필요할 때만 UpdatePreview 호출
+	void TickPreview();
+	friend class UAbilityTask_SkillPreview;
+
 	// 캐싱된 SkillManager (성능 최적화용)
 	// mutable: const 함수에서도 수정 가능
 	mutable TWeakObjectPtr<USkillManagerComponent> CachedSkillManager;
+
+	// 프리뷰 태스크
+	UPROPERTY()
+	TObjectPtr<UAbilityTask_SkillPreview> PreviewTask;
+
+	// 마지막으로 UpdatePreview를 호출한 입력
+	FSkillPreviewKey LastPreviewKey;
+
+	// 마지막 커서 트레이스 결과와 그때의 마우스/카메라/히트 액터 상태 (그대로면 트레이스 생략)
+	FHitResult PreviewCursorHit;
+	FIntVector PreviewCursorCell = FIntVector::ZeroValue;
+	FVector2D LastPreviewMousePosition = FVector2D(-1.0f, -1.0f);
+	FVector LastPreviewViewLocation = FVector::ZeroVector;
+	FRotator LastPreviewViewRotation = FRotator::ZeroRotator;
+	FTransform LastPreviewHitActorTransform = FTransform::Identity;
+
+	// 입력과 관계없이 다시 계산해야 하는지
+	bool bPreviewDirty = true;
+
+	// 마지막으로 반영한 스킬 데이터 버전 (USkillDataSubsystem::GetDataVersion과 비교)
+	int32 AppliedSkillDataVersion = 0;
+
+	// 좌클릭 바인딩 소유 핸들 (해제 시 이 어빌리티의 바인딩만 제거)
+	FInputBindingHandle LeftClickBinding;
+
+	// 이번 발동 시작 시각 (FPlatformTime::Cycles64, 종료 시 수명 계산용, 0이면 발동 중 아님)
+	uint64 ActivationStartCycles = 0;
 };
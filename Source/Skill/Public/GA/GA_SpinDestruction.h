@@ -8,10 +8,14 @@
 
 class UGameplayEffect;
 class UAbilityTask_WaitInputPress;
+class USphereComponent;
+class UPrimitiveComponent;
 
 /**
  * 회전하며 주변 적들에게 지속 데미지를 주는 파괴 스킬
  * GA_Destruction의 초록 룬(값 1.0) 변형 버전
+ * 범위 판정은 아바타에 붙여 둔 구 컴포넌트의 시작/종료 오버랩 이벤트로 갱신되는 집합을 사용하므로,
+ * 데미지 틱마다 새 오버랩 쿼리를 돌리지 않는다.
  */
 UCLASS(Blueprintable)
 class SKILL_API UGA_SpinDestruction : public UGA_SkillBase
@@ -58,11 +62,21 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UAbilityTask_WaitInputPress> WaitInputTask;
 
+	// 회전 범위 판정용 구 컴포넌트 (아바타에 한 번 붙여 두고 회전 중에만 충돌을 켬)
+	UPROPERTY()
+	TObjectPtr<USphereComponent> SpinSphere;
+
+	// 현재 회전 범위 안에 있는 컴포넌트 (오버랩 이벤트로 갱신)
+	TSet<TWeakObjectPtr<UPrimitiveComponent>> SpinOverlaps;
+
 	// 회전 스킬 타이머 핸들들
 	FTimerHandle SpinDurationTimerHandle;
 	FTimerHandle DamageTickTimerHandle;
 	FTimerHandle DebugDrawTimerHandle;
 
+	// 스킬 정의 테이블의 회전 수치 반영
+	virtual void ApplySkillData(const FSkillDataRow& Data) override;
+
 	// 회전 스킬 시작
 	void StartSpin();
 
@@ -75,6 +89,24 @@ protected:
 	// 회전 스킬 디버그 드로우 업데이트
 	void UpdateDebugDraw();
 
+	// 아바타에 범위 판정용 구 컴포넌트를 준비하고 반지름/충돌을 설정
+	// @param Radius: 룬이 적용된 회전 반지름
+	// @return 준비에 성공하면 true
+	bool EnableSpinSphere(float Radius);
+
+	// 구 컴포넌트의 충돌을 끄고 오버랩 집합을 비움
+	void DisableSpinSphere();
+
+	// 룬이 적용된 회전 반지름
+	float GetAdjustedSpinRadius() const;
+
+	// 구 컴포넌트 오버랩 시작/종료 콜백
+	UFUNCTION()
+	void OnSpinSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnSpinSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
 	// 스킬 키 재입력 콜백 (조기 종료)
 	UFUNCTION()
 	void OnSkillKeyPressed(float TimeWaited);
@@ -7,10 +7,11 @@
 #include "GA_SummonBarrier.generated.h"
 
 class ADestructibleBlock;
+class UAbilityTask_SkillTick;
 
 /**
  * 방벽 소환 스킬 (돌진 기능 추가)
- * 1. 클릭 시 3x2 방벽 생성 (생성 후 스킬 유지)
+ * 1. 클릭 시 BarrierWidth x BarrierHeight(기본 3x2) 방벽 생성 (생성 후 스킬 유지)
  * 2. 다시 스킬 키 입력 시 방벽이 전방으로 돌진
  * 3. 각 블록은 개별적으로 장애물과 충돌 시 소멸
  */
@@ -42,6 +43,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Construction|Charge")
 	float MaxChargeDistance = 2000.0f;
 
+	// 방벽 가로 칸 수 (가운데 기준 좌우로 번갈아 배치)
+	UPROPERTY(EditDefaultsOnly, Category = "Construction|Barrier", meta = (ClampMin = "1"))
+	int32 BarrierWidth = 3;
+
+	// 방벽 층 수
+	UPROPERTY(EditDefaultsOnly, Category = "Construction|Barrier", meta = (ClampMin = "1"))
+	int32 BarrierHeight = 2;
+
 	// 현재까지 이동한 거리
 	float CurrentMovedDistance = 0.0f;
 
@@ -51,14 +60,18 @@ protected:
 	// 현재 돌진 중인지 여부
 	bool bIsCharging = false;
 
-	// 돌진 타이머 핸들
-	FTimerHandle ChargeTimerHandle;
+	// 돌진 틱 태스크 (실제 프레임 시간으로 이동)
+	UPROPERTY()
+	TObjectPtr<UAbilityTask_SkillTick> ChargeTickTask;
 
 	// 블록 사이즈
 	float GridSize = 100.0f;
 
 	// --- 오버라이드 함수들 ---
 
+	// 스킬 정의 테이블의 돌진/방벽 크기 수치 반영
+	virtual void ApplySkillData(const FSkillDataRow& Data) override;
+
 	// 프리뷰 업데이트 (소환할 블록 위치 계산 및 점유 확인)
 	virtual void UpdatePreview() override;
 
@@ -91,7 +104,29 @@ private:
 	void StartBarrierCharge(float TimeWaited);
 
 	// 매 프레임 방벽 이동 처리
-	void TickBarrierCharge();
+	// 방벽 전체를 하나의 강체로 보고 묶음 경계 박스를 한 번만 스윕하며,
+	// 묶음 스윕이 접촉을 보고한 프레임에만 블록별로 충돌을 판정한다
+	// @param DeltaTime: 이번 프레임 시간
+	UFUNCTION()
+	void TickBarrierCharge(float DeltaTime);
+
+	// 방벽을 한 번 이동시키고 충돌 판정 (TickBarrierCharge가 프레임 이동량을 한 칸 미만 단위로 나누어 호출)
+	// @param MoveDist: 이번 단계 이동 거리
+	// @return 어빌리티가 종료되었으면 false
+	bool StepBarrierCharge(float MoveDist);
+
+	// 남은 방벽 블록 전체를 감싸는 경계 박스 계산 (유효하지 않은 블록은 목록에서 제거)
+	// @return 남은 블록이 없으면 false
+	bool CalculateBarrierBounds(FBox& OutBounds);
+
+	// 묶음 스윕이 접촉을 보고했을 때 블록별로 스윕해서 부딪힌 블록을 소멸시키고 대상에게 피해 적용
+	// @param DeltaMove: 이번 프레임 이동량
+	// @param QueryParams: 방벽 블록과 시전자를 무시하도록 설정된 쿼리 파라미터
+	void ResolveBarrierBlockHits(const FVector& DeltaMove, const FCollisionQueryParams& QueryParams);
+
+	// 방벽 블록 스윕에 사용할 채널과 응답 (블록 루트 컴포넌트 설정을 그대로 사용)
+	ECollisionChannel ChargeSweepChannel = ECC_WorldDynamic;
+	FCollisionResponseParams ChargeSweepResponse;
 
 	void ClearHighlights() override;
 };
@@ -0,0 +1,159 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputCoreTypes.h"
+#include "InputBindingRegistryComponent.generated.h"
+
+class APlayerController;
+class UInputAction;
+class UInputMappingContext;
+class UEnhancedInputComponent;
+class UInputBindingRegistryComponent;
+struct FInputActionInstance;
+
+/**
+ * 레지스트리 바인딩의 소유권 핸들 (이동만 가능)
+ * 핸들이 파괴되거나 Reset되면 자신이 만든 바인딩만 해제한다.
+ * 슬롯 번호와 일련번호로 찾으므로 해제는 O(1)이고, 재사용된 슬롯(다른 소유자)을 지우지 않는다.
+ */
+struct SKILL_API FInputBindingHandle
+{
+	FInputBindingHandle() = default;
+	~FInputBindingHandle() { Reset(); }
+
+	FInputBindingHandle(FInputBindingHandle&& Other);
+	FInputBindingHandle& operator=(FInputBindingHandle&& Other);
+
+	FInputBindingHandle(const FInputBindingHandle&) = delete;
+	FInputBindingHandle& operator=(const FInputBindingHandle&) = delete;
+
+	// 아직 바인딩을 소유하고 있는지
+	bool IsValid() const;
+
+	// 바인딩 해제 (이미 해제되었거나 레지스트리가 사라졌으면 아무 일도 하지 않음)
+	void Reset();
+
+private:
+	friend class UInputBindingRegistryComponent;
+
+	TWeakObjectPtr<UInputBindingRegistryComponent> Registry;
+	int32 SlotIndex = INDEX_NONE;
+	uint32 Serial = 0;
+};
+
+/**
+ * 바인딩 하나가 사용하는 임시 매핑 컨텍스트와 액션
+ * 해제된 슬롯의 컨텍스트/액션은 다음 바인딩이 재사용한다.
+ */
+USTRUCT()
+struct FInputBindingSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInputMappingContext> Context;
+
+	UPROPERTY()
+	TObjectPtr<UInputAction> Action;
+
+	// 키가 눌렸을 때/떼었을 때 호출할 콜백
+	FSimpleDelegate PressedCallback;
+	FSimpleDelegate ReleasedCallback;
+
+	// 콜백을 등록한 입력 컴포넌트와 바인딩 핸들 (해제 시 사용)
+	TWeakObjectPtr<UEnhancedInputComponent> InputComponent;
+	uint32 PressedBindingHandle = 0;
+	uint32 ReleasedBindingHandle = 0;
+
+	// 현재 매핑된 키
+	FKey Key;
+
+	// 매핑 컨텍스트 우선순위 (같은 키의 활성 슬롯 중 가장 큰 값이 입력을 받음)
+	int32 Priority = 0;
+
+	// 슬롯이 재사용될 때마다 증가 (오래된 핸들이 새 소유자의 바인딩을 지우지 않도록)
+	uint32 Serial = 0;
+
+	bool bActive = false;
+};
+
+/**
+ * 어빌리티 로컬 입력 바인딩 레지스트리
+ * 로컬 플레이어 컨트롤러에 하나 붙어서, 스킬이 잠깐 필요로 하는 키 입력(예: 좌클릭 확정)을
+ * 임시 Enhanced Input 매핑 컨텍스트로 등록하고 RAII 핸들을 돌려준다.
+ * 나중에 등록된 바인딩일수록 높은 우선순위로 쌓이고, 같은 키는 가장 위의 바인딩만 입력을 받는다.
+ * 위의 바인딩이 해제되면 그 아래 바인딩이 다시 입력을 받는다.
+ * 로컬 플레이어가 없는 컨트롤러(자동화 테스트)에서는 매핑 없이 스택만 쌓고 SimulateKeyPress로 입력을 받는다.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SKILL_API UInputBindingRegistryComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UInputBindingRegistryComponent();
+
+	// 컨트롤러에 붙은 레지스트리를 찾고, 없으면 생성해서 붙인다
+	// 로컬 컨트롤러가 아니면 입력이 없으므로 nullptr 반환
+	// @param PC: 대상 플레이어 컨트롤러
+	static UInputBindingRegistryComponent* FindOrAdd(APlayerController* PC);
+
+	// 키 바인딩을 스택 맨 위에 추가
+	// @param Key: 바인딩할 키
+	// @param PressedCallback: 키가 눌렸을 때 호출할 콜백
+	// @param ReleasedCallback: 키를 떼었을 때 호출할 콜백 (필요 없으면 바인딩하지 않은 델리게이트)
+	// @return 바인딩 소유 핸들 (실패하면 유효하지 않은 핸들)
+	FInputBindingHandle PushKeyBinding(const FKey& Key, FSimpleDelegate PressedCallback, FSimpleDelegate ReleasedCallback = FSimpleDelegate());
+
+	// 현재 활성화된 바인딩 수
+	int32 GetNumActiveBindings() const { return NumActive; }
+
+	// 키 입력 흉내 (자동화 테스트, 디버그용)
+	// 실제 입력과 같이 그 키의 가장 위 바인딩 콜백만 호출한다.
+	// @param Key: 눌렀다고/떼었다고 처리할 키
+	// @return 입력을 받은 바인딩이 있으면 true
+	bool SimulateKeyPress(const FKey& Key);
+	bool SimulateKeyRelease(const FKey& Key);
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 임시 매핑 컨텍스트의 시작 우선순위 (캐릭터 기본 매핑 컨텍스트보다 높아야 함)
+	UPROPERTY(EditDefaultsOnly, Category = "Input")
+	int32 BasePriority = 100;
+
+private:
+	friend struct FInputBindingHandle;
+
+	// 핸들이 호출. 슬롯 번호와 일련번호가 모두 맞을 때만 해제
+	void RemoveBinding(int32 SlotIndex, uint32 Serial);
+
+	// 슬롯의 매핑 컨텍스트와 액션 바인딩 해제 후 빈 슬롯 목록에 반환
+	void ReleaseSlot(int32 SlotIndex);
+
+	// 임시 액션이 눌렸을 때/떼었을 때 호출. 액션으로 슬롯을 찾아 콜백 실행
+	void HandleActionStarted(const FInputActionInstance& Instance);
+	void HandleActionCompleted(const FInputActionInstance& Instance);
+
+	// 액션의 활성 슬롯 (없으면 nullptr)
+	FInputBindingSlot* FindActiveSlot(const FInputActionInstance& Instance);
+
+	// 키의 활성 슬롯 중 가장 위 슬롯 (없으면 nullptr)
+	FInputBindingSlot* FindTopSlotForKey(const FKey& Key);
+
+	UPROPERTY()
+	TArray<FInputBindingSlot> Slots;
+
+	// 재사용 가능한 슬롯 번호
+	TArray<int32> FreeSlots;
+
+	// 액션 -> 슬롯 번호 (슬롯마다 고유 액션을 쓰므로 생성 시 한 번만 등록)
+	TMap<TObjectKey<UInputAction>, int32> ActionToSlot;
+
+	// 다음 바인딩의 스택 높이 (활성 바인딩이 모두 해제되면 0으로 돌아감)
+	int32 StackTop = 0;
+	int32 NumActive = 0;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "AttributeSet.h"
 #include "IAttributeSetProvider.generated.h"
 
 class UAttributeSet;
@@ -27,4 +28,9 @@ class SKILL_API IAttributeSetProvider
 public:
 	// AttributeSet을 반환하는 순수 가상 함수
 	virtual UAttributeSet* GetAttributeSet() const = 0;
+
+	// 스킬 피해량 계산에 사용할 공격력 Attribute 반환
+	// 이름 기반 리플렉션 대신 타입이 지정된 접근자를 사용하므로 AttributeSet 종류와 무관하게 안전
+	// 공격력이 없는 구현은 기본값(유효하지 않은 Attribute)을 그대로 사용
+	virtual FGameplayAttribute GetAttackPowerAttribute() const { return FGameplayAttribute(); }
 };
@@ -10,10 +10,11 @@
 
 class ABlockBase;
 class ABlockBase;
+class UExplosiveFlightSubsystem;
 class UAbilitySystemComponent;
 class UGameplayEffect;
 
-//   GA_Explosive ˸  Ʈ
+// 폭발 시점을 GA_Explosive에 알리기 위한 델리게이트
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnExplosiveDetonated);
 
 UCLASS()
@@ -21,6 +22,9 @@ class SKILL_API AExplosive : public AActor
 {
 	GENERATED_BODY()
 
+	// 비행은 UExplosiveFlightSubsystem이 일괄 계산하고, 착지 시 OnLanded를 호출
+	friend class UExplosiveFlightSubsystem;
+
 public:
 	// Sets default values for this actor's properties
 	AExplosive();
@@ -30,20 +34,18 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
-	// ʱȭ Լ: , ǥ ,  ð 
-	// @param StartLoc: ߹  ġ
-	// @param Target: ǥ 
-	// @param FlightDuration: ǥ ϴ  ɸ ð ()
-	// @param InAutoDetonateDelay: ڵ   ð ()
-	// @param InExplosionRadius:  ݰ
-	// @param InMaxBombCount: ִ ô ź 
+	// 초기화 함수: 시작점, 목표 블록, 비행 시간을 설정
+	// @param StartLoc: 폭발물의 시작 위치
+	// @param Target: 목표 블록
+	// @param FlightDuration: 목표까지 도달하는 데 걸리는 시간 (초)
+	// @param InAutoDetonateDelay: 자동 기폭 대기 시간 (초)
+	// @param InExplosionRadius: 폭발 반경
+	// @param InMaxBombCount: 최대 투척 폭탄 개수
 	// @
-	// @param InSourceASC:  뿡  ҽ ASC
-	// @param InDamageSpecHandle:  뿡  GE Spec Handle
-	// @param InDestructionEffectClass: ı ȿ  GE Ŭ
+	// @param InSourceASC: 데미지 적용에 사용할 소스 ASC
+	// @param InDamageSpecHandle: 데미지 적용에 사용할 GE Spec Handle
+	// @param InDestructionEffectClass: 파괴 효과로 적용할 GE 클래스
+	// @param InBlockDamage: 폭발 범위 안의 블록 한 칸에 줄 피해량
 	void Initialize(
 		FVector StartLoc,
 		ABlockBase* Target,
@@ -53,34 +55,47 @@ public:
 		int32 InMaxBombCount,
 		UAbilitySystemComponent* InSourceASC,
 		FGameplayEffectSpecHandle InDamageSpecHandle,
-		TSubclassOf<UGameplayEffect> InDestructionEffectClass
+		TSubclassOf<UGameplayEffect> InDestructionEffectClass,
+		float InBlockDamage
 	);
 
-	//    (ܺο ȣ)
+	// 폭발 로직 실행 (외부에서 호출)
 	void Detonate();
 
-	//  Ǿ ִ Ȯ
+	// 현재 부착되어 있는지 확인
 	bool IsAttached() const { return bAttached; }
 
-	//  ˸ Ʈ
+	// 투척되어 아직 폭발하지 않았는지 확인 (풀에 반납된 폭발물은 false)
+	bool IsInUse() const { return bInUse; }
+
+	// 풀에 반납될 때 호출: 타이머, 부착, 델리게이트, 스펙 등 이전 투척 상태를 모두 초기화하고 숨김
+	void ResetForPool();
+
+	// 메시 컴포넌트 반환 (비행 인스턴스 메시 설정용)
+	UStaticMeshComponent* GetMeshComponent() const { return MeshComponent; }
+
+	// 폭발 알림 델리게이트
 	UPROPERTY(BlueprintAssignable, Category = "Event")
 	FOnExplosiveDetonated OnDetonatedDelegate;
 
 protected:
-	// ǥ    ó
+	// 목표 지점에 도착했을 때 처리
 	void OnLanded();
 
-	// ڵ  Ÿ̸ӿ  ȣ
+	// 자동 폭파 타이머에 의해 호출됨
 	UFUNCTION()
 	void OnAutoDetonate();
 
-	//  ıǾ  ÿ ıǱ  ݹ Լ
+	// 블록이 파괴되었을 때 동시에 파괴되기 위한 콜백 함수
 	UFUNCTION()
 	void OnBlockDestroyed(AActor* DestroyedActor);
 
-	//   ϴ  Լ
+	// 블록의 색상을 변경하는 헬퍼 함수
 	void SetBlockColorRed(bool bEnable);
 
+	// 폭발물 풀에 반납 (풀이 없으면 파괴)
+	void ReleaseToPool();
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UStaticMeshComponent* MeshComponent;
@@ -88,44 +103,50 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
 	bool bAttached = false;
 
+	// Initialize로 투척된 뒤 폭발/반납 전까지 true
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+	bool bInUse = false;
+
 	/**
-	*   
+	* 비행 관련 변수
 	*/
 
-	//  ġ
+	// 시작 위치
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flight")
 	FVector StartLocation;
 
-	// ǥ  ġ(ǥ   ߾)
+	// 목표 블록의 위치(목표 블록의 윗면 중앙)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flight")
 	FVector TargetLocation;
 
-	// ǥ  
+	// 목표 블록 포인터
 	UPROPERTY()
 	ABlockBase* TargetBlock;
 
 	float TotalFlightTime = 1.0f;
-	float CurrentFlightTime = 0.0f;
-	float ArcHeight = 300.0f; //  
+	float ArcHeight = 300.0f; // 포물선 높이
 
 	/**
-	 *    
+	 *  폭발 관련 변수
 	 */
 	float AutoDetonateDelay = 3.0f;
 	float ExplosionRadius = 300.0f;
 
-	//     ASC
+	// 데미지 적용을 위한 시전자의 ASC
 	UPROPERTY()
 	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
 
-	//   ڵ (   )
+	// 데미지 스펙 핸들 (스냅샷 된 데미지 데이터)
 	FGameplayEffectSpecHandle DamageSpecHandle;
 
-	// ߰ ı Ʈ Ŭ
+	// 추가 파괴 이펙트 클래스
 	UPROPERTY()
 	TSubclassOf<UGameplayEffect> DestructionEffectClass;
 
-	// ڵ  Ÿ̸ ڵ
+	// 블록 한 칸에 줄 피해량 (폭발 시 그리드에 한 번에 적용)
+	float BlockDamage = 100.0f;
+
+	// 자동 폭파 타이머 핸들
 	FTimerHandle DetonateTimerHandle;
 
 	int32 MaxBombCount = 3;
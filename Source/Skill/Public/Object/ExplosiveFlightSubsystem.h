@@ -0,0 +1,87 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ExplosiveFlightSubsystem.generated.h"
+
+class AExplosive;
+class UInstancedStaticMeshComponent;
+
+/**
+ * 날아가는 폭발물의 포물선 비행을 한 곳에서 계산하는 서브시스템
+ * 폭발물마다 Tick과 SetActorLocation을 돌리는 대신, 비행 중인 폭발물을 SoA(속성별 배열)로 보관하고
+ * 한 루프에서 전부 진행시킨 뒤 인스턴스 메시 하나로 그린다.
+ * 착지한 폭발물은 AExplosive::OnLanded로 넘겨 부착/기폭 로직을 그대로 수행한다.
+ * @note 비행 중인 폭발물 액터는 숨겨지며, 착지할 때 목표 위치로 옮겨진 뒤 다시 보인다.
+ */
+UCLASS()
+class SKILL_API UExplosiveFlightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Explosives.Num() > 0 || bVisualDirty; }
+	virtual TStatId GetStatId() const override;
+
+	// 폭발물 비행 시작
+	// @param Explosive: 날아갈 폭발물
+	// @param StartLocation: 시작 위치
+	// @param TargetLocation: 착지 위치 (목표 블록 윗면 중앙)
+	// @param Duration: 비행 시간 (초)
+	// @param ArcHeight: 포물선 최고 높이
+	void LaunchExplosive(AExplosive* Explosive, const FVector& StartLocation, const FVector& TargetLocation, float Duration, float ArcHeight);
+
+	// 비행 중단 (착지 전에 기폭되거나 정리될 때)
+	// @param Explosive: 중단할 폭발물
+	// @param OutLocation: 비행 중이었다면 현재 포물선 위의 위치
+	// @return 비행 중이었으면 true
+	bool CancelFlight(const AExplosive* Explosive, FVector* OutLocation = nullptr);
+
+	// 현재 비행 중인 폭발물 수 (디버그용)
+	int32 GetNumInFlight() const { return Explosives.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 포물선 위치 (수평 선형 보간 + 4 * Height * x * (1-x))
+	static FVector EvaluateArc(const FVector& Start, const FVector& Target, float ArcHeight, float Alpha);
+
+	// 비행 슬롯 제거 (마지막 슬롯과 교체)
+	void RemoveFlightAt(int32 Index);
+
+	// 비행 표시용 인스턴스 메시 준비 (처음 던진 폭발물의 메시/머티리얼 사용)
+	// @return 이 폭발물을 인스턴스로 그릴 수 있으면 true
+	bool EnsureFlightMesh(const AExplosive* Explosive);
+
+	// 비행 상태를 인스턴스 메시에 반영
+	void UpdateFlightMesh();
+
+	// 비행 속성 (인덱스 = 비행 슬롯 = 인스턴스 인덱스)
+	TArray<TWeakObjectPtr<AExplosive>> Explosives;
+	TArray<FVector> StartLocations;
+	TArray<FVector> TargetLocations;
+	TArray<FVector> CurrentLocations;
+	TArray<FVector> Scales;
+	TArray<float> Durations;
+	TArray<float> ElapsedTimes;
+	TArray<float> ArcHeights;
+	TArray<bool> bInstanced;		// false면 메시가 달라 액터를 직접 이동
+
+	// 인스턴스 트랜스폼 버퍼 (인스턴스 수만큼, 쓰지 않는 인스턴스는 크기 0)
+	TArray<FTransform> InstanceTransforms;
+
+	UPROPERTY()
+	TObjectPtr<AActor> FlightActor;
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> FlightMesh;
+
+	// 인스턴스를 한 번 더 갱신해야 하는지 (마지막 폭발물이 착지한 프레임)
+	bool bVisualDirty = false;
+};
@@ -0,0 +1,65 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ExplosivePoolSubsystem.generated.h"
+
+class AExplosive;
+
+// 폭발물 클래스 하나에 대한 대기 목록
+USTRUCT()
+struct FExplosivePool
+{
+	GENERATED_BODY()
+
+	// 다시 꺼내 쓸 수 있는 (숨겨진) 폭발물
+	UPROPERTY()
+	TArray<TObjectPtr<AExplosive>> FreeExplosives;
+
+	// 이 풀에서 지금까지 생성한 폭발물 수 (디버그용)
+	int32 NumSpawned = 0;
+};
+
+/**
+ * 폭발물 액터 풀 서브시스템
+ * 투척할 때마다 SpawnActor, 폭발할 때마다 Destroy를 하는 대신 미리 만들어 둔 폭발물을 꺼내 쓰고 돌려받는다.
+ * 돌려받은 폭발물은 AExplosive::ResetForPool로 타이머/부착/델리게이트/스펙을 모두 초기화한 뒤 숨겨진다.
+ * @note 클래스별로 풀을 따로 관리하며, 대기 목록이 MaxPooledPerClass를 넘으면 그때는 Destroy한다.
+ */
+UCLASS()
+class SKILL_API UExplosivePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 클래스당 대기 목록에 보관할 최대 폭발물 수
+	static constexpr int32 MaxPooledPerClass = 16;
+
+	virtual void Deinitialize() override;
+
+	// 대기 목록에 폭발물을 미리 만들어 둠 (이미 생성한 수가 Count 이상이면 아무것도 하지 않음)
+	// @param ExplosiveClass: 만들 폭발물 클래스
+	// @param Count: 이 클래스로 확보해 둘 폭발물 수
+	void Prewarm(TSubclassOf<AExplosive> ExplosiveClass, int32 Count);
+
+	// 폭발물 하나를 꺼냄 (대기 목록이 비었으면 새로 생성)
+	// @param ExplosiveClass: 꺼낼 폭발물 클래스
+	// @param Location: 꺼낸 폭발물을 놓을 위치
+	// @return 사용할 폭발물, 생성에 실패하면 nullptr
+	AExplosive* AcquireExplosive(TSubclassOf<AExplosive> ExplosiveClass, const FVector& Location);
+
+	// 다 쓴 폭발물을 돌려받음 (상태 초기화 후 숨김)
+	// @param Explosive: 돌려받을 폭발물
+	void ReleaseExplosive(AExplosive* Explosive);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 숨겨진 상태의 새 폭발물 생성
+	AExplosive* SpawnPooledExplosive(TSubclassOf<AExplosive> ExplosiveClass, FExplosivePool& Pool);
+
+	UPROPERTY()
+	TMap<TSubclassOf<AExplosive>, FExplosivePool> Pools;
+};
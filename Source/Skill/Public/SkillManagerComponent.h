@@ -11,6 +11,9 @@
 class UAbilitySystemComponent;
 class UGameplayAbility;
 class UDA_Rune;
+struct FGameplayEffectSpec;
+struct FActiveGameplayEffect;
+struct FActiveGameplayEffectHandle;
 
 /**
  * 룬 슬롯 구조체
@@ -28,6 +31,72 @@ struct FRuneSlot
 	FRuneSlot() : RuneAsset(nullptr) {}
 };
 
+/**
+ * 룬이 반영된 스킬 슬롯 능력치
+ * 룬/스킬 장착이 바뀔 때만 다시 계산하고, 스킬은 매 호출마다 룬을 순회하지 않고 이 값을 읽는다.
+ */
+USTRUCT(BlueprintType)
+struct SKILL_API FResolvedSkillStats
+{
+	GENERATED_BODY()
+
+	// 빨강 룬 피해량 배율 (곱연산)
+	UPROPERTY(BlueprintReadOnly, Category = "Rune")
+	float DamageMultiplier = 1.0f;
+
+	// 노랑 룬 쿨타임 감소율 (합연산, 0 ~ 0.99)
+	UPROPERTY(BlueprintReadOnly, Category = "Rune")
+	float CooldownReduction = 0.0f;
+
+	// 파랑 룬 범위 배율 (곱연산)
+	UPROPERTY(BlueprintReadOnly, Category = "Rune")
+	float RangeMultiplier = 1.0f;
+
+	// 다시 계산될 때마다 증가하는 버전 (0이면 아직 계산되지 않음)
+	UPROPERTY(BlueprintReadOnly, Category = "Rune")
+	int32 Version = 0;
+};
+
+/**
+ * 스킬 슬롯의 쿨타임 상태 (HUD 표시용)
+ * 쿨타임 GE가 추가/제거될 때만 갱신되며, 위젯은 이 값으로 남은 시간을 직접 보간한다.
+ */
+USTRUCT(BlueprintType)
+struct SKILL_API FSkillCooldownState
+{
+	GENERATED_BODY()
+
+	// 쿨타임 시작 시각 (로컬 월드 시간, UWorld::GetTimeSeconds 기준)
+	UPROPERTY(BlueprintReadOnly, Category = "Cooldown")
+	float StartTime = 0.0f;
+
+	// 쿨타임 전체 길이 (0이면 쿨타임 아님)
+	UPROPERTY(BlueprintReadOnly, Category = "Cooldown")
+	float Duration = 0.0f;
+};
+
+// 슬롯 쿨타임 변경 알림 (시작, 종료, 길이 변경 시에만 호출)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSkillCooldownChanged, int32, SlotIndex, const FSkillCooldownState&, CooldownState);
+
+/**
+ * 스킬 슬롯의 변형 어빌리티 목록 (0번은 기본 스킬, 1번부터는 초록 룬 교체 스킬)
+ * 모든 변형을 장착 시 한 번만 부여하고, 룬이 바뀌면 ActiveIndex만 바꾼다.
+ * Handles는 장착 시에만 바뀌고, 룬 교체 중에는 1바이트 ActiveIndex만 복제된다.
+ */
+USTRUCT(BlueprintType)
+struct SKILL_API FSkillSlotVariants
+{
+	GENERATED_BODY()
+
+	// 변형별 ASC 스펙 핸들 (모두 InputID = 슬롯 인덱스)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill")
+	TArray<FGameplayAbilitySpecHandle> Handles;
+
+	// 현재 입력을 받는 변형 인덱스
+	UPROPERTY(BlueprintReadOnly, Category = "Skill")
+	uint8 ActiveIndex = 0;
+};
+
 /**
  * 스킬 슬롯 구조체
  * 캐릭터가 장착한 스킬의 정보를 담는 구조체
@@ -42,7 +111,11 @@ struct SKILL_API FSkillSlot
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	TSubclassOf<UGameplayAbility> EquippedSkill;
 
-	// ASC에서 받은 Ability Handle (GA 활성화/제거용)
+	// 장착된 초록 룬의 교체 스킬 클래스들 (EquippedSkill과 함께 부여됨, FSkillSlotVariants의 1번부터와 순서가 같음)
+	UPROPERTY(BlueprintReadOnly, Category = "Skill")
+	TArray<TSubclassOf<UGameplayAbility>> VariantSkills;
+
+	// 현재 활성 변형의 Ability Handle (GA 활성화/제거용)
 	// GA의 SpecHandle은 GE의 SpecHandle과 달리 int32 ID를 가짐
 	// GA Spec은 GA가 ASC에 장착될 때, 그 ASC가 TArray로 보관함
 	// Handle을 통해 ASC가 보관 중인 GA Spec에 접근 가능
@@ -57,6 +130,10 @@ struct SKILL_API FSkillSlot
 	UPROPERTY(BlueprintReadOnly, Category = "Rune")
 	TObjectPtr<UDA_Rune> EquippedGreenRune;
 
+	// 룬이 반영된 능력치 (USkillManagerComponent::ResolveSlotStats에서 갱신)
+	UPROPERTY(BlueprintReadOnly, Category = "Rune")
+	FResolvedSkillStats ResolvedStats;
+
 	// 기본 생성자
 	FSkillSlot() : EquippedSkill(nullptr), AbilityHandle(), EquippedGreenRune(nullptr) {
 		RuneSlots.SetNum(3); // 룬 슬롯 3칸 확보
@@ -83,12 +160,14 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// 플레이어의 ASC를 가져오는 함수
 	// 캐릭터의 BeginPlay에서 호출되어야 함
+	// 서버와 소유 클라이언트 모두에서 호출하면 쿨타임 추적도 시작됨 (같은 ASC로 다시 호출해도 안전)
 	UFUNCTION(BlueprintCallable, Category = "Skill Manager")
 	void SkillManagerInitialize(UAbilitySystemComponent* InAbilitySystemComponent);
 
@@ -105,9 +184,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Skill Manager")
 	bool UnequipSkill(int32 SlotIndex);
 
-	// 특정 슬롯의 스킬을 활성화하는 함수
-	// @param SlotIndex: 활성화할 슬롯의 인덱스
-	// @return 성공 여부
+	// 해당 슬롯의 쿨타임 상태 (ASC 조회 없이 캐시된 값)
+	UFUNCTION(BlueprintPure, Category = "Skill Manager|Cooldown")
+	FSkillCooldownState GetSlotCooldown(int32 SlotIndex) const;
+
+	// 해당 슬롯의 남은 쿨타임 (캐시된 시작 시각과 길이로 계산, ASC 조회 없음)
+	UFUNCTION(BlueprintPure, Category = "Skill Manager|Cooldown")
+	float GetCooldownRemaining(int32 SlotIndex) const;
+
+	// 슬롯 쿨타임이 바뀔 때 호출 (HUD는 매 프레임 조회하지 않고 이 이벤트로 갱신)
+	UPROPERTY(BlueprintAssignable, Category = "Skill Manager|Cooldown")
+	FOnSkillCooldownChanged OnCooldownChanged;
+
+	// 해당 슬롯에서 현재 입력을 받는 변형의 Ability Handle
+	// @return 슬롯이 비어있으면 유효하지 않은 핸들
+	FGameplayAbilitySpecHandle GetActiveAbilityHandle(int32 SlotIndex) const;
+
+	// 해당 스펙이 입력을 받을 수 있는 변형인지 (다른 변형이 활성화된 슬롯의 스펙이면 false)
+	// 슬롯에 속하지 않은 스펙은 항상 true
+	bool IsActiveVariant(const FGameplayAbilitySpecHandle& Handle) const;
 
 	// 현재 장착된 모든 스킬 정보를 반환하는 함수
 	UFUNCTION(BlueprintCallable, Category = "Skill Manager")
@@ -129,6 +224,10 @@ public:
 	bool UnequipRune(int32 SlotIndex, int32 RuneSlotIndex);
 
 
+	// 해당 슬롯의 룬 반영 능력치 반환 (장착 변경 시에만 다시 계산된 값)
+	// @return 슬롯 인덱스가 잘못되면 nullptr
+	const FResolvedSkillStats* GetResolvedStats(int32 SlotIndex) const;
+
 	// 해당 슬롯의 '피해량(Red)' 룬 합계 반환 (예: 1.5 = 150%)
 	UFUNCTION(BlueprintPure, Category = "Skill Manager|Calculation")
 	float GetTotalDamageMultiplier(int32 SlotIndex) const;
@@ -149,6 +248,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Skill Manager|Rune")
 	bool EquipRuneByID(int32 SlotIndex, int32 RuneSlotIndex, FName RuneID);
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
 	// ASC 참조 (소유하지 않고 캐릭터로부터 받아서 사용)
 	UPROPERTY(BlueprintReadOnly, Category = "Skill Manager")
@@ -162,6 +263,60 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Manager|Data")
 	TObjectPtr<UDataTable> RuneDataTable;
 
+	// 스킬 정의 테이블 (FSkillDataRow), BeginPlay에서 USkillDataSubsystem에 등록
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill Manager|Data")
+	TObjectPtr<UDataTable> SkillDataTable;
+
+	// 슬롯별 변형 핸들과 활성 변형 인덱스 (서버에서 설정, 클라이언트는 입력 라우팅에 사용)
+	UPROPERTY(ReplicatedUsing = OnRep_SlotVariants)
+	TArray<FSkillSlotVariants> SlotVariants;
+
+	UFUNCTION()
+	void OnRep_SlotVariants();
+
 	// 슬롯 인덱스가 유효한지 검사하는 헬퍼 함수
 	bool IsValidSlotIndex(int32 SlotIndex) const;
+
+	// 룬 데이터 테이블의 초록 룬 중 이 스킬을 원본으로 하는 교체 스킬 수집 (장착된 초록 룬 포함)
+	void CollectVariantSkills(int32 SlotIndex, TSubclassOf<UGameplayAbility> SkillClass, TArray<TSubclassOf<UGameplayAbility>>& OutVariants) const;
+
+	// 장착된 초록 룬에 맞는 변형으로 활성 인덱스를 바꿈 (서버 전용, 스펙은 다시 부여하지 않음)
+	void UpdateActiveVariant(int32 SlotIndex);
+
+	// 슬롯의 룬을 한 번 순회해서 ResolvedStats를 다시 계산
+	// EquipSkill, EquipRune, UnequipRune과 초기화 시점에만 호출
+	void ResolveSlotStats(int32 SlotIndex);
+
+	// ResolvedStats에 부여할 다음 버전
+	int32 NextStatsVersion = 1;
+
+	// --- 쿨타임 추적 ---
+
+	// 슬롯별 쿨타임 상태 (SkillSlots와 같은 인덱스)
+	TArray<FSkillCooldownState> SlotCooldowns;
+
+	// 다음 틱에 다시 계산할 슬롯 (비트 마스크)
+	uint32 PendingCooldownSlots = 0;
+	bool bCooldownRefreshScheduled = false;
+
+	// ASC 쿨타임 GE 델리게이트 바인딩/해제
+	void BindCooldownTracking();
+	void UnbindCooldownTracking();
+
+	// GE 추가/제거 콜백 (쿨타임 태그를 부여하는 GE만 해당 슬롯을 갱신 예약)
+	void OnActiveEffectAdded(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnActiveEffectRemoved(const FActiveGameplayEffect& Effect);
+
+	// 부여 태그가 슬롯의 활성 변형 쿨타임 태그와 겹치는 슬롯을 갱신 예약
+	void ScheduleCooldownRefresh(const FGameplayTagContainer& GrantedTags);
+
+	// 해당 슬롯을 다음 틱에 갱신 예약
+	void ScheduleCooldownRefresh(int32 SlotIndex);
+
+	// 예약된 슬롯의 쿨타임을 ASC에서 한 번 조회하고, 바뀐 슬롯만 알림
+	// 제거 콜백 시점에는 GE가 아직 컨테이너에 남아있으므로 다음 틱에 처리
+	void RefreshPendingCooldowns();
+
+	// 슬롯의 활성 변형이 사용하는 쿨타임 태그 (없으면 nullptr)
+	const FGameplayTagContainer* GetSlotCooldownTags(int32 SlotIndex) const;
 };
@@ -0,0 +1,85 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "Trace/Trace.h"
+
+/**
+ * 스킬 성능 계측
+ * 1. stat 그룹 (stat Skills): 단계별(프리뷰, 범위 검색, 하이라이트, GE 적용, 생성) 사이클 카운터와 프레임당 개수
+ * 2. Insights 트레이스 채널 (-trace=default,Skill): 스펙 핸들별 발동, 커밋, 종료(취소 여부, 수명), 적중 수
+ * 3. 어빌리티 클래스별 수명 로그 (Skill.RecordTimings 1, Skill.LogTimings): CI 로그에서 회귀를 바로 볼 수 있는 텍스트 요약
+ * 수명은 발동부터 종료까지의 실제 경과 시간(입력/몽타주 대기 포함)이며 CPU 비용이 아니다. CPU 비용은 1의 사이클 카운터로 본다.
+ * 모두 렌더링과 무관하므로 -nullrhi 헤드리스 실행에서도 수집된다.
+ */
+
+DECLARE_STATS_GROUP(TEXT("Skills"), STATGROUP_Skills, STATCAT_Advanced);
+
+// 단계별 사이클 카운터
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Preview"), STAT_SkillPreview, STATGROUP_Skills, SKILL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Range Query"), STAT_SkillRangeQuery, STATGROUP_Skills, SKILL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Highlight"), STAT_SkillHighlight, STATGROUP_Skills, SKILL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Apply Effects"), STAT_SkillApplyEffects, STATGROUP_Skills, SKILL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Spawn"), STAT_SkillSpawn, STATGROUP_Skills, SKILL_API);
+
+// 프레임당 개수
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Preview Updates"), STAT_SkillPreviewUpdates, STATGROUP_Skills, SKILL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Range Query Blocks"), STAT_SkillRangeQueryBlocks, STATGROUP_Skills, SKILL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Highlighted Blocks"), STAT_SkillHighlightedBlocks, STATGROUP_Skills, SKILL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queued Effects"), STAT_SkillQueuedEffects, STATGROUP_Skills, SKILL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawned Actors"), STAT_SkillSpawnedActors, STATGROUP_Skills, SKILL_API);
+
+// 누적 개수 (프레임마다 초기화되지 않음)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Activations"), STAT_SkillActivations, STATGROUP_Skills, SKILL_API);
+
+#if UE_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(SkillChannel, SKILL_API);
+#endif
+
+/**
+ * 스킬 트레이스 이벤트 출력
+ * 채널이 꺼져 있으면 문자열 포맷 등 아무 비용도 들지 않는다.
+ */
+struct SKILL_API FSkillTrace
+{
+	// 어빌리티 발동
+	// @param SpecHandle: 발동한 어빌리티 스펙
+	// @param Ability: 발동한 어빌리티 (클래스 이름 기록용)
+	static void OutputActivated(const FGameplayAbilitySpecHandle& SpecHandle, const UObject* Ability);
+
+	// 코스트/쿨타임 커밋
+	static void OutputCommitted(const FGameplayAbilitySpecHandle& SpecHandle);
+
+	// 어빌리티 종료
+	// @param bWasCancelled: 취소로 끝났는지
+	// @param LifetimeSeconds: 발동부터 종료까지의 실제 경과 시간 (초)
+	static void OutputEnded(const FGameplayAbilitySpecHandle& SpecHandle, bool bWasCancelled, double LifetimeSeconds);
+
+	// 대상 적중
+	// @param NumTargets: 이번에 GE를 제출한 대상 수
+	// @param NumBlocks: 이번에 피해를 준 블록 셀 수
+	static void OutputTargetsHit(const FGameplayAbilitySpecHandle& SpecHandle, int32 NumTargets, int32 NumBlocks);
+};
+
+/**
+ * 어빌리티 클래스별 발동~종료 수명 누적
+ * Skill.RecordTimings가 켜져 있을 때만 기록하며, Skill.LogTimings로 클래스 이름 순서의 요약을 로그에 출력한다.
+ * 예: -nullrhi -ExecCmds="Skill.RecordTimings 1, Grid.SpawnField 7 20 20 3" 로 실행한 뒤 종료 전에 Skill.LogTimings
+ */
+struct SKILL_API FSkillTimingLog
+{
+	// 어빌리티 종료 기록
+	// @param Ability: 종료된 어빌리티 (클래스별로 누적)
+	// @param bWasCancelled: 취소로 끝났는지
+	// @param LifetimeSeconds: 발동부터 종료까지의 실제 경과 시간 (초)
+	static void RecordEnded(const UObject* Ability, bool bWasCancelled, double LifetimeSeconds);
+
+	// 누적된 요약을 로그로 출력
+	static void LogSummary();
+
+	// 누적 기록 초기화
+	static void Reset();
+};
@@ -0,0 +1,34 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/Tasks/AbilityTask.h"
+#include "AbilityTask_SkillPreview.generated.h"
+
+class UGA_SkillBase;
+
+/**
+ * 스킬 프리뷰를 매 프레임 검사하는 어빌리티 태스크
+ * 실제 프리뷰 계산은 하지 않고 UGA_SkillBase::TickPreview를 호출하며,
+ * 스킬 쪽에서 프리뷰 입력이 바뀌었을 때만 UpdatePreview를 실행한다.
+ * 어빌리티가 끝나면 태스크도 함께 정리되므로 타이머 핸들을 따로 관리할 필요가 없다.
+ */
+UCLASS()
+class SKILL_API UAbilityTask_SkillPreview : public UAbilityTask
+{
+	GENERATED_BODY()
+
+public:
+	UAbilityTask_SkillPreview(const FObjectInitializer& ObjectInitializer);
+
+	// 프리뷰 태스크 생성
+	// @param OwningAbility: 프리뷰를 갱신할 스킬
+	static UAbilityTask_SkillPreview* CreateSkillPreviewTask(UGA_SkillBase* OwningAbility);
+
+	virtual void TickTask(float DeltaTime) override;
+
+protected:
+	UPROPERTY()
+	TWeakObjectPtr<UGA_SkillBase> OwningSkill;
+};
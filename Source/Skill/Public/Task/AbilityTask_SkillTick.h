@@ -0,0 +1,33 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/Tasks/AbilityTask.h"
+#include "AbilityTask_SkillTick.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSkillTickDelegate, float, DeltaTime);
+
+/**
+ * 어빌리티가 살아있는 동안 매 프레임 실제 프레임 시간과 함께 OnTick을 호출하는 태스크
+ * 고정 간격 루핑 타이머 대신 사용하면 프레임 드랍 시에도 이동량이 실제 시간과 맞는다.
+ * 어빌리티가 끝나면 함께 정리되므로 타이머 핸들을 따로 관리할 필요가 없다.
+ */
+UCLASS()
+class SKILL_API UAbilityTask_SkillTick : public UAbilityTask
+{
+	GENERATED_BODY()
+
+public:
+	UAbilityTask_SkillTick(const FObjectInitializer& ObjectInitializer);
+
+	// 매 프레임 호출 (DeltaTime: 이번 프레임 시간, 초)
+	UPROPERTY(BlueprintAssignable)
+	FSkillTickDelegate OnTick;
+
+	// 틱 태스크 생성
+	// @param OwningAbility: 태스크를 소유할 어빌리티
+	static UAbilityTask_SkillTick* CreateSkillTickTask(UGameplayAbility* OwningAbility);
+
+	virtual void TickTask(float DeltaTime) override;
+};
@@ -12,7 +12,8 @@ public class Skill: ModuleRules
             "GameplayTasks",
             "GameplayTags",
             "World",
-            "InputCore"
+            "InputCore",
+            "EnhancedInput"
         });
     }
 }
\ No newline at end of file
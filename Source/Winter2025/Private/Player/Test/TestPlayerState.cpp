@@ -4,7 +4,6 @@
 #include "AbilitySystemComponent.h"
 #include "SkillManagerComponent.h"
 #include "Player/PlayerAttributeSet.h"
-#include "Rune/DA_Rune.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -127,44 +126,8 @@ void ATestPlayerState::InitializeSkills()
 	{
 		FSkillSlot& SkillSlot = DefaultSkillSets[SlotIndex];
 
-		// 초록 룬 캐시 업데이트 (블루프린트에서 설정한 값 반영)
-		SkillSlot.UpdateGreenRuneCache();
-
-		// 장착할 GA 결정 (초록 룬 있으면 스킬 교체)
-		TSubclassOf<UGameplayAbility> SkillToEquip = SkillSlot.EquippedSkill;
-
-		// 캐시된 초록 룬 확인 (O(1) 접근)
-		if (SkillSlot.EquippedGreenRune)
-		{
-			UDA_Rune* GreenRune = SkillSlot.EquippedGreenRune;
-
-			// 초록룬의 OriginalSkillClass와 현재 장착된 스킬이 일치하는지 확인
-			if (GreenRune->OriginalSkillClass && SkillToEquip && SkillToEquip->IsChildOf(GreenRune->OriginalSkillClass))
-			{
-				// ReplacementSkillClass가 설정되어 있는지 확인
-				if (GreenRune->ReplacementSkillClass)
-				{
-					// 스킬 교체
-					SkillToEquip = GreenRune->ReplacementSkillClass;
-					UE_LOG(LogTemp, Log, TEXT("[Slot %d] Green Rune detected: Replacing %s with %s"),
-						SlotIndex,
-						*GreenRune->OriginalSkillClass->GetName(),
-						*GreenRune->ReplacementSkillClass->GetName());
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("[Slot %d] Green Rune has no ReplacementSkillClass set!"), SlotIndex);
-				}
-			}
-		}
-
-		// 스킬 장착
-		if (SkillToEquip)
-		{
-			SkillManager->EquipSkill(SlotIndex, SkillToEquip);
-		}
-
-		// 룬 장착
+		// 룬을 먼저 장착해야 EquipSkill이 장착된 초록 룬의 교체 스킬까지 함께 부여하고 활성 변형으로 선택함
+		// (초록 룬 교체는 스펙을 다시 부여하지 않고 SkillManager의 활성 변형 인덱스만 바꿈)
 		for (int32 RuneSlotIndex = 0; RuneSlotIndex < SkillSlot.RuneSlots.Num(); ++RuneSlotIndex)
 		{
 			if (SkillSlot.RuneSlots[RuneSlotIndex].RuneAsset)
@@ -172,5 +135,11 @@ void ATestPlayerState::InitializeSkills()
 				SkillManager->EquipRune(SlotIndex, RuneSlotIndex, SkillSlot.RuneSlots[RuneSlotIndex].RuneAsset);
 			}
 		}
+
+		// 스킬 장착 (기본 스킬과 초록 룬 변형을 모두 부여)
+		if (SkillSlot.EquippedSkill)
+		{
+			SkillManager->EquipSkill(SlotIndex, SkillSlot.EquippedSkill);
+		}
 	}
 }
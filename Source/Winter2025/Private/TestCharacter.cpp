@@ -11,6 +11,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "InputActionValue.h"
 #include "InputAction.h"
+#include "AbilityInputBufferComponent.h"
 
 
 ATestCharacter::ATestCharacter()
@@ -20,6 +21,9 @@ ATestCharacter::ATestCharacter()
 	
 	// 스킬 슬롯 Input Action 배열 초기화 (최대 3개)
 	SkillSlotActions.SetNum(3);
+
+	// 스킬 입력 버퍼
+	AbilityInputBuffer = CreateDefaultSubobject<UAbilityInputBufferComponent>(TEXT("AbilityInputBuffer"));
 }
 
 UAbilitySystemComponent* ATestCharacter::GetAbilitySystemComponent() const
@@ -28,6 +32,11 @@ UAbilitySystemComponent* ATestCharacter::GetAbilitySystemComponent() const
 	return CachedAbilitySystemComponent;
 }
 
+FGameplayAttribute ATestCharacter::GetAttackPowerAttribute() const
+{
+	return UPlayerAttributeSet::GetAttackPowerAttribute();
+}
+
 void ATestCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -224,6 +233,9 @@ void ATestCharacter::InitializeAbilitySystem()
 		return;
 	}
 
+	// SkillManager에 ASC 연결 (클라이언트에서도 HUD용 쿨타임 추적이 동작하도록 서버/클라이언트 모두 호출)
+	CachedSkillManager->SkillManagerInitialize(CachedAbilitySystemComponent);
+
 	// 서버에서만 스킬 초기화 수행 (권한이 있는 진짜 캐릭터)
 	if (HasAuthority())
 	{
@@ -231,7 +243,7 @@ void ATestCharacter::InitializeAbilitySystem()
 		if (PS)
 		{
 			// PlayerState의 InitializeSkills 호출
-			// 이 함수가 초록 룬 감지 및 GA 교체를 포함한 모든 스킬 초기화 수행
+			// 이 함수가 초록 룬 변형 부여를 포함한 모든 스킬 초기화 수행
 			PS->InitializeSkills();
 			UE_LOG(LogTemp, Log, TEXT("ATestCharacter: Skills initialized via PlayerState"));
 		}
@@ -250,6 +262,12 @@ void ATestCharacter::InitializeAbilitySystem()
 		UPlayerAttributeSet::GetMovementSpeedAttribute()
 	).AddUObject(this, &ATestCharacter::OnMovementSpeedChanged);
 
+	// 입력 버퍼가 시전 태그와 스킬 종료 이벤트를 받도록 연결
+	if (AbilityInputBuffer)
+	{
+		AbilityInputBuffer->InitializeWithAbilitySystem(CachedAbilitySystemComponent);
+	}
+
 	// 이중 초기화 방지 플래그 설정
 	bAbilitySystemInitialized = true;
 	UE_LOG(LogTemp, Log, TEXT("ATestCharacter: AbilitySystem initialization complete"));
@@ -263,10 +281,17 @@ void ATestCharacter::OnAbilityInputPressed(int32 InputID)
 		return;
 	}
 
-	// ASC에게 입력 Press 이벤트 전달
+	// 입력 버퍼를 거쳐 ASC에게 입력 Press 이벤트 전달
 	// AbilityLocalInputPressed가 다음 두 가지를 모두 처리:
 	// 1. 실행 중인 Ability의 Task에게 신호 전파 (예: WaitInputPress)
 	// 2. 비활성 상태면 자동으로 활성화 시도
+	// 다른 스킬 시전 중이라 활성화되지 못한 입력은 버퍼에 보관되어 시전이 끝나면 다시 시도됨
+	if (AbilityInputBuffer)
+	{
+		AbilityInputBuffer->HandleInputPressed(InputID);
+		return;
+	}
+
 	CachedAbilitySystemComponent->AbilityLocalInputPressed(InputID);
 }
 
@@ -42,7 +42,7 @@ public:
 	// DefaultRunes 접근자
 	const TArray<FSkillSlot>& GetDefaultSkillSets() const { return DefaultSkillSets; }
 
-	// 스킬 슬롯 초기화 함수 (초록 룬 감지 및 GA 교체 포함)
+	// 스킬 슬롯 초기화 함수 (초록 룬 변형 부여 포함)
 	UFUNCTION(BlueprintCallable, Category = "Skill System")
 	void InitializeSkills();
 
@@ -16,6 +16,7 @@ class USkillManagerComponent;
 class UInputMappingContext;
 class UInputAction;
 class UAttributeSet;
+class UAbilityInputBufferComponent;
 
 UCLASS()
 /**
@@ -42,6 +43,9 @@ public:
 	// PlayerState의 캐시된 AttributeSet을 반환
 	virtual UAttributeSet* GetAttributeSet() const override { return CachedAttributeSet; }
 
+	// 공격력 Attribute는 UPlayerAttributeSet::AttackPower
+	virtual FGameplayAttribute GetAttackPowerAttribute() const override;
+
 	// 입력 컴포넌트 설정
 	// 로컬 플레이어의 입력을 바인딩함
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -93,6 +97,10 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "GAS")
 	TObjectPtr<UAttributeSet> CachedAttributeSet;
 
+	// 시전 중에 눌린 스킬 입력을 보관했다가 시전이 끝나면 다시 발동
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Input")
+	TObjectPtr<UAbilityInputBufferComponent> AbilityInputBuffer;
+
 	// 초기화 완료 플래그
 	bool bAbilitySystemInitialized = false;
 
@@ -13,6 +13,7 @@
 #include "TwinStickProjectile.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "CursorTargetingComponent.h"
 
 ATwinStickCharacter::ATwinStickCharacter()
 {
@@ -82,12 +83,17 @@ void ATwinStickCharacter::Tick(float DeltaTime)
 	{
 		if (PlayerController)
 		{
-			// get the cursor world location
-			FHitResult OutHit; 
-			PlayerController->GetHitResultUnderCursorByChannel(MouseAimTraceChannel, true, OutHit);
+			// get the cursor world location from the shared per-frame targeting cache
+			UCursorTargetingComponent* Targeting = UCursorTargetingComponent::FindOrAdd(PlayerController);
+			if (!Targeting)
+			{
+				return;
+			}
+
+			const FCursorTargetData& CursorTarget = Targeting->GetCursorTarget(UEngineTypes::ConvertToCollisionChannel(MouseAimTraceChannel));
 
 			// find the aim rotation 
-			const FRotator AimRot = UKismetMathLibrary::FindLookAtRotation(GetActorLocation(), OutHit.Location);
+			const FRotator AimRot = UKismetMathLibrary::FindLookAtRotation(GetActorLocation(), CursorTarget.HitResult.Location);
 
 			// save the aim angle
 			AimAngle = AimRot.Yaw;
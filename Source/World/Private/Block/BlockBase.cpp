@@ -2,8 +2,10 @@
 
 
 #include "Block/BlockBase.h"
+#include "Grid/BlockGridSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/OverlapResult.h"
+#include "Net/UnrealNetwork.h"
 
 // Sets default values
 ABlockBase::ABlockBase()
@@ -46,6 +48,53 @@ ABlockBase::ABlockBase()
 void ABlockBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 지연 생성(SetInitialBlockType)으로 만든 블록도 레거시 SpawnBlock처럼 위치를 기록
+	Location = GetActorLocation();
+
+	// 배치/생성된 위치의 셀을 그리드에 등록
+	RegisterToGrid();
+}
+
+void ABlockBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromGrid();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABlockBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ABlockBase, CrackStage);
+}
+
+void ABlockBase::RegisterToGrid()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UBlockGridSubsystem* Grid = World->GetSubsystem<UBlockGridSubsystem>())
+		{
+			Grid->RegisterBlock(this);
+		}
+	}
+}
+
+void ABlockBase::UnregisterFromGrid(bool bFalling)
+{
+	if (!bRegisteredInGrid && !bLeftGridByFalling)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UBlockGridSubsystem* Grid = World->GetSubsystem<UBlockGridSubsystem>())
+		{
+			Grid->UnregisterBlock(this, bFalling);
+		}
+	}
 }
 
 // Called every frame
@@ -61,10 +110,20 @@ void ABlockBase::Tick(float DeltaTime)
 
 void ABlockBase::SpawnBlock(FVector SpawnLocation, EBlockType NewBlockType)
 {
+	const bool bTypeChanged = BlockType != NewBlockType;
+
 	Location = SpawnLocation;
 	BlockType = NewBlockType;
 	SetActorLocation(Location);
 
+	// 그리드 등록은 BeginPlay에서 이미 끝났으므로 다시 등록하지 않음
+	// 등록된 뒤에 타입이 바뀐 경우에만 셀 값을 새 타입으로 다시 기록 (제거 후 추가)
+	if (bTypeChanged && bRegisteredInGrid)
+	{
+		UnregisterFromGrid();
+		RegisterToGrid();
+	}
+
     // 블록이 소환되자마자 떨어져야 하는지 검사하기 위해 Tick 켬
 	SetActorTickEnabled(true);
 }
@@ -206,6 +265,7 @@ void ABlockBase::UpdateGravity(float DeltaTime)
         if (!bIsFalling)
         {
             bIsFalling = true;
+            UnregisterFromGrid(true); // 착지할 때까지 그리드에서 제외
             NotifyUpperBlock(); // 내 위의 블록도 깨움
             // UE_LOG(LogTemp, Warning, TEXT("BlockBase: %s started falling."), *GetName());
         }
@@ -239,6 +299,9 @@ void ABlockBase::CheckLanding()
         bIsFalling = false;
         VerticalVelocity = 0.0f;
         SetActorTickEnabled(false);
+
+        // 착지한 셀을 그리드에 등록 (착지 파편은 그리드 Moved 이벤트로 생성됨)
+        RegisterToGrid();
     }
     else
     {
@@ -309,8 +372,18 @@ void ABlockBase::SetHighlightState(EBlockHighlightState NewState)
 
 void ABlockBase::UpdateBombCount(int32 Delta, int32 MaxBombCount)
 {
+    const int32 OldBombCount = CurrentBombCount;
     CurrentBombCount = FMath::Clamp(CurrentBombCount + Delta, 0, MaxBombCount);
 
+    // 폭탄 개수 변화를 그리드에 알림 (Recordable 블록 기록용)
+    if (bRegisteredInGrid)
+    {
+        if (UBlockGridSubsystem* Grid = GetWorld() ? GetWorld()->GetSubsystem<UBlockGridSubsystem>() : nullptr)
+        {
+            Grid->NotifyBombCountChanged(this, OldBombCount, CurrentBombCount);
+        }
+    }
+
     if (UStaticMeshComponent* Mesh = GetBlockMesh())
     {
         // 0 ~ 1 사이 실수로 변환하여 전달 (예: 1개=0.33, 2개=0.66, 3개=1.0)
@@ -321,6 +394,51 @@ void ABlockBase::UpdateBombCount(int32 Delta, int32 MaxBombCount)
 
 
 
+void ABlockBase::UpdateCrackStage(int32 RemainingHitPoints)
+{
+    const int32 MaxHP = GetMaxHitPoints();
+    const int32 StageCount = FMath::Max(CrackStageCount, 1);
+
+    // 조금이라도 손상되면 1단계부터 표시 (예: 3단계일 때 손상률 0~33% = 1단계)
+    const float DamageRatio = 1.0f - FMath::Clamp((float)RemainingHitPoints / (float)MaxHP, 0.0f, 1.0f);
+    const int32 Stage = FMath::Clamp(FMath::CeilToInt(DamageRatio * StageCount), 0, FMath::Min(StageCount, (int32)MAX_uint8));
+
+    // 셀 체력은 서버에서만 깎이므로 단계를 복제하여 클라이언트는 OnRep에서 반영
+    CrackStage = static_cast<uint8>(Stage);
+    ApplyCrackStage();
+}
+
+void ABlockBase::OnRep_CrackStage()
+{
+    ApplyCrackStage();
+}
+
+void ABlockBase::ApplyCrackStage()
+{
+    const int32 StageCount = FMath::Max(CrackStageCount, 1);
+
+    if (UStaticMeshComponent* Mesh = GetBlockMesh())
+    {
+        Mesh->SetCustomPrimitiveDataFloat(CPD_INDEX_CRACK, (float)CrackStage / (float)StageCount); // Index 2 사용
+    }
+}
+
+void ABlockBase::RemovePredictedBlock()
+{
+    // 고스트 위에 착지했던 블록은 고스트가 없었다면 더 떨어졌어야 하므로 깨워서 낙하를 다시 판정
+    // 위 블록이 떨어지기 시작하면 NotifyUpperBlock으로 그 위의 블록도 차례로 깨어남
+    NotifyUpperBlock();
+    Destroy();
+}
+
+void ABlockBase::DestroyBlock()
+{
+    // 파편 연출은 그리드 Removed 이벤트로 모든 머신에서 생성됨 (BlockDebrisSubsystem)
+    // 위 블록에게 낙하하라고 알림
+    NotifyUpperBlock();
+    Destroy();
+}
+
 void ABlockBase::Multicast_SetHighlightState_Implementation(EBlockHighlightState NewState)
 {
     // 실제 색상 변경 로직 (서버 및 모든 클라이언트에서 실행됨)
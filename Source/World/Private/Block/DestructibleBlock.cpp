@@ -73,7 +73,5 @@ void ADestructibleBlock::OnGameplayEffectApplied(UAbilitySystemComponent* Target
 
 void ADestructibleBlock::SelfDestroy()
 {
-	// 위 블록에게 낙하하라고 알림
-	NotifyUpperBlock();
-	Destroy();
+	DestroyBlock();
 }
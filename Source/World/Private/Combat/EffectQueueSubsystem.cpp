@@ -0,0 +1,111 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Combat/EffectQueueSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+
+void UEffectQueueSubsystem::Deinitialize()
+{
+	// 월드가 내려가면 남은 기록은 적용하지 않고 버림
+	PendingEffects.Empty();
+	PendingKeys.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEffectQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UEffectQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEffectQueueSubsystem, STATGROUP_Tickables);
+}
+
+UEffectQueueSubsystem* UEffectQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEffectQueueSubsystem>() : nullptr;
+}
+
+bool UEffectQueueSubsystem::QueueEffect(
+	UAbilitySystemComponent* SourceASC,
+	UAbilitySystemComponent* TargetASC,
+	const FGameplayEffectSpecHandle& Spec,
+	FGameplayTag Tag,
+	const UObject* ActivationKey)
+{
+	if (!SourceASC || !TargetASC || !Spec.IsValid())
+	{
+		return false;
+	}
+
+	// 권한이 없는 쪽의 GE 적용은 어차피 ASC에서 무시되므로 큐에 넣지 않음
+	if (!SourceASC->IsOwnerActorAuthoritative())
+	{
+		return false;
+	}
+
+	// 1. 같은 발동 + 같은 대상 + 같은 효과는 한 번만
+	FQueuedEffectKey Key;
+	Key.Activation = ActivationKey ? static_cast<const void*>(ActivationKey) : static_cast<const void*>(Spec.Data.Get());
+	Key.Target = TargetASC;
+	Key.Definition = Spec.Data->Def;
+	Key.Tag = Tag;
+
+	bool bAlreadyQueued = false;
+	PendingKeys.Add(Key, &bAlreadyQueued);
+	if (bAlreadyQueued)
+	{
+		++NumDuplicatesThisFrame;
+		return false;
+	}
+
+	// 2. 기록 추가 (스펙은 공유 포인터라 복사 비용 없음)
+	FQueuedEffect& Entry = PendingEffects.AddDefaulted_GetRef();
+	Entry.SourceASC = SourceASC;
+	Entry.TargetASC = TargetASC;
+	Entry.Spec = Spec;
+	return true;
+}
+
+void UEffectQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	Flush();
+}
+
+void UEffectQueueSubsystem::Flush()
+{
+	if (PendingEffects.Num() == 0)
+	{
+		return;
+	}
+
+	// 적용 중 GE 콜백에서 새로 제출될 수 있으므로 목록을 떼어낸 뒤 순회
+	TArray<FQueuedEffect> EffectsToApply = MoveTemp(PendingEffects);
+	PendingEffects.Reset();
+	PendingKeys.Reset();
+
+	int32 NumApplied = 0;
+	for (const FQueuedEffect& Entry : EffectsToApply)
+	{
+		// 제출 후 죽거나 사라진 대상은 건너뜀
+		UAbilitySystemComponent* SourceASC = Entry.SourceASC.Get();
+		UAbilitySystemComponent* TargetASC = Entry.TargetASC.Get();
+		if (!SourceASC || !TargetASC)
+		{
+			continue;
+		}
+
+		SourceASC->ApplyGameplayEffectSpecToTarget(*Entry.Spec.Data.Get(), TargetASC);
+		++NumApplied;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("UEffectQueueSubsystem::Flush: Applied %d effects, skipped %d duplicates"), NumApplied, NumDuplicatesThisFrame);
+	NumDuplicatesThisFrame = 0;
+}
@@ -0,0 +1,450 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockDebrisSubsystem.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Block/BlockBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+namespace BlockDebris
+{
+	// 파편 상태 비트
+	constexpr uint8 Alive = 1 << 0;
+	constexpr uint8 Resting = 1 << 1;
+
+	// 중력 가속도 (ABlockBase와 동일)
+	constexpr float Gravity = -980.0f;
+
+	// 바닥에 닿았을 때 튀어오르는 비율과 수평 감속
+	constexpr float Restitution = 0.3f;
+	constexpr float Friction = 0.6f;
+
+	// 이 속도 이하로 튀면 바닥에 멈춤
+	constexpr float RestSpeed = 60.0f;
+
+	// 수명이 끝나기 전 이 시간 동안 크기가 줄어듦
+	constexpr float ShrinkTime = 0.3f;
+
+	// 월드 아래로 떨어진 파편 제거 높이
+	constexpr float KillZ = -10000.0f;
+
+	// 블록 메시(큐브) 한 변의 길이 (ABlockBase 기본 메시 기준)
+	constexpr float MeshSize = 100.0f;
+
+	// 이 속도 이상으로 떨어진 블록만 착지 파편을 튀김
+	constexpr float LandingDebrisSpeed = 300.0f;
+
+	// 메시 그룹 인덱스는 uint8로 저장
+	constexpr int32 MaxMeshGroups = 255;
+}
+
+void UBlockDebrisSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 파편의 바닥 충돌은 그리드를 조회함
+	Grid = Collection.InitializeDependency<UBlockGridSubsystem>();
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockDebrisSubsystem: BlockGridSubsystem is null"));
+	}
+	else
+	{
+		Grid->OnBlockEvent.AddUObject(this, &UBlockDebrisSubsystem::HandleBlockEvent);
+	}
+
+	// 풀은 처음부터 최대 용량으로 할당하고 이후에는 크기가 바뀌지 않음
+	Positions.SetNumZeroed(DebrisCapacity);
+	Velocities.SetNumZeroed(DebrisCapacity);
+	Rotations.SetNumZeroed(DebrisCapacity);
+	AngularVelocities.SetNumZeroed(DebrisCapacity);
+	Ages.SetNumZeroed(DebrisCapacity);
+	Lifetimes.SetNumZeroed(DebrisCapacity);
+	Scales.SetNumZeroed(DebrisCapacity);
+	States.SetNumZeroed(DebrisCapacity);
+	MeshGroups.SetNumZeroed(DebrisCapacity);
+	InstanceTransforms.SetNum(DebrisCapacity);
+
+	NextSlot = 0;
+	NumAlive = 0;
+	Random.GenerateNewSeed();
+}
+
+void UBlockDebrisSubsystem::Deinitialize()
+{
+	if (Grid)
+	{
+		Grid->OnBlockEvent.RemoveAll(this);
+	}
+
+	if (DebrisActor)
+	{
+		DebrisActor->Destroy();
+		DebrisActor = nullptr;
+	}
+	DebrisMeshes.Empty();
+	PaletteMeshGroups.Empty();
+	PendingRemovals.Empty();
+	NumAlive = 0;
+
+	Super::Deinitialize();
+}
+
+bool UBlockDebrisSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBlockDebrisSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBlockDebrisSubsystem, STATGROUP_Tickables);
+}
+
+bool UBlockDebrisSubsystem::ShouldSpawnDebris() const
+{
+	const UWorld* World = GetWorld();
+	return World && Grid && World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UBlockDebrisSubsystem::HandleBlockEvent(const FBlockGridEvent& Event)
+{
+	// 고스트 블록의 교체/롤백은 파괴가 아니므로 연출하지 않음
+	const UWorld* World = GetWorld();
+	if (!ShouldSpawnDebris() || World->bIsTearingDown || Event.Value.IsPredicted())
+	{
+		return;
+	}
+
+	switch (Event.Type)
+	{
+	case EBlockGridEventType::Removed:
+	{
+		// 파괴된 블록은 서버/클라이언트 모두 EndPlay에서 그리드 등록을 해제하므로 이 이벤트가 각자 발생함
+		FPendingRemoval& Removal = PendingRemovals.AddDefaulted_GetRef();
+		Removal.Cell = Event.Cell;
+		Removal.Location = Event.Location;
+		Removal.PaletteIndex = Event.Value.PaletteIndex;
+		break;
+	}
+	case EBlockGridEventType::Added:
+	{
+		// 타입 변경 재등록처럼 같은 셀이 바로 다시 채워졌다면 파괴가 아님
+		PendingRemovals.RemoveAllSwap([&Event](const FPendingRemoval& Removal)
+		{
+			return Removal.Cell == Event.Cell;
+		});
+		break;
+	}
+	case EBlockGridEventType::Moved:
+	{
+		// 낙하 높이로 착지 직전 속도 계산 (v = sqrt(2gh)), 충분히 높은 곳에서 떨어졌을 때만 파편을 튀김
+		const float FallHeight = (Event.FromCell.Z - Event.Cell.Z) * Grid->GetGridSize();
+		const float ImpactSpeed = FMath::Sqrt(2.0f * FMath::Abs(BlockDebris::Gravity) * FMath::Max(FallHeight, 0.0f));
+		if (ImpactSpeed > BlockDebris::LandingDebrisSpeed)
+		{
+			SpawnBlockLandingDebris(Grid->CellToWorld(Event.Cell), Event.Value.PaletteIndex, ImpactSpeed);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void UBlockDebrisSubsystem::FlushPendingRemovals()
+{
+	if (PendingRemovals.Num() == 0)
+	{
+		return;
+	}
+
+	// 생성 중에 이벤트가 들어와도 안전하도록 배열을 먼저 비운 뒤 순회
+	TArray<FPendingRemoval> Removals = MoveTemp(PendingRemovals);
+	PendingRemovals.Reset();
+	for (const FPendingRemoval& Removal : Removals)
+	{
+		SpawnBlockDestroyDebris(Removal.Location, Removal.PaletteIndex);
+	}
+}
+
+void UBlockDebrisSubsystem::SpawnBlockDestroyDebris(const FVector& Center, uint16 PaletteIndex)
+{
+	if (!ShouldSpawnDebris())
+	{
+		return;
+	}
+
+	const int32 MeshGroup = FindOrAddMeshGroup(PaletteIndex);
+	if (MeshGroup == INDEX_NONE)
+	{
+		return;
+	}
+
+	const float CellSize = Grid->GetGridSize();
+	const float PieceSize = CellSize / FragmentsPerAxis;
+
+	// 블록을 2 x 2 x 2 조각으로 나누어, 중심에서 바깥으로 튀도록 속도 부여
+	for (int32 Z = 0; Z < FragmentsPerAxis; ++Z)
+	{
+		for (int32 Y = 0; Y < FragmentsPerAxis; ++Y)
+		{
+			for (int32 X = 0; X < FragmentsPerAxis; ++X)
+			{
+				const FVector Offset = (FVector(X, Y, Z) + 0.5f) * PieceSize - CellSize * 0.5f;
+				const FVector Outward = Offset.GetSafeNormal2D();
+
+				FVector Velocity = Outward * Random.FRandRange(150.0f, 350.0f);
+				Velocity.Z = Random.FRandRange(200.0f, 450.0f) + (Offset.Z > 0.0f ? 100.0f : 0.0f);
+
+				const float Scale = (PieceSize * 0.9f / BlockDebris::MeshSize) * Random.FRandRange(0.8f, 1.1f);
+				SpawnFragment(Center + Offset, Velocity, Scale, Random.FRandRange(1.5f, 2.5f), MeshGroup);
+			}
+		}
+	}
+}
+
+void UBlockDebrisSubsystem::SpawnBlockLandingDebris(const FVector& Center, uint16 PaletteIndex, float ImpactSpeed)
+{
+	if (!ShouldSpawnDebris())
+	{
+		return;
+	}
+
+	const int32 MeshGroup = FindOrAddMeshGroup(PaletteIndex);
+	if (MeshGroup == INDEX_NONE)
+	{
+		return;
+	}
+
+	// 착지한 블록 아랫면 네 모서리에서 작은 조각이 튐 (세게 떨어질수록 멀리)
+	const float CellSize = Grid->GetGridSize();
+	const float SpeedScale = FMath::Clamp(ImpactSpeed / 1000.0f, 0.3f, 1.0f);
+	const FVector Bottom = Center - FVector(0.0f, 0.0f, CellSize * 0.5f);
+
+	for (int32 Corner = 0; Corner < 4; ++Corner)
+	{
+		const FVector Outward((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, 0.0f);
+		const FVector Location = Bottom + Outward * (CellSize * 0.5f);
+
+		FVector Velocity = Outward.GetSafeNormal() * Random.FRandRange(100.0f, 200.0f) * SpeedScale;
+		Velocity.Z = Random.FRandRange(150.0f, 250.0f) * SpeedScale;
+
+		const float Scale = (CellSize * 0.15f / BlockDebris::MeshSize) * Random.FRandRange(0.7f, 1.2f);
+		SpawnFragment(Location, Velocity, Scale, Random.FRandRange(0.8f, 1.2f), MeshGroup);
+	}
+}
+
+void UBlockDebrisSubsystem::SpawnFragment(const FVector& Location, const FVector& Velocity, float Scale, float Lifetime, int32 MeshGroup)
+{
+	// 링 순서로 슬롯을 할당하므로, 풀이 가득 차면 가장 오래 전에 만든 파편을 덮어씀
+	const int32 Slot = NextSlot;
+	NextSlot = (NextSlot + 1) % DebrisCapacity;
+
+	if (!(States[Slot] & BlockDebris::Alive))
+	{
+		++NumAlive;
+	}
+
+	Positions[Slot] = FVector3f(Location);
+	Velocities[Slot] = FVector3f(Velocity);
+	Rotations[Slot] = FVector3f(Random.FRandRange(0.0f, 360.0f), Random.FRandRange(0.0f, 360.0f), 0.0f);
+	AngularVelocities[Slot] = FVector3f(Random.FRandRange(-360.0f, 360.0f), Random.FRandRange(-360.0f, 360.0f), Random.FRandRange(-360.0f, 360.0f));
+	Ages[Slot] = 0.0f;
+	Lifetimes[Slot] = Lifetime;
+	Scales[Slot] = Scale;
+	States[Slot] = BlockDebris::Alive;
+	MeshGroups[Slot] = static_cast<uint8>(MeshGroup);
+}
+
+int32 UBlockDebrisSubsystem::FindOrAddMeshGroup(uint16 PaletteIndex)
+{
+	if (const int32* Found = PaletteMeshGroups.Find(PaletteIndex))
+	{
+		return *Found;
+	}
+
+	// 1. 팔레트 블록 클래스의 기본 메시/머티리얼 조회
+	UWorld* World = GetWorld();
+	const TSubclassOf<ABlockBase> BlockClass = Grid ? Grid->GetPaletteClass(PaletteIndex) : nullptr;
+	const ABlockBase* CDO = BlockClass ? BlockClass->GetDefaultObject<ABlockBase>() : nullptr;
+	const UStaticMeshComponent* SourceMesh = CDO ? CDO->GetBlockMesh() : nullptr;
+	if (!World || !SourceMesh || !SourceMesh->GetStaticMesh())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockDebrisSubsystem: Block mesh of palette index %d is not valid"), PaletteIndex);
+		return INDEX_NONE;
+	}
+
+	// 2. 같은 메시/머티리얼을 쓰는 그룹이 이미 있으면 공유
+	for (int32 Group = 0; Group < DebrisMeshes.Num(); ++Group)
+	{
+		const UInstancedStaticMeshComponent* GroupMesh = DebrisMeshes[Group];
+		bool bSameLook = GroupMesh->GetStaticMesh() == SourceMesh->GetStaticMesh()
+			&& GroupMesh->GetNumMaterials() == SourceMesh->GetNumMaterials();
+		for (int32 MaterialIndex = 0; bSameLook && MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+		{
+			bSameLook = GroupMesh->GetMaterial(MaterialIndex) == SourceMesh->GetMaterial(MaterialIndex);
+		}
+
+		if (bSameLook)
+		{
+			PaletteMeshGroups.Add(PaletteIndex, Group);
+			return Group;
+		}
+	}
+
+	if (DebrisMeshes.Num() >= BlockDebris::MaxMeshGroups)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockDebrisSubsystem: Too many debris mesh groups, reusing the first one"));
+		PaletteMeshGroups.Add(PaletteIndex, 0);
+		return 0;
+	}
+
+	// 3. 모든 그룹이 공유하는 액터는 처음 한 번만 생성
+	if (!DebrisActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		DebrisActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!DebrisActor)
+		{
+			UE_LOG(LogTemp, Error, TEXT("BlockDebrisSubsystem: Failed to spawn debris actor"));
+			return INDEX_NONE;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(DebrisActor);
+		DebrisActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	// 4. 새 메시/머티리얼 조합의 인스턴스 메시 생성
+	UInstancedStaticMeshComponent* DebrisMesh = NewObject<UInstancedStaticMeshComponent>(DebrisActor);
+	DebrisMesh->SetStaticMesh(SourceMesh->GetStaticMesh());
+	for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+	{
+		DebrisMesh->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+	}
+	DebrisMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	DebrisMesh->SetCastShadow(false);
+	DebrisMesh->SetupAttachment(DebrisActor->GetRootComponent());
+	DebrisMesh->RegisterComponent();
+
+	// 인스턴스는 풀 용량만큼 미리 만들어두고, 죽은 파편과 다른 그룹의 파편은 크기 0으로 숨김
+	TArray<FTransform> HiddenTransforms;
+	HiddenTransforms.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), DebrisCapacity);
+	DebrisMesh->AddInstances(HiddenTransforms, false, false);
+
+	const int32 Group = DebrisMeshes.Add(DebrisMesh);
+	PaletteMeshGroups.Add(PaletteIndex, Group);
+	return Group;
+}
+
+void UBlockDebrisSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 이번 프레임에 확정된 파괴 파편 생성
+	FlushPendingRemovals();
+
+	// 프레임 드랍 시 파편이 블록을 뚫지 않도록 한 번의 이동량 제한
+	SimulateFragments(FMath::Min(DeltaTime, 0.05f));
+	UpdateDebrisMesh();
+}
+
+void UBlockDebrisSubsystem::SimulateFragments(float DeltaTime)
+{
+	if (!Grid || NumAlive == 0)
+	{
+		return;
+	}
+
+	const float HalfCell = Grid->GetGridSize() * 0.5f;
+
+	for (int32 Index = 0; Index < DebrisCapacity; ++Index)
+	{
+		uint8& State = States[Index];
+		if (!(State & BlockDebris::Alive))
+		{
+			continue;
+		}
+
+		// 1. 수명 종료
+		Ages[Index] += DeltaTime;
+		if (Ages[Index] >= Lifetimes[Index] || Positions[Index].Z < BlockDebris::KillZ)
+		{
+			State = 0;
+			--NumAlive;
+			bVisualDirty = true;
+			continue;
+		}
+
+		FVector3f& Position = Positions[Index];
+		FVector3f& Velocity = Velocities[Index];
+		const float HalfSize = Scales[Index] * BlockDebris::MeshSize * 0.5f;
+
+		// 2. 멈춰 있는 파편은 아래 블록이 사라졌을 때만 다시 떨어짐
+		if (State & BlockDebris::Resting)
+		{
+			const FIntVector Below = Grid->WorldToCell(FVector(Position.X, Position.Y, Position.Z - HalfSize - 1.0f));
+			if (Grid->IsCellOccupied(Below))
+			{
+				continue;
+			}
+			State &= ~BlockDebris::Resting;
+		}
+
+		// 3. 탄도 운동
+		Velocity.Z += BlockDebris::Gravity * DeltaTime;
+		Position += Velocity * DeltaTime;
+		Rotations[Index] += AngularVelocities[Index] * DeltaTime;
+
+		// 4. 그리드 블록 윗면과 충돌 (파편 아랫면이 들어간 셀이 점유되어 있으면 그 셀 윗면으로 올림)
+		const FIntVector Cell = Grid->WorldToCell(FVector(Position.X, Position.Y, Position.Z - HalfSize));
+		if (Velocity.Z <= 0.0f && Grid->IsCellOccupied(Cell))
+		{
+			Position.Z = static_cast<float>(Grid->CellToWorld(Cell).Z) + HalfCell + HalfSize;
+			Velocity.Z = -Velocity.Z * BlockDebris::Restitution;
+			Velocity.X *= BlockDebris::Friction;
+			Velocity.Y *= BlockDebris::Friction;
+			AngularVelocities[Index] *= BlockDebris::Friction;
+
+			if (Velocity.Z < BlockDebris::RestSpeed)
+			{
+				Velocity = FVector3f::ZeroVector;
+				AngularVelocities[Index] = FVector3f::ZeroVector;
+				State |= BlockDebris::Resting;
+			}
+		}
+	}
+}
+
+void UBlockDebrisSubsystem::UpdateDebrisMesh()
+{
+	// 그룹마다 자기 파편만 보이고 나머지 슬롯은 크기 0 (그룹 수는 블록 머티리얼 종류 수 정도로 작음)
+	for (int32 Group = 0; Group < DebrisMeshes.Num(); ++Group)
+	{
+		// 살아있는 파편은 수명 끝에서 크기가 줄어들고, 죽은 파편은 크기 0
+		for (int32 Index = 0; Index < DebrisCapacity; ++Index)
+		{
+			if (!(States[Index] & BlockDebris::Alive) || MeshGroups[Index] != Group)
+			{
+				InstanceTransforms[Index].SetScale3D(FVector::ZeroVector);
+				continue;
+			}
+
+			const float Remaining = Lifetimes[Index] - Ages[Index];
+			const float Shrink = FMath::Clamp(Remaining / BlockDebris::ShrinkTime, 0.0f, 1.0f);
+			const FVector3f& Rotation = Rotations[Index];
+
+			InstanceTransforms[Index] = FTransform(
+				FRotator(Rotation.X, Rotation.Y, Rotation.Z),
+				FVector(Positions[Index]),
+				FVector(Scales[Index] * Shrink));
+		}
+
+		// 그룹당 프레임마다 한 번의 일괄 갱신
+		DebrisMeshes[Group]->BatchUpdateInstancesTransforms(0, InstanceTransforms, false, true, true);
+	}
+	bVisualDirty = false;
+}
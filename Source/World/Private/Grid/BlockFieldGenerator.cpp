@@ -0,0 +1,122 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockFieldGenerator.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Block/BlockBase.h"
+#include "Block/DestructibleBlock.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+namespace BlockFieldGenerator
+{
+	int32 SpawnBlockField(UWorld* World, TSubclassOf<ABlockBase> BlockClass, const FBlockFieldParams& Params)
+	{
+		UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+		if (!Grid || !BlockClass)
+		{
+			UE_LOG(LogTemp, Error, TEXT("BlockFieldGenerator: World, BlockGridSubsystem or BlockClass is null"));
+			return 0;
+		}
+
+		// 난수는 셀 순서대로 한 번씩만 뽑으므로 같은 시드면 같은 지형
+		FRandomStream Stream(Params.Seed);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		FBlockGridBatchScope BatchScope(Grid);
+
+		int32 NumSpawned = 0;
+		for (int32 Y = 0; Y < Params.SizeY; ++Y)
+		{
+			for (int32 X = 0; X < Params.SizeX; ++X)
+			{
+				// 이 기둥에서 쓸 난수를 먼저 모두 뽑아 건너뛰는 셀이 있어도 다음 기둥의 난수가 밀리지 않도록 함
+				const bool bHasColumn = Stream.FRand() < Params.Density;
+				const int32 Height = Stream.RandRange(1, FMath::Max(Params.MaxHeight, 1));
+				if (!bHasColumn)
+				{
+					continue;
+				}
+
+				for (int32 Z = 0; Z < Height; ++Z)
+				{
+					const FIntVector Cell = Params.OriginCell + FIntVector(X, Y, Z);
+					if (Grid->IsCellOccupied(Cell))
+					{
+						continue;
+					}
+
+					const FVector Location = Grid->CellToWorld(Cell);
+					ABlockBase* Block = World->SpawnActor<ABlockBase>(BlockClass, Location, FRotator::ZeroRotator, SpawnParams);
+					if (!Block)
+					{
+						UE_LOG(LogTemp, Error, TEXT("BlockFieldGenerator: Failed to spawn block at cell %s"), *Cell.ToString());
+						continue;
+					}
+
+					Block->SpawnBlock(Location, EBlockType::Destructible);
+					++NumSpawned;
+				}
+			}
+		}
+
+		return NumSpawned;
+	}
+}
+
+// Grid.SpawnField <Seed> <SizeX> <SizeY> <MaxHeight> [Density] [BlockClassPath]
+static FAutoConsoleCommandWithWorldAndArgs GridSpawnFieldCommand(
+	TEXT("Grid.SpawnField"),
+	TEXT("시드 기반 블록 지형을 생성합니다. Grid.SpawnField <Seed> <SizeX> <SizeY> <MaxHeight> [Density] [BlockClassPath]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() < 4)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Grid.SpawnField: Usage Grid.SpawnField <Seed> <SizeX> <SizeY> <MaxHeight> [Density] [BlockClassPath]"));
+			return;
+		}
+
+		BlockFieldGenerator::FBlockFieldParams Params;
+		Params.Seed = FCString::Atoi(*Args[0]);
+		Params.SizeX = FCString::Atoi(*Args[1]);
+		Params.SizeY = FCString::Atoi(*Args[2]);
+		Params.MaxHeight = FCString::Atoi(*Args[3]);
+		Params.Density = Args.IsValidIndex(4) ? FCString::Atof(*Args[4]) : 1.0f;
+
+		// 클래스 경로가 없으면 기본 파괴 가능 블록 (메시가 없어도 그리드 판정에는 충분)
+		TSubclassOf<ABlockBase> BlockClass = ADestructibleBlock::StaticClass();
+		if (Args.IsValidIndex(5))
+		{
+			BlockClass = LoadClass<ABlockBase>(nullptr, *Args[5]);
+			if (!BlockClass)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Grid.SpawnField: Failed to load block class %s"), *Args[5]);
+				return;
+			}
+		}
+
+		const int32 NumSpawned = BlockFieldGenerator::SpawnBlockField(World, BlockClass, Params);
+		UE_LOG(LogTemp, Display, TEXT("Grid.SpawnField: Seed=%d Size=%dx%d MaxHeight=%d Spawned=%d"),
+			Params.Seed, Params.SizeX, Params.SizeY, Params.MaxHeight, NumSpawned);
+	}));
+
+// Grid.LogStateHash
+static FAutoConsoleCommandWithWorld GridLogStateHashCommand(
+	TEXT("Grid.LogStateHash"),
+	TEXT("현재 블록 그리드 상태 해시를 로그로 출력합니다. (헤드리스 실행 결과 비교용)"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UBlockGridSubsystem* Grid = World ? World->GetSubsystem<UBlockGridSubsystem>() : nullptr;
+		if (!Grid)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Grid.LogStateHash: BlockGridSubsystem is null"));
+			return;
+		}
+
+		TArray<FIntVector> ChunkCoords;
+		Grid->GetChunkCoords(ChunkCoords);
+		UE_LOG(LogTemp, Display, TEXT("Grid.LogStateHash: Hash=%08x Chunks=%d"), Grid->GetStateHash(), ChunkCoords.Num());
+	}));
@@ -0,0 +1,160 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockGridShapes.h"
+
+namespace BlockGridShapes
+{
+	void RasterizeLine(const FIntVector& From, const FIntVector& To, TArray<FIntVector>& OutCells)
+	{
+		// 정수 Bresenham (모든 기울기, 8방향 연결)
+		const int32 DX = FMath::Abs(To.X - From.X);
+		const int32 DY = -FMath::Abs(To.Y - From.Y);
+		const int32 StepX = (From.X < To.X) ? 1 : -1;
+		const int32 StepY = (From.Y < To.Y) ? 1 : -1;
+
+		OutCells.Reserve(OutCells.Num() + CountLineCells(From, To));
+
+		int32 X = From.X;
+		int32 Y = From.Y;
+		int32 Error = DX + DY;
+
+		while (true)
+		{
+			OutCells.Add(FIntVector(X, Y, From.Z));
+
+			if (X == To.X && Y == To.Y)
+			{
+				break;
+			}
+
+			const int32 Error2 = Error * 2;
+			if (Error2 >= DY)
+			{
+				Error += DY;
+				X += StepX;
+			}
+			if (Error2 <= DX)
+			{
+				Error += DX;
+				Y += StepY;
+			}
+		}
+	}
+
+	void RasterizeRect(const FIntVector& From, const FIntVector& To, TArray<FIntVector>& OutCells)
+	{
+		const int32 MinX = FMath::Min(From.X, To.X);
+		const int32 MaxX = FMath::Max(From.X, To.X);
+		const int32 MinY = FMath::Min(From.Y, To.Y);
+		const int32 MaxY = FMath::Max(From.Y, To.Y);
+
+		OutCells.Reserve(OutCells.Num() + CountRectCells(From, To));
+
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				OutCells.Add(FIntVector(X, Y, From.Z));
+			}
+		}
+	}
+
+	int32 CountLineCells(const FIntVector& From, const FIntVector& To)
+	{
+		// Bresenham은 긴 축의 길이 + 1개의 셀을 지남
+		return FMath::Max(FMath::Abs(To.X - From.X), FMath::Abs(To.Y - From.Y)) + 1;
+	}
+
+	int32 CountRectCells(const FIntVector& From, const FIntVector& To)
+	{
+		const int64 Width = FMath::Abs(static_cast<int64>(To.X) - From.X) + 1;
+		const int64 Depth = FMath::Abs(static_cast<int64>(To.Y) - From.Y) + 1;
+		return static_cast<int32>(FMath::Min<int64>(Width * Depth, MAX_int32));
+	}
+
+	void RasterizeOrientedBox(const FVector& Center, const FQuat& Rotation, const FVector& Extent, double CellHalfSize, TArray<FIntVector>& OutCells)
+	{
+		// 1. 분리축 후보 15개와 각 축에서 두 도형의 투영 반지름 합을 미리 계산
+		// 셀 크기와 박스 회전은 모든 셀이 같으므로, 셀마다 남는 계산은 중심 차이의 내적뿐
+		const FVector BoxAxes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+		const FVector WorldAxes[3] = { FVector::XAxisVector, FVector::YAxisVector, FVector::ZAxisVector };
+
+		struct FSeparatingAxis
+		{
+			FVector Axis;
+			double Radius;
+		};
+		TArray<FSeparatingAxis, TInlineAllocator<15>> Axes;
+
+		auto AddAxis = [&](const FVector& Axis)
+		{
+			// 평행한 축끼리의 외적은 0이 되며, 이 경우는 면 축 검사로 이미 다뤄짐
+			if (Axis.SizeSquared() < UE_KINDA_SMALL_NUMBER)
+			{
+				return;
+			}
+
+			const double CellRadius = CellHalfSize * (FMath::Abs(Axis.X) + FMath::Abs(Axis.Y) + FMath::Abs(Axis.Z));
+			const double BoxRadius =
+				Extent.X * FMath::Abs(FVector::DotProduct(BoxAxes[0], Axis)) +
+				Extent.Y * FMath::Abs(FVector::DotProduct(BoxAxes[1], Axis)) +
+				Extent.Z * FMath::Abs(FVector::DotProduct(BoxAxes[2], Axis));
+			Axes.Add({ Axis, CellRadius + BoxRadius });
+		};
+
+		for (const FVector& WorldAxis : WorldAxes)
+		{
+			AddAxis(WorldAxis);
+		}
+		for (const FVector& BoxAxis : BoxAxes)
+		{
+			AddAxis(BoxAxis);
+		}
+		for (const FVector& WorldAxis : WorldAxes)
+		{
+			for (const FVector& BoxAxis : BoxAxes)
+			{
+				AddAxis(FVector::CrossProduct(WorldAxis, BoxAxis));
+			}
+		}
+
+		// 2. 박스의 축 정렬 범위 = 월드 축 투영 반지름 (처음 세 축)
+		// 셀 중심이 (Center - Radius, Center + Radius) 열린 구간 안에 있는 셀만 후보
+		const FIntVector MinCell(
+			FMath::FloorToInt(Center.X - Axes[0].Radius) + 1,
+			FMath::FloorToInt(Center.Y - Axes[1].Radius) + 1,
+			FMath::FloorToInt(Center.Z - Axes[2].Radius) + 1);
+		const FIntVector MaxCell(
+			FMath::CeilToInt(Center.X + Axes[0].Radius) - 1,
+			FMath::CeilToInt(Center.Y + Axes[1].Radius) - 1,
+			FMath::CeilToInt(Center.Z + Axes[2].Radius) - 1);
+
+		// 3. 후보 셀마다 나머지 축에서 분리되는지 검사 (월드 축은 범위 계산으로 이미 통과)
+		for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					const FVector Delta = FVector(X, Y, Z) - Center;
+
+					bool bSeparated = false;
+					for (int32 AxisIndex = 3; AxisIndex < Axes.Num(); ++AxisIndex)
+					{
+						if (FMath::Abs(FVector::DotProduct(Delta, Axes[AxisIndex].Axis)) >= Axes[AxisIndex].Radius)
+						{
+							bSeparated = true;
+							break;
+						}
+					}
+
+					if (!bSeparated)
+					{
+						OutCells.Add(FIntVector(X, Y, Z));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,927 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockGridSubsystem.h"
+#include "Grid/BlockGridShapes.h"
+#include "Block/BlockBase.h"
+#include "Engine/World.h"
+
+void UBlockGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 0번 팔레트는 빈 칸 전용
+	Palette.Reset();
+	Palette.Add(nullptr);
+}
+
+void UBlockGridSubsystem::Deinitialize()
+{
+	Chunks.Empty();
+	CellActors.Empty();
+	ChunkEditStamps.Empty();
+	Palette.Empty();
+	BatchEditedChunks.Empty();
+	BatchEvents.Empty();
+	BatchDepth = 0;
+
+	Super::Deinitialize();
+}
+
+bool UBlockGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// 에디터 월드에서는 블록이 BeginPlay를 하지 않으므로 게임 월드에서만 생성
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FIntVector UBlockGridSubsystem::WorldToCell(const FVector& WorldLocation) const
+{
+	const float HalfSize = GridSize / 2.0f;
+	return FIntVector(
+		FMath::RoundToInt(WorldLocation.X / GridSize),
+		FMath::RoundToInt(WorldLocation.Y / GridSize),
+		FMath::RoundToInt((WorldLocation.Z - HalfSize) / GridSize));
+}
+
+FVector UBlockGridSubsystem::CellToWorld(const FIntVector& Cell) const
+{
+	return FVector(Cell.X * GridSize, Cell.Y * GridSize, Cell.Z * GridSize + GridSize / 2.0f);
+}
+
+void UBlockGridSubsystem::RegisterBlock(ABlockBase* Block)
+{
+	if (!Block)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockGridSubsystem::RegisterBlock - Block is null"));
+		return;
+	}
+
+	// 이미 같은 셀에 등록된 블록은 그대로 둠 (셀 체력과 편집 번호를 초기화하지 않음)
+	// 다른 셀에 등록되어 있다면 먼저 해제
+	const FIntVector Cell = WorldToCell(Block->GetActorLocation());
+	if (Block->bRegisteredInGrid)
+	{
+		if (Block->GridCell == Cell)
+		{
+			return;
+		}
+		UnregisterBlock(Block, true);
+	}
+
+	// 낙하 후 착지인지 (낙하 시작 셀은 GridCell에 남아있음)
+	const bool bLanded = Block->bLeftGridByFalling;
+	const FIntVector FromCell = Block->GridCell;
+
+	FallingBlocks.Remove(Block);
+
+	Block->GridCell = Cell;
+	Block->bRegisteredInGrid = true;
+	Block->bLeftGridByFalling = false;
+	CellActors.Add(Cell, Block);
+
+	// 복원 중에는 셀 데이터가 이미 스냅샷 상태이므로 액터 매핑만 갱신
+	if (bIsRestoring)
+	{
+		return;
+	}
+
+	const FBlockGridCell NewValue = MakeCellValue(Block);
+	WriteCell(Cell, NewValue);
+
+	// 낙하 전에 입은 피해를 착지한 셀로 옮김
+	if (Block->CarriedHitPoints > 0)
+	{
+		WriteCellHitPoints(Cell, Block->CarriedHitPoints, Block->GetMaxHitPoints());
+		Block->CarriedHitPoints = 0;
+	}
+
+	FBlockGridEvent Event;
+	Event.Type = bLanded ? EBlockGridEventType::Moved : EBlockGridEventType::Added;
+	Event.Cell = Cell;
+	Event.FromCell = bLanded ? FromCell : Cell;
+	Event.Value = NewValue;
+	BroadcastBlockEvent(Event);
+}
+
+void UBlockGridSubsystem::UnregisterBlock(ABlockBase* Block, bool bFalling)
+{
+	if (!Block)
+	{
+		return;
+	}
+
+	// 낙하 중에 파괴된 블록: 셀 데이터는 낙하 시작 시 이미 비웠으므로 이벤트만 발생
+	if (!Block->bRegisteredInGrid)
+	{
+		if (Block->bLeftGridByFalling && !bFalling)
+		{
+			Block->bLeftGridByFalling = false;
+			FallingBlocks.Remove(Block);
+
+			if (!bIsRestoring)
+			{
+				FBlockGridEvent Event;
+				Event.Type = EBlockGridEventType::Removed;
+				Event.Cell = Block->GridCell;
+				Event.FromCell = Block->GridCell;
+				Event.Value = MakeCellValue(Block);
+				Event.Location = Block->GetActorLocation();
+				BroadcastBlockEvent(Event);
+			}
+		}
+		return;
+	}
+
+	const FIntVector Cell = Block->GridCell;
+	Block->bRegisteredInGrid = false;
+	Block->bLeftGridByFalling = bFalling;
+
+	// 같은 셀에 다른 블록이 나중에 등록된 경우, 그 블록의 정보는 건드리지 않음
+	const TWeakObjectPtr<ABlockBase>* Owner = CellActors.Find(Cell);
+	if (!Owner || Owner->Get() != Block)
+	{
+		Block->bLeftGridByFalling = false;
+		return;
+	}
+
+	CellActors.Remove(Cell);
+
+	if (bIsRestoring)
+	{
+		return;
+	}
+
+	if (bFalling)
+	{
+		FallingBlocks.Add(Block);
+	}
+
+	const FBlockGridCell OldValue = GetCell(Cell);
+
+	// 낙하하는 블록은 손상 상태를 들고 내려감 (셀을 비우면 체력 기록도 지워지므로 먼저 보관)
+	if (bFalling)
+	{
+		const int32 HitPoints = GetCellHitPoints(Cell);
+		Block->CarriedHitPoints = (HitPoints < Block->GetMaxHitPoints()) ? static_cast<uint16>(HitPoints) : 0;
+	}
+
+	WriteCell(Cell, FBlockGridCell());
+
+	// 낙하는 착지 시 Moved 이벤트 하나로 알림
+	if (!bFalling)
+	{
+		FBlockGridEvent Event;
+		Event.Type = EBlockGridEventType::Removed;
+		Event.Cell = Cell;
+		Event.FromCell = Cell;
+		Event.Value = OldValue;
+		Event.Location = Block->GetActorLocation();
+		BroadcastBlockEvent(Event);
+	}
+}
+
+void UBlockGridSubsystem::NotifyBombCountChanged(ABlockBase* Block, int32 OldCount, int32 NewCount)
+{
+	if (!Block || !Block->bRegisteredInGrid || bIsRestoring || OldCount == NewCount)
+	{
+		return;
+	}
+
+	FBlockGridEvent Event;
+	Event.Type = EBlockGridEventType::BombCountChanged;
+	Event.Cell = Block->GridCell;
+	Event.FromCell = Block->GridCell;
+	Event.Value = GetCell(Block->GridCell);
+	Event.OldBombCount = static_cast<uint8>(FMath::Clamp(OldCount, 0, 255));
+	Event.NewBombCount = static_cast<uint8>(FMath::Clamp(NewCount, 0, 255));
+	BroadcastBlockEvent(Event);
+}
+
+FBlockGridCell UBlockGridSubsystem::MakeCellValue(ABlockBase* Block)
+{
+	FBlockGridCell Value;
+	Value.PaletteIndex = FindOrAddPaletteIndex(Block->GetClass());
+	Value.BlockType = Block->GetBlockType();
+	Value.Flags = Block->IsPredicted() ? BLOCK_CELL_FLAG_PREDICTED : 0;
+	return Value;
+}
+
+bool UBlockGridSubsystem::IsCellOccupied(const FIntVector& Cell) const
+{
+	const FBlockGridCell* Found = FindCell(Cell);
+	return Found && !Found->IsEmpty();
+}
+
+void UBlockGridSubsystem::GetCellsOccupancy(TConstArrayView<FIntVector> Cells, TBitArray<>& OutOccupied) const
+{
+	OutOccupied.Init(false, Cells.Num());
+
+	// 연속된 셀은 대부분 같은 청크에 있으므로 직전 청크를 캐시하여 맵 조회를 줄임
+	FIntVector CachedChunkCoord(MAX_int32);
+	const FBlockGridChunk* CachedChunk = nullptr;
+
+	for (int32 i = 0; i < Cells.Num(); ++i)
+	{
+		const FIntVector ChunkCoord = BlockGrid::CellToChunk(Cells[i]);
+		if (ChunkCoord != CachedChunkCoord)
+		{
+			CachedChunkCoord = ChunkCoord;
+			const FBlockGridChunkPtr* Found = Chunks.Find(ChunkCoord);
+			CachedChunk = (Found && Found->IsValid()) ? Found->Get() : nullptr;
+		}
+
+		if (CachedChunk && !CachedChunk->Cells[FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cells[i]))].IsEmpty())
+		{
+			OutOccupied[i] = true;
+		}
+	}
+}
+
+FBlockGridCell UBlockGridSubsystem::GetCell(const FIntVector& Cell) const
+{
+	const FBlockGridCell* Found = FindCell(Cell);
+	return Found ? *Found : FBlockGridCell();
+}
+
+bool UBlockGridSubsystem::GetCellRangeInBox(const FBox& WorldBox, FIntVector& OutMinCell, FIntVector& OutMaxCell) const
+{
+	if (!WorldBox.IsValid)
+	{
+		return false;
+	}
+
+	// 블록 충돌 박스(49.5)와 엄격하게 겹치는 셀만 포함 (맞닿기만 한 이웃 셀 제외)
+	const float Half = GridSize * 0.495f;
+	const float HalfGrid = GridSize / 2.0f;
+
+	OutMinCell = FIntVector(
+		FMath::FloorToInt((WorldBox.Min.X - Half) / GridSize) + 1,
+		FMath::FloorToInt((WorldBox.Min.Y - Half) / GridSize) + 1,
+		FMath::FloorToInt((WorldBox.Min.Z - HalfGrid - Half) / GridSize) + 1);
+	OutMaxCell = FIntVector(
+		FMath::CeilToInt((WorldBox.Max.X + Half) / GridSize) - 1,
+		FMath::CeilToInt((WorldBox.Max.Y + Half) / GridSize) - 1,
+		FMath::CeilToInt((WorldBox.Max.Z - HalfGrid + Half) / GridSize) - 1);
+
+	return OutMinCell.X <= OutMaxCell.X && OutMinCell.Y <= OutMaxCell.Y && OutMinCell.Z <= OutMaxCell.Z;
+}
+
+void UBlockGridSubsystem::GetOccupiedCellsInBox(const FBox& WorldBox, TArray<FIntVector>& OutCells) const
+{
+	FIntVector MinCell, MaxCell;
+	if (!GetCellRangeInBox(WorldBox, MinCell, MaxCell))
+	{
+		return;
+	}
+
+	for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				const FIntVector Cell(X, Y, Z);
+				if (IsCellOccupied(Cell))
+				{
+					OutCells.Add(Cell);
+				}
+			}
+		}
+	}
+}
+
+void UBlockGridSubsystem::GetOccupiedCellsInOrientedBox(const FVector& Center, const FQuat& Rotation, const FVector& Extent, TArray<FIntVector>& OutCells) const
+{
+	if (GridSize <= 0.0f)
+	{
+		return;
+	}
+
+	// 1. 셀 공간으로 변환 (셀 (0,0,0)의 중심이 원점, 셀 한 칸이 1)
+	// 블록 충돌 박스(49.5)와 엄격하게 겹치는 셀만 포함 (GetCellRangeInBox와 같은 규칙)
+	const FVector CellSpaceCenter = (Center - CellToWorld(FIntVector::ZeroValue)) / GridSize;
+	const FVector CellSpaceExtent = Extent / GridSize;
+
+	TArray<FIntVector> Cells;
+	BlockGridShapes::RasterizeOrientedBox(CellSpaceCenter, Rotation, CellSpaceExtent, 0.495, Cells);
+	if (Cells.Num() == 0)
+	{
+		return;
+	}
+
+	// 2. 점유된 셀만 골라냄 (같은 청크 조회 재사용)
+	TBitArray<> Occupied;
+	GetCellsOccupancy(Cells, Occupied);
+	for (int32 Index = 0; Index < Cells.Num(); ++Index)
+	{
+		if (Occupied[Index])
+		{
+			OutCells.Add(Cells[Index]);
+		}
+	}
+}
+
+ABlockBase* UBlockGridSubsystem::GetBlockAt(const FIntVector& Cell) const
+{
+	const TWeakObjectPtr<ABlockBase>* Found = CellActors.Find(Cell);
+	return Found ? Found->Get() : nullptr;
+}
+
+int32 UBlockGridSubsystem::GetCellHitPoints(const FIntVector& Cell) const
+{
+	const FBlockGridChunkPtr* Chunk = Chunks.Find(BlockGrid::CellToChunk(Cell));
+	if (!Chunk || !Chunk->IsValid())
+	{
+		return 0;
+	}
+
+	const int32 Index = FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell));
+	const FBlockGridCell& Value = (*Chunk)->Cells[Index];
+	if (Value.IsEmpty())
+	{
+		return 0;
+	}
+
+	if (const uint16* HitPoints = (*Chunk)->HitPoints.Find(static_cast<uint16>(Index)))
+	{
+		return *HitPoints;
+	}
+
+	return GetPaletteMaxHitPoints(Value.PaletteIndex);
+}
+
+int32 UBlockGridSubsystem::ApplyCellDamage(const TArray<FIntVector>& Cells, float Damage)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockGridSubsystem::ApplyCellDamage - World is null"));
+		return 0;
+	}
+
+	// 블록 파괴는 서버에서만 결정
+	if (World->GetNetMode() == NM_Client)
+	{
+		return 0;
+	}
+
+	const int32 DamageAmount = FMath::Clamp(FMath::RoundToInt(Damage), 0, static_cast<int32>(MAX_uint16));
+	if (DamageAmount <= 0 || Cells.Num() == 0)
+	{
+		return 0;
+	}
+
+	TSet<FIntVector> Visited;
+	Visited.Reserve(Cells.Num());
+
+	TArray<ABlockBase*> BlocksToDestroy;
+
+	// 1. 셀 체력 갱신 (청크당 복사는 최초 쓰기 한 번만 일어남)
+	for (const FIntVector& Cell : Cells)
+	{
+		bool bAlreadyVisited = false;
+		Visited.Add(Cell, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			continue;
+		}
+
+		ABlockBase* Block = GetBlockAt(Cell);
+		if (!Block || !Block->CanBeDestroyed() || !IsCellOccupied(Cell))
+		{
+			continue;
+		}
+
+		const int32 MaxHitPoints = Block->GetMaxHitPoints();
+		const int32 NewHitPoints = GetCellHitPoints(Cell) - DamageAmount;
+
+		if (NewHitPoints <= 0)
+		{
+			// 파괴 시 셀이 비워지면서 체력 기록도 함께 지워짐
+			BlocksToDestroy.Add(Block);
+			continue;
+		}
+
+		WriteCellHitPoints(Cell, NewHitPoints, MaxHitPoints);
+		Block->UpdateCrackStage(NewHitPoints);
+	}
+
+	// 2. 체력이 다한 블록 파괴
+	for (ABlockBase* Block : BlocksToDestroy)
+	{
+		Block->DestroyBlock();
+	}
+
+	return BlocksToDestroy.Num();
+}
+
+int32 UBlockGridSubsystem::GetPaletteMaxHitPoints(uint16 PaletteIndex) const
+{
+	TSubclassOf<ABlockBase> BlockClass = GetPaletteClass(PaletteIndex);
+	const ABlockBase* CDO = BlockClass ? BlockClass->GetDefaultObject<ABlockBase>() : nullptr;
+	return CDO ? CDO->GetMaxHitPoints() : 1;
+}
+
+void UBlockGridSubsystem::WriteCellHitPoints(const FIntVector& Cell, int32 HitPoints, int32 MaxHitPoints)
+{
+	if (!IsCellOccupied(Cell))
+	{
+		return;
+	}
+
+	FBlockGridChunk* Chunk = nullptr;
+	GetMutableCell(Cell, Chunk);
+
+	const uint16 Index = static_cast<uint16>(FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell)));
+	if (HitPoints >= MaxHitPoints)
+	{
+		Chunk->HitPoints.Remove(Index);
+	}
+	else
+	{
+		Chunk->HitPoints.Add(Index, static_cast<uint16>(FMath::Clamp(HitPoints, 1, static_cast<int32>(MAX_uint16))));
+	}
+}
+
+const FBlockGridCell* UBlockGridSubsystem::FindCell(const FIntVector& Cell) const
+{
+	const FBlockGridChunkPtr* Chunk = Chunks.Find(BlockGrid::CellToChunk(Cell));
+	if (!Chunk || !Chunk->IsValid())
+	{
+		return nullptr;
+	}
+
+	return &(*Chunk)->Cells[FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell))];
+}
+
+FBlockGridCell& UBlockGridSubsystem::GetMutableCell(const FIntVector& Cell, FBlockGridChunk*& OutChunk)
+{
+	FBlockGridChunkPtr& Chunk = Chunks.FindOrAdd(BlockGrid::CellToChunk(Cell));
+
+	if (!Chunk.IsValid())
+	{
+		Chunk = MakeShared<FBlockGridChunk, ESPMode::ThreadSafe>();
+	}
+	else if (!Chunk.IsUnique())
+	{
+		// 스냅샷과 공유 중인 청크 -> 쓰기 전에 복사
+		Chunk = MakeShared<FBlockGridChunk, ESPMode::ThreadSafe>(*Chunk);
+	}
+
+	OutChunk = Chunk.Get();
+	return Chunk->Cells[FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell))];
+}
+
+void UBlockGridSubsystem::WriteCell(const FIntVector& Cell, const FBlockGridCell& NewValue)
+{
+	// 값이 같다면 청크 복사를 일으키지 않도록 먼저 비교
+	const FBlockGridCell* Existing = FindCell(Cell);
+	if (Existing ? (*Existing == NewValue) : NewValue.IsEmpty())
+	{
+		return;
+	}
+
+	FBlockGridChunk* Chunk = nullptr;
+	FBlockGridCell& Target = GetMutableCell(Cell, Chunk);
+
+	Chunk->NumOccupied += (Target.IsEmpty() ? 0 : -1) + (NewValue.IsEmpty() ? 0 : 1);
+	Target = NewValue;
+
+	// 셀의 블록이 바뀌었으므로 이전 블록의 손상 기록은 버림
+	Chunk->HitPoints.Remove(static_cast<uint16>(FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell))));
+
+	MarkChunkEdited(BlockGrid::CellToChunk(Cell));
+
+	// 빈 청크는 제거하여 스냅샷/비교 비용을 줄임
+	if (Chunk->NumOccupied <= 0)
+	{
+		Chunks.Remove(BlockGrid::CellToChunk(Cell));
+	}
+}
+
+void UBlockGridSubsystem::MarkChunkEdited(const FIntVector& ChunkCoord)
+{
+	// 일괄 쓰기 중에는 청크만 모아두고 EndBatch에서 한 번에 갱신
+	if (BatchDepth > 0)
+	{
+		BatchEditedChunks.Add(ChunkCoord);
+		return;
+	}
+
+	ChunkEditStamps.Add(ChunkCoord, NextEditStamp++);
+}
+
+void UBlockGridSubsystem::BroadcastBlockEvent(const FBlockGridEvent& Event)
+{
+	if (BatchDepth > 0)
+	{
+		BatchEvents.Add(Event);
+		return;
+	}
+
+	OnBlockEvent.Broadcast(Event);
+}
+
+void UBlockGridSubsystem::BeginBatch()
+{
+	++BatchDepth;
+}
+
+void UBlockGridSubsystem::EndBatch()
+{
+	if (BatchDepth <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockGridSubsystem::EndBatch - BeginBatch was not called"));
+		return;
+	}
+
+	if (--BatchDepth > 0)
+	{
+		return;
+	}
+
+	// 1. 일괄 쓰기 동안 바뀐 청크는 같은 편집 번호 하나로 갱신
+	if (BatchEditedChunks.Num() > 0)
+	{
+		const uint32 Stamp = NextEditStamp++;
+		for (const FIntVector& ChunkCoord : BatchEditedChunks)
+		{
+			ChunkEditStamps.Add(ChunkCoord, Stamp);
+		}
+		BatchEditedChunks.Reset();
+	}
+
+	// 2. 모아둔 이벤트를 발생 순서대로 알림
+	// 리스너가 다시 그리드를 수정할 수 있으므로 배열을 먼저 비운 뒤 순회
+	TArray<FBlockGridEvent> Events = MoveTemp(BatchEvents);
+	BatchEvents.Reset();
+	for (const FBlockGridEvent& Event : Events)
+	{
+		OnBlockEvent.Broadcast(Event);
+	}
+}
+
+uint32 UBlockGridSubsystem::GetEditStampInBox(const FBox& WorldBox) const
+{
+	FIntVector MinCell, MaxCell;
+	if (!GetCellRangeInBox(WorldBox, MinCell, MaxCell))
+	{
+		return 0;
+	}
+
+	const FIntVector MinChunk = BlockGrid::CellToChunk(MinCell);
+	const FIntVector MaxChunk = BlockGrid::CellToChunk(MaxCell);
+
+	// 편집 번호는 전역으로 증가하므로, 범위 안 청크 중 최댓값이 바뀌었다면 범위 안에서 편집이 있었던 것
+	uint32 Stamp = 0;
+	for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
+	{
+		for (int32 Y = MinChunk.Y; Y <= MaxChunk.Y; ++Y)
+		{
+			for (int32 X = MinChunk.X; X <= MaxChunk.X; ++X)
+			{
+				Stamp = FMath::Max(Stamp, ChunkEditStamps.FindRef(FIntVector(X, Y, Z)));
+			}
+		}
+	}
+	return Stamp;
+}
+
+uint32 UBlockGridSubsystem::GetStateHash() const
+{
+	// 1. 청크 좌표 정렬 (TMap 순회 순서는 삽입/삭제 이력에 따라 달라짐)
+	TArray<FIntVector> ChunkCoords;
+	Chunks.GetKeys(ChunkCoords);
+	ChunkCoords.Sort([](const FIntVector& A, const FIntVector& B)
+	{
+		return A.Z != B.Z ? A.Z < B.Z : (A.Y != B.Y ? A.Y < B.Y : A.X < B.X);
+	});
+
+	// 팔레트 인덱스는 등록 순서에 따라 달라지므로 클래스 경로의 해시를 사용
+	TArray<uint32, TInlineAllocator<8>> PaletteHashes;
+	PaletteHashes.SetNumZeroed(Palette.Num());
+	for (int32 i = 1; i < Palette.Num(); ++i)
+	{
+		PaletteHashes[i] = Palette[i] ? FCrc::StrCrc32(*Palette[i]->GetPathName()) : 0;
+	}
+
+	// 2. 청크 안의 셀은 로컬 인덱스 순서로 누적
+	uint32 Hash = 0;
+	for (const FIntVector& ChunkCoord : ChunkCoords)
+	{
+		const FBlockGridChunkPtr& Chunk = Chunks.FindChecked(ChunkCoord);
+		if (!Chunk.IsValid())
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < BLOCK_GRID_CHUNK_CELLS; ++Index)
+		{
+			const FBlockGridCell& Value = Chunk->Cells[Index];
+			if (Value.IsEmpty())
+			{
+				continue;
+			}
+
+			const FIntVector Cell = BlockGrid::ChunkLocalToCell(ChunkCoord, Index);
+			const uint16* HitPoints = Chunk->HitPoints.Find(static_cast<uint16>(Index));
+			const int32 CellData[] = {
+				Cell.X, Cell.Y, Cell.Z,
+				static_cast<int32>(PaletteHashes.IsValidIndex(Value.PaletteIndex) ? PaletteHashes[Value.PaletteIndex] : 0),
+				static_cast<int32>(Value.BlockType),
+				static_cast<int32>(Value.Flags),
+				HitPoints ? static_cast<int32>(*HitPoints) : -1 };
+			Hash = FCrc::MemCrc32(CellData, sizeof(CellData), Hash);
+		}
+	}
+	return Hash;
+}
+
+void UBlockGridSubsystem::GetChunkCoords(TArray<FIntVector>& OutChunkCoords) const
+{
+	Chunks.GetKeys(OutChunkCoords);
+}
+
+void UBlockGridSubsystem::ForEachOccupiedCellInChunk(const FIntVector& ChunkCoord, TFunctionRef<void(const FIntVector&, const FBlockGridCell&)> Func) const
+{
+	const FBlockGridChunkPtr* Chunk = Chunks.Find(ChunkCoord);
+	if (!Chunk || !Chunk->IsValid())
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < BLOCK_GRID_CHUNK_CELLS; ++Index)
+	{
+		const FBlockGridCell& Cell = (*Chunk)->Cells[Index];
+		if (!Cell.IsEmpty())
+		{
+			Func(BlockGrid::ChunkLocalToCell(ChunkCoord, Index), Cell);
+		}
+	}
+}
+
+FBlockGridSnapshot UBlockGridSubsystem::TakeSnapshot()
+{
+	FBlockGridSnapshot Snapshot;
+	Snapshot.Chunks = Chunks;
+	Snapshot.Serial = NextSnapshotSerial++;
+
+	// 낙하 중인 블록은 셀 데이터에 없으므로, 낙하를 시작한 셀에 다시 써 넣음
+	// 복원 시 공중의 블록이 복원된 상태 위로 착지하는 대신, 그 셀에서 다시 시작한다.
+	// 라이브 청크와 공유 중이므로 해당 청크만 스냅샷 전용으로 복사
+	TSet<FIntVector> CopiedChunks;
+	for (const TWeakObjectPtr<ABlockBase>& FallingBlock : FallingBlocks)
+	{
+		ABlockBase* Block = FallingBlock.Get();
+		if (!Block || !Block->bLeftGridByFalling)
+		{
+			continue;
+		}
+
+		const FIntVector Cell = Block->GridCell;
+		const FIntVector ChunkCoord = BlockGrid::CellToChunk(Cell);
+		FBlockGridChunkPtr& Chunk = Snapshot.Chunks.FindOrAdd(ChunkCoord);
+		if (!Chunk.IsValid())
+		{
+			Chunk = MakeShared<FBlockGridChunk, ESPMode::ThreadSafe>();
+			CopiedChunks.Add(ChunkCoord);
+		}
+		else if (!CopiedChunks.Contains(ChunkCoord))
+		{
+			Chunk = MakeShared<FBlockGridChunk, ESPMode::ThreadSafe>(*Chunk);
+			CopiedChunks.Add(ChunkCoord);
+		}
+
+		// 낙하 시작 셀에 이미 다른 블록이 들어섰으면 셀에는 기록하지 않고, 복원 시 낙하를 이어가도록 남겨둠
+		const uint16 Index = static_cast<uint16>(FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell)));
+		FBlockGridCell& SnapshotCell = Chunk->Cells[Index];
+		if (!SnapshotCell.IsEmpty())
+		{
+			Snapshot.InFlightBlocks.Add(FallingBlock);
+			continue;
+		}
+
+		SnapshotCell = MakeCellValue(Block);
+		++Chunk->NumOccupied;
+		if (Block->CarriedHitPoints > 0)
+		{
+			Chunk->HitPoints.Add(Index, Block->CarriedHitPoints);
+		}
+	}
+
+	return Snapshot;
+}
+
+void UBlockGridSubsystem::DiffSnapshots(const FBlockGridSnapshot& From, const FBlockGridSnapshot& To, TArray<FIntVector>& OutChangedCells) const
+{
+	DiffChunkMaps(From.Chunks, To.Chunks, OutChangedCells);
+}
+
+void UBlockGridSubsystem::DiffWithCurrent(const FBlockGridSnapshot& Snapshot, TArray<FIntVector>& OutChangedCells) const
+{
+	DiffChunkMaps(Chunks, Snapshot.Chunks, OutChangedCells);
+}
+
+void UBlockGridSubsystem::DiffChunkMaps(
+	const TMap<FIntVector, FBlockGridChunkPtr>& From,
+	const TMap<FIntVector, FBlockGridChunkPtr>& To,
+	TArray<FIntVector>& OutChangedCells)
+{
+	// 한쪽 청크가 없는 경우 빈 셀과 비교
+	const FBlockGridCell EmptyCell;
+
+	auto DiffChunk = [&OutChangedCells, &EmptyCell](const FIntVector& ChunkCoord, const FBlockGridChunk* A, const FBlockGridChunk* B)
+	{
+		for (int32 Index = 0; Index < BLOCK_GRID_CHUNK_CELLS; ++Index)
+		{
+			const FBlockGridCell& CellA = A ? A->Cells[Index] : EmptyCell;
+			const FBlockGridCell& CellB = B ? B->Cells[Index] : EmptyCell;
+			if (CellA != CellB)
+			{
+				OutChangedCells.Add(BlockGrid::ChunkLocalToCell(ChunkCoord, Index));
+			}
+		}
+
+		// 셀 값은 같지만 남은 체력만 다른 셀 (손상 기록은 희소하므로 기록된 셀만 비교)
+		if (!A || !B)
+		{
+			return;
+		}
+
+		for (const TPair<uint16, uint16>& Pair : A->HitPoints)
+		{
+			const uint16* OtherHitPoints = B->HitPoints.Find(Pair.Key);
+			if (A->Cells[Pair.Key] == B->Cells[Pair.Key] && (!OtherHitPoints || *OtherHitPoints != Pair.Value))
+			{
+				OutChangedCells.Add(BlockGrid::ChunkLocalToCell(ChunkCoord, Pair.Key));
+			}
+		}
+
+		for (const TPair<uint16, uint16>& Pair : B->HitPoints)
+		{
+			// 양쪽 모두 기록된 셀은 위에서 이미 비교함
+			if (A->Cells[Pair.Key] == B->Cells[Pair.Key] && !A->HitPoints.Contains(Pair.Key))
+			{
+				OutChangedCells.Add(BlockGrid::ChunkLocalToCell(ChunkCoord, Pair.Key));
+			}
+		}
+	};
+
+	// 1. From 기준 순회 (양쪽에 모두 있는 청크 + From에만 있는 청크)
+	for (const TPair<FIntVector, FBlockGridChunkPtr>& Pair : From)
+	{
+		const FBlockGridChunkPtr* Other = To.Find(Pair.Key);
+		const FBlockGridChunk* OtherChunk = Other ? Other->Get() : nullptr;
+
+		// 같은 청크를 공유하면 내용도 같음
+		if (Pair.Value.Get() == OtherChunk)
+		{
+			continue;
+		}
+
+		DiffChunk(Pair.Key, Pair.Value.Get(), OtherChunk);
+	}
+
+	// 2. To에만 있는 청크
+	for (const TPair<FIntVector, FBlockGridChunkPtr>& Pair : To)
+	{
+		if (!From.Contains(Pair.Key))
+		{
+			DiffChunk(Pair.Key, nullptr, Pair.Value.Get());
+		}
+	}
+}
+
+int32 UBlockGridSubsystem::RestoreSnapshot(const FBlockGridSnapshot& Snapshot)
+{
+	if (!Snapshot.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockGridSubsystem::RestoreSnapshot - Snapshot is not valid"));
+		return -1;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockGridSubsystem::RestoreSnapshot - World is null"));
+		return -1;
+	}
+
+	// 블록 생성/파괴는 서버에서만 결정 (클라이언트는 복제된 블록으로 따라옴)
+	if (World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockGridSubsystem::RestoreSnapshot - Clients cannot restore the grid"));
+		return -1;
+	}
+
+	// 복원 중 등록/해제는 셀 데이터를 건드리지 않음
+	TGuardValue<bool> RestoreGuard(bIsRestoring, true);
+
+	// 1. 낙하 중인 블록 제거
+	// 셀 데이터에 없으므로 아래 셀 비교로는 잡히지 않고, 그대로 두면 복원된 상태 위에 착지해 덮어씀
+	// 스냅샷 당시 낙하 중이던 블록은 스냅샷에 낙하 시작 셀로 기록되어 있어 아래에서 다시 생성됨
+	// 단, 낙하 시작 셀이 점유되어 기록되지 못한 블록은 스냅샷 상태의 일부로 보고 낙하를 이어가게 둠
+	TArray<TWeakObjectPtr<ABlockBase>> InFlightBlocks = FallingBlocks.Array();
+	FallingBlocks.Reset();
+	for (const TWeakObjectPtr<ABlockBase>& FallingBlock : InFlightBlocks)
+	{
+		ABlockBase* Block = FallingBlock.Get();
+		if (!Block)
+		{
+			continue;
+		}
+
+		if (Snapshot.InFlightBlocks.Contains(FallingBlock))
+		{
+			FallingBlocks.Add(FallingBlock);
+			continue;
+		}
+
+		Block->Destroy();
+	}
+
+	// 2. 현재 상태와 달라진 셀 수집 (공유 청크는 포인터 비교로 건너뜀)
+	TArray<FIntVector> ChangedCells;
+	DiffChunkMaps(Chunks, Snapshot.Chunks, ChangedCells);
+
+	// 3. 셀 데이터는 포인터 교체만으로 복원
+	Chunks = Snapshot.Chunks;
+
+	for (const FIntVector& Cell : ChangedCells)
+	{
+		MarkChunkEdited(BlockGrid::CellToChunk(Cell));
+	}
+
+	// 4. 달라진 셀의 액터만 동기화
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (const FIntVector& Cell : ChangedCells)
+	{
+		const FBlockGridCell Target = GetCell(Cell);
+
+		// 같은 블록이 남아있고 체력만 달라진 셀은 균열 표시만 갱신
+		ABlockBase* OldBlock = GetBlockAt(Cell);
+		if (OldBlock && !Target.IsEmpty() && MakeCellValue(OldBlock) == Target)
+		{
+			OldBlock->UpdateCrackStage(GetCellHitPoints(Cell));
+			continue;
+		}
+
+		// 기존 블록 제거 (복원은 연쇄 낙하를 일으키지 않도록 NotifyUpperBlock 없이 제거)
+		if (OldBlock)
+		{
+			OldBlock->Destroy();
+		}
+		CellActors.Remove(Cell);
+
+		// 스냅샷에 블록이 있던 셀이면 다시 생성
+		if (Target.IsEmpty())
+		{
+			continue;
+		}
+
+		TSubclassOf<ABlockBase> BlockClass = GetPaletteClass(Target.PaletteIndex);
+		if (!BlockClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("BlockGridSubsystem::RestoreSnapshot - Unknown palette index %d at %s"), Target.PaletteIndex, *Cell.ToString());
+			continue;
+		}
+
+		ABlockBase* NewBlock = World->SpawnActor<ABlockBase>(BlockClass, CellToWorld(Cell), FRotator::ZeroRotator, SpawnParams);
+		if (NewBlock)
+		{
+			// 레거시 SpawnBlock으로 타입이 바뀐 블록도 스냅샷 당시 타입으로 되돌림
+			NewBlock->BlockType = Target.BlockType;
+			NewBlock->Location = NewBlock->GetActorLocation();
+			NewBlock->UpdateCrackStage(GetCellHitPoints(Cell));
+		}
+	}
+
+	OnSnapshotRestored.Broadcast();
+
+	return ChangedCells.Num();
+}
+
+uint16 UBlockGridSubsystem::FindOrAddPaletteIndex(TSubclassOf<ABlockBase> BlockClass)
+{
+	if (!BlockClass)
+	{
+		return 0;
+	}
+
+	const int32 Existing = Palette.IndexOfByKey(BlockClass);
+	if (Existing != INDEX_NONE)
+	{
+		return static_cast<uint16>(Existing);
+	}
+
+	// 팔레트는 추가만 되므로 기존 스냅샷의 인덱스는 항상 유효
+	return static_cast<uint16>(Palette.Add(BlockClass));
+}
+
+TSubclassOf<ABlockBase> UBlockGridSubsystem::GetPaletteClass(uint16 PaletteIndex) const
+{
+	return Palette.IsValidIndex(PaletteIndex) ? Palette[PaletteIndex] : nullptr;
+}
@@ -0,0 +1,314 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockHazardFieldSubsystem.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Engine/World.h"
+
+namespace
+{
+	// 6방향 이웃
+	const FIntVector HazardNeighbors[6] =
+	{
+		FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+		FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+		FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+	};
+}
+
+void UBlockHazardFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid = Collection.InitializeDependency<UBlockGridSubsystem>();
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockHazardFieldSubsystem: BlockGridSubsystem is null"));
+		return;
+	}
+
+	Grid->OnBlockEvent.AddUObject(this, &UBlockHazardFieldSubsystem::HandleBlockEvent);
+	Grid->OnSnapshotRestored.AddUObject(this, &UBlockHazardFieldSubsystem::HandleSnapshotRestored);
+}
+
+void UBlockHazardFieldSubsystem::Deinitialize()
+{
+	if (Grid)
+	{
+		Grid->OnBlockEvent.RemoveAll(this);
+		Grid->OnSnapshotRestored.RemoveAll(this);
+	}
+
+	Chunks.Empty();
+	SourceCounts.Empty();
+	TemporarySourceCounts.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UBlockHazardFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+uint8 UBlockHazardFieldSubsystem::GetHazardDistance(const FIntVector& Cell) const
+{
+	return ReadDistance(Cell);
+}
+
+float UBlockHazardFieldSubsystem::GetHazardDistanceAtLocation(const FVector& WorldLocation) const
+{
+	if (!Grid)
+	{
+		return -1.0f;
+	}
+
+	const uint8 Distance = ReadDistance(Grid->WorldToCell(WorldLocation));
+	return (Distance == HazardDistanceFar) ? -1.0f : Distance * Grid->GetGridSize();
+}
+
+void UBlockHazardFieldSubsystem::AddHazardSources(const TArray<FIntVector>& Cells)
+{
+	for (const FIntVector& Cell : Cells)
+	{
+		++TemporarySourceCounts.FindOrAdd(Cell);
+		AddSource(Cell);
+	}
+}
+
+void UBlockHazardFieldSubsystem::RemoveHazardSources(const TArray<FIntVector>& Cells)
+{
+	for (const FIntVector& Cell : Cells)
+	{
+		// 추가한 적 없는 셀은 무시 (Warning 블록의 참조 카운트를 건드리지 않도록)
+		uint16* Count = TemporarySourceCounts.Find(Cell);
+		if (!Count)
+		{
+			continue;
+		}
+
+		if (--(*Count) == 0)
+		{
+			TemporarySourceCounts.Remove(Cell);
+		}
+		RemoveSource(Cell);
+	}
+}
+
+void UBlockHazardFieldSubsystem::HandleBlockEvent(const FBlockGridEvent& Event)
+{
+	if (Event.Value.BlockType != EBlockType::Warning)
+	{
+		return;
+	}
+
+	switch (Event.Type)
+	{
+	case EBlockGridEventType::Added:
+		AddSource(Event.Cell);
+		break;
+	case EBlockGridEventType::Removed:
+		RemoveSource(Event.Cell);
+		break;
+	case EBlockGridEventType::Moved:
+		// 낙하한 Warning 블록은 위험원이 이동한 것
+		RemoveSource(Event.FromCell);
+		AddSource(Event.Cell);
+		break;
+	default:
+		break;
+	}
+}
+
+void UBlockHazardFieldSubsystem::HandleSnapshotRestored()
+{
+	RebuildFromGrid();
+}
+
+void UBlockHazardFieldSubsystem::RebuildFromGrid()
+{
+	Chunks.Empty();
+	SourceCounts.Empty();
+
+	if (!Grid)
+	{
+		return;
+	}
+
+	// 1. 그리드에 없는 임시 위험원(예고 장판 등)은 스냅샷 복원과 관계없이 유지
+	SourceCounts = TemporarySourceCounts;
+
+	// 2. 그리드의 Warning 셀 수집
+	TArray<FIntVector> ChunkCoords;
+	Grid->GetChunkCoords(ChunkCoords);
+
+	for (const FIntVector& ChunkCoord : ChunkCoords)
+	{
+		Grid->ForEachOccupiedCellInChunk(ChunkCoord, [this](const FIntVector& Cell, const FBlockGridCell& Value)
+		{
+			if (Value.BlockType == EBlockType::Warning)
+			{
+				++SourceCounts.FindOrAdd(Cell);
+			}
+		});
+	}
+
+	for (const TPair<FIntVector, uint16>& Source : SourceCounts)
+	{
+		WriteDistance(Source.Key, 0);
+		Buckets[0].Add(Source.Key);
+	}
+
+	// 모든 위험원에서 한 번에 전파 (다중 시작점 BFS)
+	PropagateLower();
+}
+
+void UBlockHazardFieldSubsystem::AddSource(const FIntVector& Cell)
+{
+	uint16& Count = SourceCounts.FindOrAdd(Cell);
+	if (Count++ > 0)
+	{
+		return;
+	}
+
+	// 새 위험원: 주변에서 더 가까워지는 셀만 갱신
+	WriteDistance(Cell, 0);
+	Buckets[0].Add(Cell);
+	PropagateLower();
+}
+
+void UBlockHazardFieldSubsystem::RemoveSource(const FIntVector& Cell)
+{
+	uint16* Count = SourceCounts.Find(Cell);
+	if (!Count)
+	{
+		return;
+	}
+
+	if (--(*Count) > 0)
+	{
+		return;
+	}
+	SourceCounts.Remove(Cell);
+
+	// 1. 제거된 위험원에서 거리가 1씩 늘어나는 방향으로 따라가며
+	//    이 위험원에 의존했을 수 있는 셀을 모두 초기화
+	TArray<TPair<FIntVector, uint8>> RaiseQueue;
+	TArray<FIntVector> Cleared;
+
+	RaiseQueue.Emplace(Cell, 0);
+	WriteDistance(Cell, HazardDistanceFar);
+	Cleared.Add(Cell);
+
+	for (int32 Index = 0; Index < RaiseQueue.Num(); ++Index)
+	{
+		const FIntVector Current = RaiseQueue[Index].Key;
+		const uint8 CurrentDistance = RaiseQueue[Index].Value;
+
+		for (const FIntVector& Offset : HazardNeighbors)
+		{
+			const FIntVector Neighbor = Current + Offset;
+			const uint8 NeighborDistance = ReadDistance(Neighbor);
+
+			if (NeighborDistance != HazardDistanceFar && NeighborDistance == CurrentDistance + 1)
+			{
+				WriteDistance(Neighbor, HazardDistanceFar);
+				RaiseQueue.Emplace(Neighbor, NeighborDistance);
+				Cleared.Add(Neighbor);
+			}
+		}
+	}
+
+	// 2. 초기화된 영역의 경계에 남아있는 거리를 시작점으로 다시 전파
+	for (const FIntVector& ClearedCell : Cleared)
+	{
+		for (const FIntVector& Offset : HazardNeighbors)
+		{
+			const FIntVector Neighbor = ClearedCell + Offset;
+			const uint8 NeighborDistance = ReadDistance(Neighbor);
+			if (NeighborDistance < MaxHazardDistance)
+			{
+				Buckets[NeighborDistance].Add(Neighbor);
+			}
+		}
+	}
+
+	PropagateLower();
+}
+
+void UBlockHazardFieldSubsystem::PropagateLower()
+{
+	// 거리가 작은 버킷부터 처리하면 각 셀은 최종 거리로 한 번만 확정됨
+	for (int32 Distance = 0; Distance < MaxHazardDistance; ++Distance)
+	{
+		TArray<FIntVector>& Bucket = Buckets[Distance];
+
+		for (int32 Index = 0; Index < Bucket.Num(); ++Index)
+		{
+			const FIntVector Current = Bucket[Index];
+
+			// 더 짧은 거리로 이미 갱신된 중복 항목은 건너뜀
+			if (ReadDistance(Current) != Distance)
+			{
+				continue;
+			}
+
+			const uint8 NextDistance = static_cast<uint8>(Distance + 1);
+			for (const FIntVector& Offset : HazardNeighbors)
+			{
+				const FIntVector Neighbor = Current + Offset;
+				if (NextDistance < ReadDistance(Neighbor))
+				{
+					WriteDistance(Neighbor, NextDistance);
+					Buckets[NextDistance].Add(Neighbor);
+				}
+			}
+		}
+
+		Bucket.Reset();
+	}
+
+	Buckets[MaxHazardDistance].Reset();
+}
+
+uint8 UBlockHazardFieldSubsystem::ReadDistance(const FIntVector& Cell) const
+{
+	const TUniquePtr<FHazardChunk>* Chunk = Chunks.Find(BlockGrid::CellToChunk(Cell));
+	if (!Chunk)
+	{
+		return HazardDistanceFar;
+	}
+
+	return (*Chunk)->Distance[FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell))];
+}
+
+void UBlockHazardFieldSubsystem::WriteDistance(const FIntVector& Cell, uint8 Distance)
+{
+	const FIntVector ChunkCoord = BlockGrid::CellToChunk(Cell);
+	TUniquePtr<FHazardChunk>* Chunk = Chunks.Find(ChunkCoord);
+
+	if (!Chunk)
+	{
+		// 먼 거리를 쓰는 경우 청크를 새로 만들 필요 없음
+		if (Distance == HazardDistanceFar)
+		{
+			return;
+		}
+		Chunk = &Chunks.Add(ChunkCoord, MakeUnique<FHazardChunk>());
+	}
+
+	FHazardChunk& HazardChunk = **Chunk;
+	uint8& Stored = HazardChunk.Distance[FBlockGridChunk::LocalIndex(BlockGrid::CellToLocal(Cell))];
+
+	// 가까운 셀 수 갱신
+	const bool bWasNear = Stored != HazardDistanceFar;
+	const bool bIsNear = Distance != HazardDistanceFar;
+	HazardChunk.NumNearCells += static_cast<int32>(bIsNear) - static_cast<int32>(bWasNear);
+	Stored = Distance;
+
+	// 위험원에서 모두 멀어진 청크는 해제 (읽기는 청크가 없으면 HazardDistanceFar)
+	if (HazardChunk.NumNearCells <= 0)
+	{
+		Chunks.Remove(ChunkCoord);
+	}
+}
@@ -0,0 +1,262 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockHistoryRing.h"
+#include "Grid/BlockGridTypes.h"
+
+namespace BlockHistory
+{
+	FORCEINLINE uint32 ZigZagEncode(int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	FORCEINLINE int32 ZigZagDecode(uint32 Value)
+	{
+		return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+	}
+
+	// 7비트씩 끊어 쓰는 가변 길이 정수 (작은 값은 1바이트)
+	void WriteVarUInt(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+}
+
+FBlockHistoryRing::FBlockHistoryRing(int32 InCapacity)
+{
+	Data.SetNumZeroed(FMath::Max(InCapacity, 64));
+}
+
+void FBlockHistoryRing::Reset()
+{
+	Head = 0;
+	Tail = 0;
+	Used = 0;
+	NumFrames = 0;
+	TailBaseTick = 0;
+	LastTick = 0;
+}
+
+bool FBlockHistoryRing::AppendFrame(int64 Tick, const TArray<FBlockHistoryRecord>& Records, const FIntVector& RegionOrigin)
+{
+	if (Records.Num() == 0)
+	{
+		return true;
+	}
+
+	if (NumFrames == 0)
+	{
+		// 비어있으면 첫 프레임의 델타는 0
+		TailBaseTick = Tick;
+		LastTick = Tick;
+	}
+
+	// 1. 이벤트 본문을 임시 버퍼에 인코딩 (크기를 알아야 공간 확보 가능)
+	TArray<uint8> Body;
+	Body.Reserve(4 + Records.Num() * 6);
+
+	BlockHistory::WriteVarUInt(Body, static_cast<uint64>(Records.Num()));
+
+	for (const FBlockHistoryRecord& Record : Records)
+	{
+		Body.Add(static_cast<uint8>(Record.Type));
+		BlockHistory::WriteVarUInt(Body, static_cast<uint64>(FBlockGridChunk::LocalIndex(Record.Cell - RegionOrigin)));
+
+		switch (Record.Type)
+		{
+		case EBlockHistoryEvent::Spawned:
+		case EBlockHistoryEvent::Destroyed:
+			BlockHistory::WriteVarUInt(Body, Record.PaletteIndex);
+			break;
+		case EBlockHistoryEvent::Fell:
+		{
+			const FIntVector Delta = Record.ToCell - Record.Cell;
+			BlockHistory::WriteVarUInt(Body, BlockHistory::ZigZagEncode(Delta.X));
+			BlockHistory::WriteVarUInt(Body, BlockHistory::ZigZagEncode(Delta.Y));
+			BlockHistory::WriteVarUInt(Body, BlockHistory::ZigZagEncode(Delta.Z));
+			BlockHistory::WriteVarUInt(Body, Record.PaletteIndex);
+			break;
+		}
+		case EBlockHistoryEvent::BombCount:
+			Body.Add(Record.OldBombCount);
+			Body.Add(Record.NewBombCount);
+			break;
+		}
+	}
+
+	// 틱 델타 varint는 최대 10바이트
+	constexpr int32 MaxHeaderBytes = 10;
+	const int32 Capacity = Data.Num();
+	if (Body.Num() + MaxHeaderBytes > Capacity)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockHistoryRing::AppendFrame - Frame (%d bytes) exceeds ring capacity (%d bytes)"), Body.Num(), Capacity);
+		return false;
+	}
+
+	// 2. 공간이 생길 때까지 오래된 프레임 제거
+	while (Capacity - Used < Body.Num() + MaxHeaderBytes && NumFrames > 0)
+	{
+		DropOldestFrame();
+	}
+
+	if (NumFrames == 0)
+	{
+		// 모두 버려졌다면 이 프레임이 새 기준
+		TailBaseTick = Tick;
+		LastTick = Tick;
+		Head = 0;
+		Tail = 0;
+		Used = 0;
+	}
+
+	// 이전 프레임 기준 틱 델타를 헤더로 붙임
+	TArray<uint8> Scratch;
+	Scratch.Reserve(MaxHeaderBytes + Body.Num());
+	BlockHistory::WriteVarUInt(Scratch, static_cast<uint64>(FMath::Max<int64>(Tick - LastTick, 0)));
+	Scratch.Append(Body);
+
+	// 3. 링 버퍼에 복사 (끝에 닿으면 앞으로 감음)
+	const int32 FirstPart = FMath::Min(Scratch.Num(), Capacity - Head);
+	FMemory::Memcpy(Data.GetData() + Head, Scratch.GetData(), FirstPart);
+	if (FirstPart < Scratch.Num())
+	{
+		FMemory::Memcpy(Data.GetData(), Scratch.GetData() + FirstPart, Scratch.Num() - FirstPart);
+	}
+
+	Head = (Head + Scratch.Num()) % Capacity;
+	Used += Scratch.Num();
+	++NumFrames;
+	LastTick = Tick;
+
+	return true;
+}
+
+void FBlockHistoryRing::EvictOlderThan(int64 MinTick)
+{
+	while (NumFrames > 0 && PeekOldestTick() < MinTick)
+	{
+		DropOldestFrame();
+	}
+}
+
+void FBlockHistoryRing::Decode(const FIntVector& RegionOrigin, int64 MinTick, TArray<FBlockHistoryRecord>& OutRecords) const
+{
+	int32 Cursor = Tail;
+	int64 FrameTick = TailBaseTick;
+	const int32 FirstNew = OutRecords.Num();
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		DecodeFrame(Cursor, FrameTick, RegionOrigin, &OutRecords);
+	}
+
+	// 보관 기간이 지났지만 아직 덮어쓰이지 않은 기록은 제외
+	if (MinTick > TNumericLimits<int64>::Lowest())
+	{
+		int32 FirstValid = FirstNew;
+		while (FirstValid < OutRecords.Num() && OutRecords[FirstValid].Tick < MinTick)
+		{
+			++FirstValid;
+		}
+		OutRecords.RemoveAt(FirstNew, FirstValid - FirstNew, false);
+	}
+}
+
+void FBlockHistoryRing::DecodeFrame(int32& Cursor, int64& InOutTick, const FIntVector& RegionOrigin, TArray<FBlockHistoryRecord>* OutRecords) const
+{
+	InOutTick += ReadVarUInt(Cursor);
+	const uint32 NumRecords = ReadVarUInt(Cursor);
+
+	for (uint32 Index = 0; Index < NumRecords; ++Index)
+	{
+		FBlockHistoryRecord Record;
+		Record.Tick = InOutTick;
+		Record.Type = static_cast<EBlockHistoryEvent>(ReadByte(Cursor));
+		Record.Cell = RegionOrigin + FBlockGridChunk::LocalCoord(static_cast<int32>(ReadVarUInt(Cursor)));
+		Record.ToCell = Record.Cell;
+
+		switch (Record.Type)
+		{
+		case EBlockHistoryEvent::Spawned:
+		case EBlockHistoryEvent::Destroyed:
+			Record.PaletteIndex = static_cast<uint16>(ReadVarUInt(Cursor));
+			break;
+		case EBlockHistoryEvent::Fell:
+			Record.ToCell.X += BlockHistory::ZigZagDecode(ReadVarUInt(Cursor));
+			Record.ToCell.Y += BlockHistory::ZigZagDecode(ReadVarUInt(Cursor));
+			Record.ToCell.Z += BlockHistory::ZigZagDecode(ReadVarUInt(Cursor));
+			Record.PaletteIndex = static_cast<uint16>(ReadVarUInt(Cursor));
+			break;
+		case EBlockHistoryEvent::BombCount:
+			Record.OldBombCount = ReadByte(Cursor);
+			Record.NewBombCount = ReadByte(Cursor);
+			break;
+		}
+
+		if (OutRecords)
+		{
+			OutRecords->Add(Record);
+		}
+	}
+}
+
+void FBlockHistoryRing::DropOldestFrame()
+{
+	if (NumFrames == 0)
+	{
+		return;
+	}
+
+	int32 Cursor = Tail;
+	int64 FrameTick = TailBaseTick;
+	DecodeFrame(Cursor, FrameTick, FIntVector::ZeroValue, nullptr);
+
+	const int32 Capacity = Data.Num();
+	const int32 FrameBytes = (Cursor - Tail + Capacity) % Capacity;
+
+	Tail = Cursor;
+	Used -= (FrameBytes == 0 && Used == Capacity) ? Capacity : FrameBytes;
+	TailBaseTick = FrameTick;
+	--NumFrames;
+
+	if (NumFrames == 0)
+	{
+		Head = Tail;
+		Used = 0;
+	}
+}
+
+int64 FBlockHistoryRing::PeekOldestTick() const
+{
+	int32 Cursor = Tail;
+	return TailBaseTick + ReadVarUInt(Cursor);
+}
+
+uint8 FBlockHistoryRing::ReadByte(int32& Cursor) const
+{
+	const uint8 Value = Data[Cursor];
+	Cursor = (Cursor + 1) % Data.Num();
+	return Value;
+}
+
+uint32 FBlockHistoryRing::ReadVarUInt(int32& Cursor) const
+{
+	uint32 Value = 0;
+	int32 Shift = 0;
+	uint8 Byte = 0;
+
+	do
+	{
+		Byte = ReadByte(Cursor);
+		Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		Shift += 7;
+	} while ((Byte & 0x80) && Shift < 35);
+
+	return Value;
+}
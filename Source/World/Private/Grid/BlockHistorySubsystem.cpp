@@ -0,0 +1,569 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockHistorySubsystem.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Block/BlockBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+void UBlockHistorySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 그리드 서브시스템이 먼저 초기화되어야 이벤트를 구독할 수 있음
+	Grid = Collection.InitializeDependency<UBlockGridSubsystem>();
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockHistorySubsystem: BlockGridSubsystem is null"));
+		return;
+	}
+
+	Grid->OnBlockEvent.AddUObject(this, &UBlockHistorySubsystem::HandleBlockEvent);
+	Grid->OnSnapshotRestored.AddUObject(this, &UBlockHistorySubsystem::HandleSnapshotRestored);
+}
+
+void UBlockHistorySubsystem::Deinitialize()
+{
+	if (Grid)
+	{
+		Grid->OnBlockEvent.RemoveAll(this);
+		Grid->OnSnapshotRestored.RemoveAll(this);
+	}
+
+	ClearRewindState();
+	Regions.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UBlockHistorySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBlockHistorySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBlockHistorySubsystem, STATGROUP_Tickables);
+}
+
+int64 UBlockHistorySubsystem::GetCurrentTick() const
+{
+	const UWorld* World = GetWorld();
+	return World ? static_cast<int64>(World->GetTimeSeconds() * HistoryTicksPerSecond) : 0;
+}
+
+int32 UBlockHistorySubsystem::GetTotalRecordedBytes() const
+{
+	int32 Total = 0;
+	for (const TPair<FIntVector, FRegionHistory>& Pair : Regions)
+	{
+		Total += Pair.Value.Ring.GetUsedBytes();
+	}
+	return Total;
+}
+
+void UBlockHistorySubsystem::HandleBlockEvent(const FBlockGridEvent& Event)
+{
+	// 되감기 결과 반영 중 발생한 이벤트는 기록하지 않음
+	if (bIsApplyingRewind)
+	{
+		return;
+	}
+
+	// Recordable 블록만 기록
+	if (Event.Value.BlockType != EBlockType::Recordable)
+	{
+		return;
+	}
+
+	FBlockHistoryRecord Record;
+	Record.Tick = GetCurrentTick();
+	Record.PaletteIndex = Event.Value.PaletteIndex;
+
+	switch (Event.Type)
+	{
+	case EBlockGridEventType::Added:
+		Record.Type = EBlockHistoryEvent::Spawned;
+		Record.Cell = Event.Cell;
+		break;
+	case EBlockGridEventType::Removed:
+		Record.Type = EBlockHistoryEvent::Destroyed;
+		Record.Cell = Event.Cell;
+		break;
+	case EBlockGridEventType::Moved:
+		// 낙하 시작 셀의 영역에 기록
+		Record.Type = EBlockHistoryEvent::Fell;
+		Record.Cell = Event.FromCell;
+		Record.ToCell = Event.Cell;
+		break;
+	case EBlockGridEventType::BombCountChanged:
+		Record.Type = EBlockHistoryEvent::BombCount;
+		Record.Cell = Event.Cell;
+		Record.OldBombCount = Event.OldBombCount;
+		Record.NewBombCount = Event.NewBombCount;
+		break;
+	}
+
+	if (Record.Type != EBlockHistoryEvent::Fell)
+	{
+		Record.ToCell = Record.Cell;
+	}
+
+	AddRecord(Record);
+}
+
+void UBlockHistorySubsystem::HandleSnapshotRestored()
+{
+	// 스냅샷 복원으로 셀 상태가 통째로 바뀌었으므로 기존 기록은 더 이상 이어지지 않음
+	if (bIsRewinding)
+	{
+		EndRewind(false);
+	}
+	Regions.Empty();
+}
+
+void UBlockHistorySubsystem::AddRecord(const FBlockHistoryRecord& Record)
+{
+	const FIntVector RegionChunk = BlockGrid::CellToChunk(Record.Cell);
+
+	// 되감기 중인 영역은 액터가 숨겨져 있으므로 기록을 멈춤
+	if (bIsRewinding && RewindRegions.Contains(RegionChunk))
+	{
+		return;
+	}
+
+	FRegionHistory& Region = Regions.FindOrAdd(RegionChunk);
+
+	// 틱이 바뀌었으면 이전 틱의 기록을 먼저 링 버퍼에 씀
+	if (Region.Pending.Num() > 0 && Region.PendingTick != Record.Tick)
+	{
+		FlushRegion(RegionChunk, Region);
+	}
+
+	Region.PendingTick = Record.Tick;
+	Region.Pending.Add(Record);
+}
+
+void UBlockHistorySubsystem::FlushRegion(const FIntVector& RegionChunk, FRegionHistory& Region)
+{
+	if (Region.Pending.Num() == 0)
+	{
+		return;
+	}
+
+	// 보관 기간이 지난 프레임은 쓰기 전에 제거
+	Region.Ring.EvictOlderThan(Region.PendingTick - HistoryWindowSeconds * HistoryTicksPerSecond);
+	Region.Ring.AppendFrame(Region.PendingTick, Region.Pending, RegionChunk * BLOCK_GRID_CHUNK_SIZE);
+	Region.Pending.Reset();
+}
+
+bool UBlockHistorySubsystem::BeginRewind(const TArray<FIntVector>& RegionChunks)
+{
+	if (bIsRewinding)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockHistorySubsystem::BeginRewind - Already rewinding"));
+		return false;
+	}
+
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockHistorySubsystem::BeginRewind - Grid is null"));
+		return false;
+	}
+
+	// 블록 생성/파괴는 서버에서만 결정 (클라이언트는 복제된 블록으로 따라옴)
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockHistorySubsystem::BeginRewind - Clients cannot rewind the grid"));
+		return false;
+	}
+
+	// 1. 대상 영역 결정
+	RewindRegions.Reset();
+	if (RegionChunks.Num() > 0)
+	{
+		RewindRegions.Append(RegionChunks);
+	}
+	else
+	{
+		for (const TPair<FIntVector, FRegionHistory>& Pair : Regions)
+		{
+			RewindRegions.Add(Pair.Key);
+		}
+	}
+
+	// 2. 대상 영역의 기록을 시간 순으로 풀어냄 (되감기 시작 시 한 번만)
+	RewindStartTick = GetCurrentTick();
+	RewindOldestTick = RewindStartTick - HistoryWindowSeconds * HistoryTicksPerSecond;
+	Timeline.Reset();
+
+	// Fell은 출발 셀의 영역에 기록되므로, 다른 영역에서 출발해 대상 영역에 착지한 기록도 가져옴
+	TArray<FBlockHistoryRecord> OutsideRecords;
+	for (TPair<FIntVector, FRegionHistory>& Pair : Regions)
+	{
+		FlushRegion(Pair.Key, Pair.Value);
+
+		if (RewindRegions.Contains(Pair.Key))
+		{
+			Pair.Value.Ring.Decode(Pair.Key * BLOCK_GRID_CHUNK_SIZE, RewindOldestTick, Timeline);
+			continue;
+		}
+
+		OutsideRecords.Reset();
+		Pair.Value.Ring.Decode(Pair.Key * BLOCK_GRID_CHUNK_SIZE, RewindOldestTick, OutsideRecords);
+		for (const FBlockHistoryRecord& Record : OutsideRecords)
+		{
+			if (Record.Type == EBlockHistoryEvent::Fell && IsInRewindRegion(Record.ToCell))
+			{
+				Timeline.Add(Record);
+			}
+		}
+	}
+
+	if (Timeline.Num() == 0)
+	{
+		RewindRegions.Reset();
+		return false;
+	}
+
+	// 영역 내부는 이미 시간 순이므로 안정 정렬로 영역 간 순서만 맞춤
+	Timeline.StableSort([](const FBlockHistoryRecord& A, const FBlockHistoryRecord& B)
+	{
+		return A.Tick < B.Tick;
+	});
+
+	// 3. 현재 상태에서 출발 (모든 기록이 적용된 상태)
+	RewindCells.Reset();
+	RewindBombCounts.Reset();
+	HiddenBlocks.Reset();
+
+	for (const FIntVector& RegionChunk : RewindRegions)
+	{
+		Grid->ForEachOccupiedCellInChunk(RegionChunk, [this](const FIntVector& Cell, const FBlockGridCell& Value)
+		{
+			if (Value.BlockType != EBlockType::Recordable)
+			{
+				return;
+			}
+
+			RewindCells.Add(Cell, Value.PaletteIndex);
+
+			// 실제 액터는 숨기고 인스턴스 메시로 대신 그림
+			if (ABlockBase* Block = Grid->GetBlockAt(Cell))
+			{
+				// 폭탄 개수도 현재 값에서 출발해야 기록을 되돌린 값이 맞음
+				if (Block->GetCurrentBombCount() > 0)
+				{
+					RewindBombCounts.Add(Cell, static_cast<uint8>(FMath::Clamp(Block->GetCurrentBombCount(), 0, 255)));
+				}
+
+				Block->SetActorHiddenInGame(true);
+				Block->SetActorEnableCollision(false);
+				HiddenBlocks.Add(Block);
+			}
+		});
+	}
+
+	AppliedCount = Timeline.Num();
+	PlaybackTick = static_cast<double>(RewindStartTick);
+	bIsRewinding = true;
+	bRewindVisualDirty = true;
+
+	RefreshRewindVisual();
+	return true;
+}
+
+void UBlockHistorySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bIsRewinding)
+	{
+		return;
+	}
+
+	PlaybackTick = FMath::Clamp(
+		PlaybackTick + static_cast<double>(PlaybackRate) * DeltaTime * HistoryTicksPerSecond,
+		static_cast<double>(RewindOldestTick),
+		static_cast<double>(RewindStartTick));
+
+	MoveToTick(FMath::FloorToInt64(PlaybackTick));
+	RefreshRewindVisual();
+}
+
+void UBlockHistorySubsystem::SeekSecondsAgo(float SecondsAgo)
+{
+	if (!bIsRewinding)
+	{
+		return;
+	}
+
+	PlaybackTick = FMath::Clamp(
+		static_cast<double>(RewindStartTick) - static_cast<double>(SecondsAgo) * HistoryTicksPerSecond,
+		static_cast<double>(RewindOldestTick),
+		static_cast<double>(RewindStartTick));
+
+	MoveToTick(FMath::FloorToInt64(PlaybackTick));
+	RefreshRewindVisual();
+}
+
+uint8 UBlockHistorySubsystem::GetRewindBombCount(const FIntVector& Cell) const
+{
+	const uint8* Found = RewindBombCounts.Find(Cell);
+	return Found ? *Found : 0;
+}
+
+float UBlockHistorySubsystem::GetRewindSecondsAgo() const
+{
+	return bIsRewinding ? static_cast<float>((RewindStartTick - PlaybackTick) / HistoryTicksPerSecond) : 0.0f;
+}
+
+void UBlockHistorySubsystem::MoveToTick(int64 TargetTick)
+{
+	// 과거로: 목표 시점 이후의 기록을 역순으로 되돌림
+	while (AppliedCount > 0 && Timeline[AppliedCount - 1].Tick > TargetTick)
+	{
+		ApplyRecord(Timeline[--AppliedCount], false);
+	}
+
+	// 미래로: 목표 시점까지의 기록을 순서대로 다시 적용
+	while (AppliedCount < Timeline.Num() && Timeline[AppliedCount].Tick <= TargetTick)
+	{
+		ApplyRecord(Timeline[AppliedCount++], true);
+	}
+}
+
+void UBlockHistorySubsystem::ApplyRecord(const FBlockHistoryRecord& Record, bool bForward)
+{
+	switch (Record.Type)
+	{
+	case EBlockHistoryEvent::Spawned:
+		if (bForward) { RewindCells.Add(Record.Cell, Record.PaletteIndex); }
+		else { RewindCells.Remove(Record.Cell); }
+		break;
+	case EBlockHistoryEvent::Destroyed:
+		if (bForward) { RewindCells.Remove(Record.Cell); }
+		else { RewindCells.Add(Record.Cell, Record.PaletteIndex); }
+		break;
+	case EBlockHistoryEvent::Fell:
+	{
+		// 영역 밖의 셀은 되감기 대상이 아니므로 실제 액터가 그대로 보임
+		const FIntVector& FromCell = bForward ? Record.Cell : Record.ToCell;
+		const FIntVector& ToCell = bForward ? Record.ToCell : Record.Cell;
+		if (IsInRewindRegion(FromCell))
+		{
+			RewindCells.Remove(FromCell);
+		}
+		if (IsInRewindRegion(ToCell))
+		{
+			RewindCells.Add(ToCell, Record.PaletteIndex);
+		}
+		break;
+	}
+	case EBlockHistoryEvent::BombCount:
+		RewindBombCounts.Add(Record.Cell, bForward ? Record.NewBombCount : Record.OldBombCount);
+		break;
+	}
+
+	bRewindVisualDirty = true;
+}
+
+void UBlockHistorySubsystem::RefreshRewindVisual()
+{
+	if (!bRewindVisualDirty || !Grid)
+	{
+		return;
+	}
+	bRewindVisualDirty = false;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 표시용 액터는 되감기당 한 번만 생성
+	if (!RewindVisualActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		RewindVisualActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!RewindVisualActor)
+		{
+			UE_LOG(LogTemp, Error, TEXT("BlockHistorySubsystem: Failed to spawn rewind visual actor"));
+			return;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(RewindVisualActor);
+		RewindVisualActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	// 팔레트별 인스턴스 목록 구성
+	TArray<TArray<FTransform>> TransformsByPalette;
+	for (const TPair<FIntVector, uint16>& Pair : RewindCells)
+	{
+		if (TransformsByPalette.Num() <= Pair.Value)
+		{
+			TransformsByPalette.SetNum(Pair.Value + 1);
+		}
+		TransformsByPalette[Pair.Value].Add(FTransform(Grid->CellToWorld(Pair.Key)));
+	}
+
+	if (RewindMeshes.Num() < TransformsByPalette.Num())
+	{
+		RewindMeshes.SetNum(TransformsByPalette.Num());
+	}
+
+	for (int32 PaletteIndex = 0; PaletteIndex < RewindMeshes.Num(); ++PaletteIndex)
+	{
+		const bool bHasInstances = TransformsByPalette.IsValidIndex(PaletteIndex) && TransformsByPalette[PaletteIndex].Num() > 0;
+		UInstancedStaticMeshComponent* Mesh = RewindMeshes[PaletteIndex];
+
+		if (!Mesh && bHasInstances)
+		{
+			// 블록 클래스의 메시와 머티리얼을 그대로 사용
+			TSubclassOf<ABlockBase> BlockClass = Grid->GetPaletteClass(static_cast<uint16>(PaletteIndex));
+			const ABlockBase* CDO = BlockClass ? BlockClass->GetDefaultObject<ABlockBase>() : nullptr;
+			const UStaticMeshComponent* SourceMesh = CDO ? CDO->GetBlockMesh() : nullptr;
+			if (!SourceMesh)
+			{
+				continue;
+			}
+
+			Mesh = NewObject<UInstancedStaticMeshComponent>(RewindVisualActor);
+			Mesh->SetStaticMesh(SourceMesh->GetStaticMesh());
+			for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+			{
+				Mesh->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+			}
+			Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			Mesh->SetupAttachment(RewindVisualActor->GetRootComponent());
+			Mesh->RegisterComponent();
+			RewindMeshes[PaletteIndex] = Mesh;
+		}
+
+		if (!Mesh)
+		{
+			continue;
+		}
+
+		// 인스턴스는 변화가 있을 때만 한 번에 교체
+		Mesh->ClearInstances();
+		if (bHasInstances)
+		{
+			Mesh->AddInstances(TransformsByPalette[PaletteIndex], false, true);
+		}
+	}
+}
+
+void UBlockHistorySubsystem::EndRewind(bool bCommit)
+{
+	if (!bIsRewinding)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+
+	// 되감기는 서버에서만 시작되지만, 넷 모드가 바뀐 경우에도 클라이언트에서는 커밋하지 않음
+	if (bCommit && Grid && World && World->GetNetMode() != NM_Client)
+	{
+		// 되감은 시점의 상태로 액터를 한 번에 맞춤
+		TGuardValue<bool> ApplyGuard(bIsApplyingRewind, true);
+
+		// 1. 현재 Recordable 셀 중 되감은 상태와 다른 것 제거
+		TMap<FIntVector, uint16> CurrentCells;
+		for (const FIntVector& RegionChunk : RewindRegions)
+		{
+			Grid->ForEachOccupiedCellInChunk(RegionChunk, [&CurrentCells](const FIntVector& Cell, const FBlockGridCell& Value)
+			{
+				if (Value.BlockType == EBlockType::Recordable)
+				{
+					CurrentCells.Add(Cell, Value.PaletteIndex);
+				}
+			});
+		}
+
+		for (const TPair<FIntVector, uint16>& Pair : CurrentCells)
+		{
+			const uint16* Target = RewindCells.Find(Pair.Key);
+			if (!Target || *Target != Pair.Value)
+			{
+				if (ABlockBase* Block = Grid->GetBlockAt(Pair.Key))
+				{
+					Block->Destroy();
+				}
+			}
+		}
+
+		// 2. 되감은 상태에만 있는 셀 생성
+		for (const TPair<FIntVector, uint16>& Pair : RewindCells)
+		{
+			const uint16* Current = CurrentCells.Find(Pair.Key);
+			if (Current && *Current == Pair.Value)
+			{
+				continue;
+			}
+
+			TSubclassOf<ABlockBase> BlockClass = Grid->GetPaletteClass(Pair.Value);
+			if (!BlockClass)
+			{
+				continue;
+			}
+
+			// 타입을 BeginPlay(그리드 등록) 전에 지정해 처음부터 Recordable로 한 번만 등록
+			// 레거시 SpawnBlock은 등록 후 타입을 바꾸므로 기록에 잘못된 이벤트가 남음
+			const FTransform SpawnTransform(Grid->CellToWorld(Pair.Key));
+			ABlockBase* NewBlock = World->SpawnActorDeferred<ABlockBase>(BlockClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			if (NewBlock)
+			{
+				NewBlock->SetInitialBlockType(EBlockType::Recordable);
+				NewBlock->FinishSpawning(SpawnTransform);
+
+				// 아래가 비어있으면 떨어지도록 낙하 검사 시작
+				NewBlock->SetActorTickEnabled(true);
+			}
+		}
+
+		// 3. 되감은 시점 이후의 기록은 더 이상 유효하지 않음
+		for (const FIntVector& RegionChunk : RewindRegions)
+		{
+			Regions.Remove(RegionChunk);
+		}
+	}
+
+	// 숨겼던 액터 복구 (커밋으로 제거된 액터는 이미 무효)
+	for (const TWeakObjectPtr<ABlockBase>& WeakBlock : HiddenBlocks)
+	{
+		if (ABlockBase* Block = WeakBlock.Get())
+		{
+			Block->SetActorHiddenInGame(false);
+			Block->SetActorEnableCollision(true);
+		}
+	}
+
+	ClearRewindState();
+}
+
+void UBlockHistorySubsystem::ClearRewindState()
+{
+	if (RewindVisualActor)
+	{
+		RewindVisualActor->Destroy();
+		RewindVisualActor = nullptr;
+	}
+
+	RewindMeshes.Reset();
+	HiddenBlocks.Reset();
+	RewindCells.Reset();
+	RewindBombCounts.Reset();
+	Timeline.Reset();
+	RewindRegions.Reset();
+	AppliedCount = 0;
+	bIsRewinding = false;
+	bRewindVisualDirty = false;
+}
@@ -0,0 +1,286 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockPredictionSubsystem.h"
+#include "Grid/BlockGridSubsystem.h"
+#include "Block/BlockBase.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+
+void UBlockPredictionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid = Collection.InitializeDependency<UBlockGridSubsystem>();
+	if (!Grid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockPredictionSubsystem: BlockGridSubsystem is null"));
+		return;
+	}
+
+	Grid->OnBlockEvent.AddUObject(this, &UBlockPredictionSubsystem::HandleBlockEvent);
+}
+
+void UBlockPredictionSubsystem::Deinitialize()
+{
+	if (Grid)
+	{
+		Grid->OnBlockEvent.RemoveAll(this);
+	}
+
+	// 남은 예측의 델리게이트 정리 (고스트는 월드와 함께 사라짐)
+	for (TPair<FPredictionKey::KeyType, FBlockPrediction>& Pair : Predictions)
+	{
+		if (UAbilitySystemComponent* ASC = Pair.Value.ASC.Get())
+		{
+			ASC->AbilityReplicatedEventDelegate(EAbilityGenericReplicatedEvent::GenericCancel, Pair.Value.AbilityHandle, Pair.Value.PredictionKey).RemoveAll(this);
+		}
+	}
+	Predictions.Empty();
+	SpawnCellToKey.Empty();
+	NumCaughtUp = 0;
+
+	Super::Deinitialize();
+}
+
+bool UBlockPredictionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBlockPredictionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBlockPredictionSubsystem, STATGROUP_Tickables);
+}
+
+ABlockBase* UBlockPredictionSubsystem::PredictBlock(
+	TSubclassOf<ABlockBase> BlockClass,
+	const FVector& Location,
+	EBlockType BlockType,
+	UAbilitySystemComponent* ASC,
+	FGameplayAbilitySpecHandle AbilityHandle,
+	FPredictionKey PredictionKey)
+{
+	if (PredictBlocks(BlockClass, MakeArrayView(&Location, 1), BlockType, ASC, AbilityHandle, PredictionKey) == 0)
+	{
+		return nullptr;
+	}
+
+	const FBlockPrediction& Prediction = Predictions.FindChecked(PredictionKey.Current);
+	return Prediction.Ghosts[0].Get();
+}
+
+int32 UBlockPredictionSubsystem::PredictBlocks(
+	TSubclassOf<ABlockBase> BlockClass,
+	TConstArrayView<FVector> Locations,
+	EBlockType BlockType,
+	UAbilitySystemComponent* ASC,
+	FGameplayAbilitySpecHandle AbilityHandle,
+	FPredictionKey PredictionKey)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Grid || !BlockClass || !ASC)
+	{
+		UE_LOG(LogTemp, Error, TEXT("BlockPredictionSubsystem: Invalid arguments for PredictBlocks"));
+		return 0;
+	}
+
+	if (!PredictionKey.IsValidKey())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockPredictionSubsystem: PredictionKey is not valid"));
+		return 0;
+	}
+
+	const FPredictionKey::KeyType KeyId = PredictionKey.Current;
+	if (Predictions.Contains(KeyId))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockPredictionSubsystem: PredictionKey %d already has ghost blocks"), KeyId);
+		return 0;
+	}
+
+	FBlockPrediction Prediction;
+	Prediction.PredictionKey = PredictionKey;
+	Prediction.ASC = ASC;
+	Prediction.AbilityHandle = AbilityHandle;
+
+	// 1. 고스트 블록 생성 (그리드 셀에 예측 플래그가 붙도록 BeginPlay 전에 표시)
+	// 등록 이벤트와 청크 편집 번호 갱신은 모든 고스트를 만든 뒤 한 번에 처리
+	{
+		FBlockGridBatchScope BatchScope(Grid);
+
+		for (const FVector& Location : Locations)
+		{
+			const FIntVector SpawnCell = Grid->WorldToCell(Location);
+			if (Grid->IsCellOccupied(SpawnCell) || SpawnCellToKey.Contains(SpawnCell))
+			{
+				continue;
+			}
+
+			const FTransform SpawnTransform(FRotator::ZeroRotator, Location);
+			ABlockBase* Ghost = World->SpawnActorDeferred<ABlockBase>(BlockClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			if (!Ghost)
+			{
+				UE_LOG(LogTemp, Error, TEXT("BlockPredictionSubsystem: Failed to spawn ghost block"));
+				continue;
+			}
+			Ghost->MarkAsPredicted();
+			Ghost->SetInitialBlockType(BlockType);
+			Ghost->FinishSpawning(SpawnTransform);
+
+			// 서버의 실제 블록과 같은 초기화 (낙하 판정 포함)
+			Ghost->SetActorTickEnabled(true);
+
+			SpawnCellToKey.Add(SpawnCell, TPair<FPredictionKey::KeyType, int32>(KeyId, Prediction.Ghosts.Num()));
+			Prediction.Ghosts.Add(Ghost);
+			Prediction.SpawnCells.Add(SpawnCell);
+		}
+	}
+
+	const int32 NumGhosts = Prediction.Ghosts.Num();
+	if (NumGhosts == 0)
+	{
+		return 0;
+	}
+
+	// 2. 예측 상태 기록
+	Prediction.NumUnresolved = NumGhosts;
+	Predictions.Add(KeyId, MoveTemp(Prediction));
+
+	// 3. 서버 응답 대기
+	// 예측 키 자체가 거부되면 (어빌리티 활성화 실패) 즉시 롤백
+	PredictionKey.NewRejectedDelegate().BindUObject(this, &UBlockPredictionSubsystem::HandlePredictionRejected, KeyId);
+	// 서버가 키를 처리했으면 실제 블록 복제를 기다림
+	PredictionKey.NewCaughtUpDelegate().BindUObject(this, &UBlockPredictionSubsystem::HandlePredictionCaughtUp, KeyId);
+	// 서버 어빌리티가 건설 검증에 실패하면 GenericCancel로 알려줌
+	ASC->AbilityReplicatedEventDelegate(EAbilityGenericReplicatedEvent::GenericCancel, AbilityHandle, PredictionKey)
+		.AddUObject(this, &UBlockPredictionSubsystem::HandleServerCancel, KeyId);
+
+	return NumGhosts;
+}
+
+void UBlockPredictionSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 서버가 처리했는데도 실제 블록이 오지 않은 예측은 롤백 (서버 상태가 기준)
+	const double Now = World->GetTimeSeconds();
+	TArray<FPredictionKey::KeyType, TInlineAllocator<4>> Expired;
+	for (const TPair<FPredictionKey::KeyType, FBlockPrediction>& Pair : Predictions)
+	{
+		if (Pair.Value.CaughtUpTime >= 0.0 && Now - Pair.Value.CaughtUpTime > ReplicationTimeout)
+		{
+			Expired.Add(Pair.Key);
+		}
+	}
+
+	for (const FPredictionKey::KeyType KeyId : Expired)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BlockPredictionSubsystem: Server block for prediction %d did not arrive, rolling back"), KeyId);
+		FinishPrediction(KeyId, true);
+	}
+}
+
+void UBlockPredictionSubsystem::HandlePredictionRejected(FPredictionKey::KeyType KeyId)
+{
+	FinishPrediction(KeyId, true);
+}
+
+void UBlockPredictionSubsystem::HandlePredictionCaughtUp(FPredictionKey::KeyType KeyId)
+{
+	FBlockPrediction* Prediction = Predictions.Find(KeyId);
+	if (!Prediction || Prediction->CaughtUpTime >= 0.0)
+	{
+		return;
+	}
+
+	// 실제 블록은 예측 키와 따로 복제되므로 조금 늦게 올 수 있음
+	const UWorld* World = GetWorld();
+	Prediction->CaughtUpTime = World ? World->GetTimeSeconds() : 0.0;
+	++NumCaughtUp;
+}
+
+void UBlockPredictionSubsystem::HandleServerCancel(FPredictionKey::KeyType KeyId)
+{
+	FinishPrediction(KeyId, true);
+}
+
+void UBlockPredictionSubsystem::HandleBlockEvent(const FBlockGridEvent& Event)
+{
+	// 예측 플래그가 없는 블록(서버에서 복제된 실제 블록)이 고스트 생성 셀에 등록되었는지 확인
+	if (Event.Type != EBlockGridEventType::Added || Event.Value.IsPredicted())
+	{
+		return;
+	}
+
+	TPair<FPredictionKey::KeyType, int32> Entry;
+	if (!SpawnCellToKey.RemoveAndCopyValue(Event.Cell, Entry))
+	{
+		return;
+	}
+
+	FBlockPrediction* Prediction = Predictions.Find(Entry.Key);
+	if (!Prediction)
+	{
+		return;
+	}
+
+	// 해당 셀의 고스트만 실제 블록으로 교체
+	if (ABlockBase* Ghost = Prediction->Ghosts[Entry.Value].Get())
+	{
+		Ghost->RemovePredictedBlock();
+	}
+	Prediction->Ghosts[Entry.Value].Reset();
+
+	// 모든 고스트가 교체되었으면 예측 종료
+	if (--Prediction->NumUnresolved <= 0)
+	{
+		FinishPrediction(Entry.Key, false);
+	}
+}
+
+void UBlockPredictionSubsystem::FinishPrediction(FPredictionKey::KeyType KeyId, bool bRolledBack)
+{
+	FBlockPrediction Prediction;
+	if (!Predictions.RemoveAndCopyValue(KeyId, Prediction))
+	{
+		return;
+	}
+
+	if (Prediction.CaughtUpTime >= 0.0)
+	{
+		--NumCaughtUp;
+	}
+
+	// 1. 남은 고스트 제거 (위에 착지했던 블록은 다시 낙하를 판정)
+	// 교체인 경우에도 실제 블록이 아직 낙하 중일 수 있으므로 같은 방식으로 제거
+	for (int32 i = 0; i < Prediction.Ghosts.Num(); ++i)
+	{
+		// 이미 교체된 셀은 다른 예측이 다시 쓰고 있을 수 있으므로 이 키의 항목만 제거
+		const TPair<FPredictionKey::KeyType, int32>* Entry = SpawnCellToKey.Find(Prediction.SpawnCells[i]);
+		if (Entry && Entry->Key == KeyId)
+		{
+			SpawnCellToKey.Remove(Prediction.SpawnCells[i]);
+		}
+
+		if (ABlockBase* Ghost = Prediction.Ghosts[i].Get())
+		{
+			Ghost->RemovePredictedBlock();
+		}
+	}
+
+	// 2. 서버 이벤트 델리게이트와 복제 데이터 정리
+	if (UAbilitySystemComponent* ASC = Prediction.ASC.Get())
+	{
+		ASC->AbilityReplicatedEventDelegate(EAbilityGenericReplicatedEvent::GenericCancel, Prediction.AbilityHandle, Prediction.PredictionKey).RemoveAll(this);
+		ASC->ConsumeAllReplicatedData(Prediction.AbilityHandle, Prediction.PredictionKey);
+	}
+
+	if (bRolledBack)
+	{
+		UE_LOG(LogTemp, Log, TEXT("BlockPredictionSubsystem: Rolled back %d predicted blocks for key %d"), Prediction.NumUnresolved, KeyId);
+	}
+}
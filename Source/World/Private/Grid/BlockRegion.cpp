@@ -0,0 +1,245 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Grid/BlockRegion.h"
+
+const FIntPoint FBlockRegion2D::Directions[4] =
+{
+	FIntPoint(1, 0),
+	FIntPoint(0, 1),
+	FIntPoint(-1, 0),
+	FIntPoint(0, -1)
+};
+
+void FBlockRegion2D::Reset()
+{
+	Bits.Reset();
+	Min = FIntPoint::ZeroValue;
+	Size = FIntPoint::ZeroValue;
+	WordsPerRow = 0;
+	NumRows = 0;
+	NumCells = 0;
+}
+
+void FBlockRegion2D::Build(TConstArrayView<FIntPoint> Cells)
+{
+	Reset();
+	if (Cells.Num() == 0)
+	{
+		return;
+	}
+
+	// 1. 경계 상자 계산
+	FIntPoint Max = Cells[0];
+	Min = Cells[0];
+	for (const FIntPoint& Cell : Cells)
+	{
+		Min = Min.ComponentMin(Cell);
+		Max = Max.ComponentMax(Cell);
+	}
+	Size = Max - Min + FIntPoint(1, 1);
+
+	// 2. 상하좌우 한 칸씩 여백을 둔 비트셋 할당
+	WordsPerRow = (Size.X + 2 + 63) / 64;
+	NumRows = Size.Y + 2;
+	Bits.SetNumZeroed(WordsPerRow * NumRows);
+
+	// 3. 셀 기록 (중복 셀은 한 번만 셈)
+	for (const FIntPoint& Cell : Cells)
+	{
+		const int32 LocalX = Cell.X - Min.X + 1;
+		const int32 LocalY = Cell.Y - Min.Y + 1;
+		uint64& Word = Bits[LocalY * WordsPerRow + (LocalX >> 6)];
+		const uint64 Mask = uint64(1) << (LocalX & 63);
+		if (!(Word & Mask))
+		{
+			Word |= Mask;
+			++NumCells;
+		}
+	}
+}
+
+bool FBlockRegion2D::Contains(const FIntPoint& Cell) const
+{
+	const int32 LocalX = Cell.X - Min.X + 1;
+	const int32 LocalY = Cell.Y - Min.Y + 1;
+	if (NumCells == 0 || LocalX < 1 || LocalY < 1 || LocalX > Size.X || LocalY > Size.Y)
+	{
+		return false;
+	}
+	return TestBit(LocalX, LocalY);
+}
+
+void FBlockRegion2D::FindBoundaryCells(TArray<FIntPoint>& OutCells) const
+{
+	OutCells.Reset();
+	if (NumCells == 0)
+	{
+		return;
+	}
+
+	// 여백 행은 항상 0이므로 1 ~ Size.Y 행만 검사
+	for (int32 LocalY = 1; LocalY <= Size.Y; ++LocalY)
+	{
+		const uint64* Row = GetRow(LocalY);
+		const uint64* Down = GetRow(LocalY - 1);
+		const uint64* Up = GetRow(LocalY + 1);
+
+		for (int32 WordIndex = 0; WordIndex < WordsPerRow; ++WordIndex)
+		{
+			const uint64 Current = Row[WordIndex];
+			if (!Current)
+			{
+				continue;
+			}
+
+			// 좌우 이웃: 옆 워드에서 넘어오는 비트까지 포함해 시프트
+			const uint64 PrevWord = WordIndex > 0 ? Row[WordIndex - 1] : 0;
+			const uint64 NextWord = WordIndex + 1 < WordsPerRow ? Row[WordIndex + 1] : 0;
+			const uint64 LeftNeighbor = (Current << 1) | (PrevWord >> 63);
+			const uint64 RightNeighbor = (Current >> 1) | (NextWord << 63);
+
+			// 4방향이 모두 채워진 셀만 내부, 나머지는 경계
+			const uint64 Interior = Current & Down[WordIndex] & Up[WordIndex] & LeftNeighbor & RightNeighbor;
+			uint64 Boundary = Current & ~Interior;
+
+			while (Boundary)
+			{
+				const int32 Bit = FMath::CountTrailingZeros64(Boundary);
+				Boundary &= Boundary - 1;
+
+				const int32 LocalX = WordIndex * 64 + Bit;
+				OutCells.Add(FIntPoint(Min.X + LocalX - 1, Min.Y + LocalY - 1));
+			}
+		}
+	}
+}
+
+void FBlockRegion2D::FindContours(TArray<FBlockRegionContour>& OutContours) const
+{
+	OutContours.Reset();
+	if (NumCells == 0)
+	{
+		return;
+	}
+
+	// 1. 영역을 왼쪽에 두는 방향의 경계 변을 시작 꼭짓점의 방향 비트로 기록
+	// 꼭짓점 좌표는 셀 로컬 좌표와 같은 기준 (셀 (X, Y)의 왼쪽 아래 꼭짓점 = (X, Y))
+	const int32 VertexStride = Size.X + 3;
+	TArray<uint8> OutgoingEdges;
+	OutgoingEdges.SetNumZeroed(VertexStride * (Size.Y + 3));
+
+	auto VertexIndex = [VertexStride](int32 X, int32 Y) { return Y * VertexStride + X; };
+
+	int32 NumEdges = 0;
+	for (int32 LocalY = 1; LocalY <= Size.Y; ++LocalY)
+	{
+		for (int32 LocalX = 1; LocalX <= Size.X; ++LocalX)
+		{
+			if (!TestBit(LocalX, LocalY))
+			{
+				continue;
+			}
+
+			// 아래가 비면 +X 변, 오른쪽이 비면 +Y 변, 위가 비면 -X 변, 왼쪽이 비면 -Y 변
+			if (!TestBit(LocalX, LocalY - 1)) { OutgoingEdges[VertexIndex(LocalX, LocalY)] |= 1 << 0; ++NumEdges; }
+			if (!TestBit(LocalX + 1, LocalY)) { OutgoingEdges[VertexIndex(LocalX + 1, LocalY)] |= 1 << 1; ++NumEdges; }
+			if (!TestBit(LocalX, LocalY + 1)) { OutgoingEdges[VertexIndex(LocalX + 1, LocalY + 1)] |= 1 << 2; ++NumEdges; }
+			if (!TestBit(LocalX - 1, LocalY)) { OutgoingEdges[VertexIndex(LocalX, LocalY + 1)] |= 1 << 3; ++NumEdges; }
+		}
+	}
+
+	// 변을 따라 걸을 때 왼쪽에 있는 셀 (진행 방향별, 시작 꼭짓점 기준 오프셋)
+	static const FIntPoint LeftCellOffsets[4] =
+	{
+		FIntPoint(0, 0),
+		FIntPoint(-1, 0),
+		FIntPoint(-1, -1),
+		FIntPoint(0, -1)
+	};
+
+	// 2. 남은 변이 있는 꼭짓점에서 시작해 닫힌 루프를 따라감
+	int32 NumVisited = 0;
+	for (int32 StartIndex = 0; StartIndex < OutgoingEdges.Num() && NumVisited < NumEdges; ++StartIndex)
+	{
+		while (OutgoingEdges[StartIndex])
+		{
+			FBlockRegionContour& Contour = OutContours.AddDefaulted_GetRef();
+
+			const FIntPoint Start(StartIndex % VertexStride, StartIndex / VertexStride);
+			const int32 StartDir = FMath::CountTrailingZeros(uint32(OutgoingEdges[StartIndex]));
+
+			FIntPoint Vertex = Start;
+			int32 Dir = StartDir;
+			int32 PrevDir = INDEX_NONE;
+			int64 TwiceArea = 0;
+
+			while (true)
+			{
+				// 현재 변 사용 처리
+				OutgoingEdges[VertexIndex(Vertex.X, Vertex.Y)] &= ~(1 << Dir);
+				++NumVisited;
+				++Contour.Perimeter;
+
+				// 방향이 바뀌는 꼭짓점만 기록
+				if (Dir != PrevDir)
+				{
+					Contour.Corners.Add(FIntPoint(Min.X + Vertex.X - 1, Min.Y + Vertex.Y - 1));
+				}
+
+				const FIntPoint LeftCell = Vertex + LeftCellOffsets[Dir];
+				const FIntPoint WorldCell(Min.X + LeftCell.X - 1, Min.Y + LeftCell.Y - 1);
+				if (Contour.Cells.Num() == 0 || Contour.Cells.Last() != WorldCell)
+				{
+					Contour.Cells.Add(WorldCell);
+				}
+
+				// 신발끈 공식 (부호로 외곽/구멍 판별)
+				const FIntPoint Next = Vertex + Directions[Dir];
+				TwiceArea += int64(Vertex.X) * Next.Y - int64(Next.X) * Vertex.Y;
+
+				PrevDir = Dir;
+				Vertex = Next;
+
+				// 다음 변 선택: 좌회전 > 직진 > 우회전 (대각선 접촉 지점에서 4방향 연결성 유지)
+				// 시작 꼭짓점에서는 이미 사용한 시작 변도 후보로 두어, 그 변이 선택되면 루프가 닫힌 것으로 판단
+				uint8 Available = OutgoingEdges[VertexIndex(Vertex.X, Vertex.Y)];
+				if (Vertex == Start)
+				{
+					Available |= 1 << StartDir;
+				}
+
+				int32 NextDir = INDEX_NONE;
+				for (const int32 Turn : { 1, 0, 3 })
+				{
+					const int32 Candidate = (PrevDir + Turn) & 3;
+					if (Available & (1 << Candidate))
+					{
+						NextDir = Candidate;
+						break;
+					}
+				}
+
+				if (NextDir == INDEX_NONE || (Vertex == Start && NextDir == StartDir))
+				{
+					break;
+				}
+				Dir = NextDir;
+			}
+
+			// 마지막 변이 시작 변과 같은 방향이면 시작 꼭짓점은 모서리가 아님
+			if (PrevDir == StartDir && Contour.Corners.Num() > 1)
+			{
+				Contour.Corners.RemoveAt(0);
+			}
+
+			// 마지막 셀이 첫 셀과 같으면 제거 (루프이므로)
+			if (Contour.Cells.Num() > 1 && Contour.Cells.Last() == Contour.Cells[0])
+			{
+				Contour.Cells.Pop();
+			}
+
+			Contour.bIsHole = TwiceArea < 0;
+		}
+	}
+}
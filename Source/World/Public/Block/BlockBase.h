@@ -31,6 +31,7 @@ enum class EBlockHighlightState : uint8
 // CPD 인덱스를 상수로 관리
 constexpr int32 CPD_INDEX_HIGHLIGHT = 0;
 constexpr int32 CPD_INDEX_BOMBCOUNT = 1;
+constexpr int32 CPD_INDEX_CRACK = 2;
 
 
 UCLASS()
@@ -45,8 +46,12 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-	UPROPERTY(VisibleAnywhere, Category = "Block")
-	// 블록의 타입을 담는 변수
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	UPROPERTY(EditAnywhere, Category = "Block")
+	// 블록의 타입을 담는 변수 (Warning, Recordable 블록은 레벨/BP에서 지정)
 	EBlockType BlockType = EBlockType::IMMUTABLE;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Grid")
@@ -87,6 +92,28 @@ protected:
 	// 현재 부착된 폭탄 개수 추적용
 	int32 CurrentBombCount = 0;
 
+	// 블록의 최대 체력 (셀 단위 체력은 UBlockGridSubsystem이 관리)
+	// 기본값은 스킬의 기본 블록 피해량과 같아 한 번에 파괴됨
+	UPROPERTY(EditDefaultsOnly, Category = "Block", meta = (ClampMin = "1", ClampMax = "65535"))
+	int32 MaxHitPoints = 100;
+
+	// 균열 표시 단계 수 (CPD 2에 0 ~ 1 사이 값으로 전달)
+	UPROPERTY(EditDefaultsOnly, Category = "Block", meta = (ClampMin = "1"))
+	int32 CrackStageCount = 3;
+
+	// 현재 균열 단계 (셀 체력은 서버에만 있으므로 단계만 클라이언트에 복제)
+	UPROPERTY(ReplicatedUsing = OnRep_CrackStage)
+	uint8 CrackStage = 0;
+
+	UFUNCTION()
+	void OnRep_CrackStage();
+
+	// 균열 단계를 CPD 2에 반영
+	void ApplyCrackStage();
+
+	// 낙하 중 보관하는 남은 체력 (0이면 손상되지 않음). 착지 시 그리드로 되돌아감
+	uint16 CarriedHitPoints = 0;
+
 	// 낙하 로직을 처리하는 함수
 	void UpdateGravity(float DeltaTime);
 
@@ -96,6 +123,25 @@ protected:
 	// 자신의 위 블록이 추락할 수 있도록 깨우는 함수
 	void NotifyUpperBlock();
 
+	// 블록 그리드 서브시스템에 현재 위치를 등록/해제
+	void RegisterToGrid();
+	// @param bFalling: 낙하 시작으로 인한 해제인지 (착지 시 이동으로 기록됨)
+	void UnregisterFromGrid(bool bFalling = false);
+
+	// 그리드 서브시스템에 등록된 셀 좌표 (UBlockGridSubsystem이 관리)
+	FIntVector GridCell = FIntVector::ZeroValue;
+
+	// 그리드 서브시스템에 등록되어 있는지
+	bool bRegisteredInGrid = false;
+
+	// 낙하로 인해 그리드를 떠난 상태인지 (GridCell은 낙하 시작 셀)
+	bool bLeftGridByFalling = false;
+
+	// 클라이언트 예측으로 생성된 고스트 블록인지 (UBlockPredictionSubsystem이 관리)
+	bool bIsPredicted = false;
+
+	friend class UBlockGridSubsystem;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -134,9 +180,26 @@ public:
 	EBlockType GetBlockType() const { return BlockType; }
 	FVector GetBlockLocation() const { return Location; }
 	float GetGridSize() const { return GridSize; }
+	FIntVector GetGridCell() const { return GridCell; }
+	bool IsRegisteredInGrid() const { return bRegisteredInGrid; }
+	bool IsPredicted() const { return bIsPredicted; }
+
+	// 예측 고스트 블록으로 표시 (그리드 셀에 반영되도록 BeginPlay 전에 호출)
+	void MarkAsPredicted() { bIsPredicted = true; }
+
+	// 생성할 블록의 타입 지정 (SpawnActorDeferred 후 FinishSpawning 전에 호출하면 처음부터 이 타입으로 그리드에 등록됨)
+	void SetInitialBlockType(EBlockType NewBlockType) { BlockType = NewBlockType; }
+
+	// 예측이 끝난 고스트 블록 제거 (파편 없이 사라지고, 그 위에 착지했던 블록을 다시 깨움)
+	void RemovePredictedBlock();
 
 	virtual bool CanBeDestroyed() const { return IsDestrictible; }
 
+	int32 GetMaxHitPoints() const { return FMath::Clamp(MaxHitPoints, 1, MAX_uint16); }
+
+	// 블록을 파괴하고 위 블록이 낙하하도록 깨움 (파편 연출 포함)
+	void DestroyBlock();
+
 	// 블록의 메시 컴포넌트를 반환하는 함수 (머티리얼 변경 등에 사용)
 	UStaticMeshComponent* GetBlockMesh() const { return MeshComponent; }
 
@@ -150,6 +213,11 @@ public:
 
 	// 폭탄 개수 변경 및 색상 갱신 (빨강) - CPD 1
 	void UpdateBombCount(int32 Delta, int32 MaxBombCount);
+	int32 GetCurrentBombCount() const { return CurrentBombCount; }
+
+	// 남은 체력에 맞춰 균열 단계 갱신 - CPD 2
+	// @param RemainingHitPoints: 남은 체력 (최대 체력이면 균열 없음)
+	void UpdateCrackStage(int32 RemainingHitPoints);
 
 	// [추가된 부분] 모든 클라이언트에게 색상 변경을 알리기 위해 함수 선언 변경
 	// 이 함수를 호출하면 서버+모든 클라이언트에서 실행됩니다.
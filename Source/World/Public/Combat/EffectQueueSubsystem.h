@@ -0,0 +1,92 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayTagContainer.h"
+#include "EffectQueueSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * 프레임 단위 GE 적용 큐
+ * 스킬, 폭탄, 적 공격 판정이 GE를 바로 적용하지 않고 (시전자, 대상, 스펙, 태그) 기록을 제출하면
+ * 같은 발동 + 같은 대상 + 같은 효과는 한 번만 남기고 프레임 끝에 한 번에 적용한다.
+ * 오버랩 결과는 컴포넌트 단위라 한 액터가 여러 번 잡히므로, 호출하는 쪽에서 중복 제거를 따로 하지 않아도 된다.
+ * @note GE 적용은 권한이 있는 쪽에서만 의미가 있으므로 시전자 ASC가 권한이 없으면 제출을 무시한다.
+ */
+UCLASS()
+class WORLD_API UEffectQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return PendingEffects.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	// GE 적용 기록 제출
+	// @param SourceASC: GE를 적용하는 시전자 ASC
+	// @param TargetASC: GE를 받을 대상 ASC
+	// @param Spec: 적용할 스펙 (여러 대상에 같은 스펙을 제출해도 됨)
+	// @param Tag: 같은 발동 안에서 효과를 구분하는 태그 (없으면 GE 클래스로만 구분)
+	// @param ActivationKey: 같은 발동을 묶는 객체 (nullptr이면 스펙 인스턴스 자체를 발동으로 취급)
+	// @return 큐에 새로 들어갔으면 true, 이번 프레임에 이미 같은 기록이 있거나 적용할 수 없으면 false
+	bool QueueEffect(
+		UAbilitySystemComponent* SourceASC,
+		UAbilitySystemComponent* TargetASC,
+		const FGameplayEffectSpecHandle& Spec,
+		FGameplayTag Tag = FGameplayTag(),
+		const UObject* ActivationKey = nullptr);
+
+	// 쌓인 기록을 즉시 모두 적용 (프레임 끝을 기다릴 수 없을 때)
+	void Flush();
+
+	// 월드의 큐를 가져오는 헬퍼
+	// @param WorldContextObject: 월드를 찾을 객체
+	static UEffectQueueSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 중복 판정 키 (발동, 대상, GE 클래스, 태그)
+	struct FQueuedEffectKey
+	{
+		const void* Activation = nullptr;
+		const UAbilitySystemComponent* Target = nullptr;
+		const UGameplayEffect* Definition = nullptr;
+		FGameplayTag Tag;
+
+		bool operator==(const FQueuedEffectKey& Other) const
+		{
+			return Activation == Other.Activation && Target == Other.Target && Definition == Other.Definition && Tag == Other.Tag;
+		}
+
+		friend uint32 GetTypeHash(const FQueuedEffectKey& Key)
+		{
+			uint32 Hash = HashCombine(PointerHash(Key.Activation), PointerHash(Key.Target));
+			Hash = HashCombine(Hash, PointerHash(Key.Definition));
+			return HashCombine(Hash, GetTypeHash(Key.Tag));
+		}
+	};
+
+	// 적용 대기 기록 (제출 순서대로 적용)
+	struct FQueuedEffect
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+		TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+		FGameplayEffectSpecHandle Spec;
+	};
+
+	TArray<FQueuedEffect> PendingEffects;
+	TSet<FQueuedEffectKey> PendingKeys;
+
+	// 이번 프레임에 중복으로 걸러진 제출 수 (디버그용)
+	int32 NumDuplicatesThisFrame = 0;
+};
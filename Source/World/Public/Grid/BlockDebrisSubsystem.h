@@ -0,0 +1,128 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Grid/BlockGridTypes.h"
+#include "BlockDebrisSubsystem.generated.h"
+
+class UBlockGridSubsystem;
+class UInstancedStaticMeshComponent;
+
+/**
+ * 블록 파괴/착지 시 튀는 파편 연출 서브시스템
+ * 파편은 고정 용량 풀에 SoA(속성별 배열)로 저장되며, 단순 탄도 운동 + 그리드 블록 윗면과의 충돌만 계산한다.
+ * 파편은 블록 메시/머티리얼 조합마다 인스턴스 메시 하나로 그려지므로 프레임당 비용은 조합별 인스턴스 트랜스폼 일괄 갱신 한 번이다.
+ * 액터나 물리 바디를 만들지 않으므로 대량 파괴에도 비용이 파편 개수에 비례하지 않는다.
+ * 파편은 그리드 이벤트(Removed, Moved)로 생성되므로 서버와 클라이언트 모두 각자의 그리드 기준으로 연출한다.
+ * @note 풀이 가득 차면 가장 먼저 생성된 파편 슬롯부터 재사용한다.
+ */
+UCLASS()
+class WORLD_API UBlockDebrisSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 풀 용량 (동시에 존재할 수 있는 최대 파편 수)
+	static constexpr int32 DebrisCapacity = 1024;
+
+	// 파괴된 블록 하나를 쪼개는 개수 (2 x 2 x 2)
+	static constexpr int32 FragmentsPerAxis = 2;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumAlive > 0 || bVisualDirty || PendingRemovals.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	// 파괴된 블록 자리에 파편 생성
+	// @param Center: 파괴된 블록의 중심 위치
+	// @param PaletteIndex: 파괴된 블록의 팔레트 인덱스 (메시/머티리얼을 참고)
+	void SpawnBlockDestroyDebris(const FVector& Center, uint16 PaletteIndex);
+
+	// 낙하한 블록이 착지한 자리에 작은 파편을 튀김
+	// @param Center: 착지한 블록의 중심 위치
+	// @param PaletteIndex: 착지한 블록의 팔레트 인덱스
+	// @param ImpactSpeed: 착지 직전 낙하 속도 (클수록 멀리 튐)
+	void SpawnBlockLandingDebris(const FVector& Center, uint16 PaletteIndex, float ImpactSpeed);
+
+	// 현재 살아있는 파편 수 (디버그용)
+	int32 GetNumAliveFragments() const { return NumAlive; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 그리드 이벤트 수신 (Removed -> 파괴 파편 예약, Added -> 같은 셀 예약 취소, Moved -> 착지 파편)
+	void HandleBlockEvent(const FBlockGridEvent& Event);
+
+	// 예약된 파괴 파편 생성 (같은 프레임에 같은 셀이 다시 채워진 경우는 이미 취소됨)
+	void FlushPendingRemovals();
+
+	// 파편 하나 생성 (풀 슬롯을 순환하며 할당)
+	void SpawnFragment(const FVector& Location, const FVector& Velocity, float Scale, float Lifetime, int32 MeshGroup);
+
+	// 팔레트 블록의 메시/머티리얼 조합을 그리는 인스턴스 메시 그룹을 찾거나 생성
+	// @return 그룹 인덱스, 블록 메시가 유효하지 않으면 INDEX_NONE
+	int32 FindOrAddMeshGroup(uint16 PaletteIndex);
+
+	// 파편 운동 및 수명 갱신
+	void SimulateFragments(float DeltaTime);
+
+	// 파편 상태를 인스턴스 메시에 반영
+	void UpdateDebrisMesh();
+
+	// 파편이 연출을 해도 되는 월드인지 (데디케이티드 서버는 그리지 않음)
+	bool ShouldSpawnDebris() const;
+
+	UPROPERTY()
+	TObjectPtr<UBlockGridSubsystem> Grid;
+
+	// 파편 속성 (인덱스 = 풀 슬롯 = 인스턴스 인덱스)
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Velocities;
+	TArray<FVector3f> Rotations;			// Pitch, Yaw, Roll (도)
+	TArray<FVector3f> AngularVelocities;	// 초당 회전 (도)
+	TArray<float> Ages;
+	TArray<float> Lifetimes;
+	TArray<float> Scales;
+	TArray<uint8> States;					// EDebrisState 비트
+	TArray<uint8> MeshGroups;				// 파편을 그리는 DebrisMeshes 인덱스
+
+	// 다음에 할당할 슬롯 (링 순서로 순환하므로 가장 오래된 슬롯을 재사용)
+	int32 NextSlot = 0;
+
+	// 살아있는 파편 수
+	int32 NumAlive = 0;
+
+	// 죽은 파편을 숨기기 위해 한 번 더 갱신해야 하는지
+	bool bVisualDirty = false;
+
+	// 매 프레임 재사용하는 인스턴스 트랜스폼 버퍼
+	TArray<FTransform> InstanceTransforms;
+
+	// 이번 프레임에 셀에서 사라진 블록 (Tick에서 파편 생성)
+	// 타입 변경 재등록이나 블록 교체처럼 같은 셀이 바로 다시 채워지면 파편 없이 취소됨
+	struct FPendingRemoval
+	{
+		FIntVector Cell;
+		FVector Location;
+		uint16 PaletteIndex;
+	};
+	TArray<FPendingRemoval> PendingRemovals;
+
+	// 파편 방향/속도 난수
+	FRandomStream Random;
+
+	// 파편을 그리는 액터와 메시/머티리얼 조합별 인스턴스 메시
+	UPROPERTY()
+	TObjectPtr<AActor> DebrisActor;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> DebrisMeshes;
+
+	// 팔레트 인덱스 -> DebrisMeshes 인덱스 (같은 메시/머티리얼을 쓰는 블록 클래스는 그룹을 공유)
+	TMap<uint16, int32> PaletteMeshGroups;
+};
@@ -0,0 +1,43 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ABlockBase;
+class UWorld;
+
+/**
+ * 시드 기반 블록 지형 생성
+ * 같은 시드와 크기면 항상 같은 셀에 같은 블록을 만들므로, 헤드리스(-nullrhi) 실행에서
+ * 스킬 결과를 UBlockGridSubsystem::GetStateHash로 비교하는 재현 가능한 시작 상태로 사용한다.
+ * 자동화 테스트: Winter2025.Skill.* (Skill/Private/Tests/SkillAutomationTests.cpp)
+ * 디버그용 콘솔 명령: Grid.SpawnField <Seed> <SizeX> <SizeY> <MaxHeight> [Density] [BlockClassPath], Grid.LogStateHash
+ */
+namespace BlockFieldGenerator
+{
+	struct FBlockFieldParams
+	{
+		// 지형의 최소 셀 (X, Y 모서리와 바닥 층)
+		FIntVector OriginCell = FIntVector::ZeroValue;
+
+		// 가로/세로 셀 수
+		int32 SizeX = 16;
+		int32 SizeY = 16;
+
+		// 기둥의 최대 높이 (1 ~ MaxHeight 사이에서 무작위)
+		int32 MaxHeight = 3;
+
+		// 기둥이 생길 확률 (0 ~ 1)
+		float Density = 1.0f;
+
+		// 난수 시드
+		int32 Seed = 0;
+	};
+
+	// 지형 생성 (이미 점유된 셀은 건너뜀)
+	// 모든 블록을 그리드 일괄 쓰기 안에서 생성하므로 이벤트는 생성이 끝난 뒤 한 번에 발생한다.
+	// @param BlockClass: 생성할 블록 클래스
+	// @return 생성된 블록 수
+	WORLD_API int32 SpawnBlockField(UWorld* World, TSubclassOf<ABlockBase> BlockClass, const FBlockFieldParams& Params);
+}
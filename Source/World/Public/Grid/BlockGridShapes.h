@@ -0,0 +1,41 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 그리드 셀 좌표 공간의 도형 래스터화
+ * 물리 쿼리 없이 정수 연산만으로 도형이 덮는 셀 목록을 구한다.
+ * 건설 드래그(선/사각형)처럼 클라이언트와 서버가 같은 입력으로 같은 셀 목록을 얻어야 하는 곳,
+ * 파괴 범위처럼 프리뷰와 실제 적중이 정확히 같아야 하는 곳에서 사용한다.
+ */
+namespace BlockGridShapes
+{
+	// 두 셀을 잇는 선분이 지나는 셀 (XY 평면 Bresenham, Z는 From의 층)
+	// 양 끝을 포함하며 From에서 To 순서로 추가한다.
+	// @param From: 시작 셀
+	// @param To: 끝 셀 (Z는 무시)
+	// @param OutCells: 결과 셀 목록 (추가만 함)
+	WORLD_API void RasterizeLine(const FIntVector& From, const FIntVector& To, TArray<FIntVector>& OutCells);
+
+	// 두 셀을 대각 꼭짓점으로 하는 XY 사각형 안의 모든 셀 (Z는 From의 층)
+	// @param From: 한쪽 꼭짓점 셀
+	// @param To: 반대쪽 꼭짓점 셀 (Z는 무시)
+	// @param OutCells: 결과 셀 목록 (추가만 함)
+	WORLD_API void RasterizeRect(const FIntVector& From, const FIntVector& To, TArray<FIntVector>& OutCells);
+
+	// RasterizeLine/RasterizeRect가 만들 셀 개수 (셀 목록을 만들기 전에 상한 검사용)
+	WORLD_API int32 CountLineCells(const FIntVector& From, const FIntVector& To);
+	WORLD_API int32 CountRectCells(const FIntVector& From, const FIntVector& To);
+
+	// 회전된 박스와 겹치는 셀 (분리축 검사, 박스의 셀 범위만 순회)
+	// 셀 공간 좌표계: 셀 (X, Y, Z)의 중심은 (X, Y, Z)이고 반크기는 CellHalfSize인 정육면체
+	// 맞닿기만 한 셀은 제외하며, Z, Y, X 순서로 추가한다.
+	// @param Center: 셀 공간 박스 중심
+	// @param Rotation: 박스 회전
+	// @param Extent: 셀 공간 박스 반크기
+	// @param CellHalfSize: 셀 반크기 (블록 충돌 박스에 맞추려면 0.5보다 약간 작게)
+	// @param OutCells: 결과 셀 목록 (추가만 함)
+	WORLD_API void RasterizeOrientedBox(const FVector& Center, const FQuat& Rotation, const FVector& Extent, double CellHalfSize, TArray<FIntVector>& OutCells);
+}
@@ -0,0 +1,242 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Grid/BlockGridTypes.h"
+#include "BlockGridSubsystem.generated.h"
+
+class ABlockBase;
+
+// 블록 단위 이벤트 알림 (생성, 파괴, 낙하, 폭탄 개수)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBlockGridEvent, const FBlockGridEvent& /*Event*/);
+
+// 스냅샷 복원 완료 알림 (셀 단위 이력이 더 이상 이어지지 않음)
+DECLARE_MULTICAST_DELEGATE(FOnBlockGridRestored);
+
+/**
+ * 월드에 배치된 블록들을 정수 셀 좌표로 관리하는 서브시스템
+ * 셀 데이터는 참조 카운트 기반 Copy-on-Write 청크에 저장되므로
+ * 스냅샷 생성은 O(청크 수), 복원은 청크 포인터 교체 + 변경된 셀의 액터 동기화만으로 끝난다.
+ * 라운드 리셋, 롤백, 리플레이, 테스트 픽스처의 기반으로 사용한다.
+ * @note 낙하 중인 블록은 착지할 때까지 그리드에 존재하지 않는다.
+ */
+UCLASS()
+class WORLD_API UBlockGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 그리드 좌표 변환
+	// 블록 중심은 (X * GridSize, Y * GridSize, Z * GridSize + GridSize / 2) 에 위치한다. (ABlockBase::CheckLanding 스냅 규칙과 동일)
+	FIntVector WorldToCell(const FVector& WorldLocation) const;
+	FVector CellToWorld(const FIntVector& Cell) const;
+	float GetGridSize() const { return GridSize; }
+
+	// 블록을 현재 위치의 셀에 등록 (BeginPlay, 착지 시 호출)
+	// 이미 같은 셀에 등록된 블록이면 아무 일도 하지 않음
+	void RegisterBlock(ABlockBase* Block);
+
+	// 블록을 그리드에서 제거 (EndPlay, 낙하 시작 시 호출)
+	// @param bFalling: 낙하 시작으로 인한 제거인지. true면 착지 시 Moved 이벤트로 이어진다.
+	void UnregisterBlock(ABlockBase* Block, bool bFalling = false);
+
+	// 블록에 부착된 폭탄 개수가 바뀌었음을 알림
+	void NotifyBombCountChanged(ABlockBase* Block, int32 OldCount, int32 NewCount);
+
+	// 셀 조회
+	bool IsCellOccupied(const FIntVector& Cell) const;
+	FBlockGridCell GetCell(const FIntVector& Cell) const;
+
+	// 여러 셀의 점유 여부를 한 번에 조회 (같은 청크의 셀이 이어지면 청크 조회를 재사용)
+	// @param Cells: 조회할 셀 목록
+	// @param OutOccupied: Cells와 같은 순서의 점유 여부
+	void GetCellsOccupancy(TConstArrayView<FIntVector> Cells, TBitArray<>& OutOccupied) const;
+
+	// 일괄 쓰기 시작/종료 (중첩 가능)
+	// 그 사이의 등록/해제는 셀 데이터에 바로 기록되지만, 청크 편집 번호 갱신과 블록 이벤트 알림은 EndBatch에서 한 번에 처리한다.
+	// 여러 블록을 한 프레임에 생성할 때 프리뷰 캐시 무효화와 리스너 호출이 블록 수만큼 반복되지 않도록 사용
+	void BeginBatch();
+	void EndBatch();
+
+	// 월드 박스와 겹치는 셀 범위 (블록 크기 기준, 비어있는 셀 포함)
+	// @param OutMinCell, OutMaxCell: 양 끝을 포함하는 범위. 겹치는 셀이 없으면 false
+	bool GetCellRangeInBox(const FBox& WorldBox, FIntVector& OutMinCell, FIntVector& OutMaxCell) const;
+
+	// 월드 박스와 겹치는 점유된 셀 목록 (물리 쿼리 없이 그리드만 조회)
+	void GetOccupiedCellsInBox(const FBox& WorldBox, TArray<FIntVector>& OutCells) const;
+
+	// 회전된 월드 박스와 겹치는 점유된 셀 목록 (BlockGridShapes::RasterizeOrientedBox로 정확히 계산)
+	// 블록 충돌 박스와 엄격하게 겹치는 셀만 포함하므로 같은 박스의 물리 오버랩과 결과가 같다.
+	// @param Center: 월드 박스 중심
+	// @param Rotation: 박스 회전
+	// @param Extent: 월드 박스 반크기
+	// @param OutCells: 결과 셀 목록 (추가만 함)
+	void GetOccupiedCellsInOrientedBox(const FVector& Center, const FQuat& Rotation, const FVector& Extent, TArray<FIntVector>& OutCells) const;
+
+	// 셀을 점유 중인 블록 액터 (스냅샷 복원 직후 등 액터가 아직 없으면 nullptr)
+	ABlockBase* GetBlockAt(const FIntVector& Cell) const;
+
+	// 박스와 겹치는 청크들의 마지막 편집 번호
+	// 범위 안의 셀이 바뀔 때마다 값이 커지므로, 범위 결과를 캐시하는 쪽(스킬 프리뷰 등)이 다시 계산할지 판단하는 데 사용
+	// @return 범위 안에서 편집이 없었다면 0
+	uint32 GetEditStampInBox(const FBox& WorldBox) const;
+
+	// 셀의 남은 체력 (빈 셀이면 0, 손상되지 않은 셀이면 블록 클래스의 최대 체력)
+	int32 GetCellHitPoints(const FIntVector& Cell) const;
+
+	// 여러 셀에 한 번에 피해를 줌 (서버 전용, 클라이언트에서는 무시)
+	// 체력이 0이 된 블록은 모든 셀을 처리한 뒤에 파괴하므로, 연쇄 낙하가 같은 호출의 다른 셀 판정에 끼어들지 않는다.
+	// @param Cells: 피해를 줄 셀 목록 (중복 셀은 한 번만 처리, 파괴 불가능한 블록은 무시)
+	// @param Damage: 셀당 피해량
+	// @return 파괴된 블록 개수
+	int32 ApplyCellDamage(const TArray<FIntVector>& Cells, float Damage);
+
+	// 현재 그리드의 스냅샷 생성
+	// 청크 포인터만 복사하며, 이후 해당 청크에 쓰기가 발생하면 그때 복사된다.
+	// 낙하 중인 블록은 낙하를 시작한 셀에 있는 것으로 기록한다. (그 셀의 청크만 스냅샷 전용으로 복사)
+	FBlockGridSnapshot TakeSnapshot();
+
+	// 두 스냅샷 사이에서 상태가 달라진 셀 목록을 구함
+	// 같은 청크를 공유하는 경우 포인터 비교만으로 건너뛴다.
+	// @param From: 기준 스냅샷
+	// @param To: 비교할 스냅샷
+	// @param OutChangedCells: 달라진 셀 좌표 (추가만 함)
+	void DiffSnapshots(const FBlockGridSnapshot& From, const FBlockGridSnapshot& To, TArray<FIntVector>& OutChangedCells) const;
+
+	// 현재 그리드와 스냅샷 사이에서 달라진 셀 목록을 구함
+	void DiffWithCurrent(const FBlockGridSnapshot& Snapshot, TArray<FIntVector>& OutChangedCells) const;
+
+	// 스냅샷 상태로 그리드를 복원
+	// 낙하 중인 블록을 먼저 제거하고(복원된 상태 위에 착지하지 않도록), 청크 포인터를 교체한 뒤,
+	// 달라진 셀만 블록 액터를 제거/생성하여 월드를 맞춘다. (서버 전용)
+	// 스냅샷 당시 낙하 시작 셀이 점유되어 있던 낙하 중 블록은 제거하지 않는다.
+	// @return 액터 동기화가 일어난 셀 개수 (-1이면 실패)
+	int32 RestoreSnapshot(const FBlockGridSnapshot& Snapshot);
+
+	// 그리드 상태 해시 (점유된 셀의 좌표, 블록 클래스, 타입, 플래그, 남은 체력)
+	// 청크/셀 순서를 정렬해서 계산하므로 같은 상태면 실행마다 같은 값이 나온다. 헤드리스 실행 결과 비교용
+	uint32 GetStateHash() const;
+
+	// 존재하는 청크 좌표 목록
+	void GetChunkCoords(TArray<FIntVector>& OutChunkCoords) const;
+
+	// 청크 안의 점유된 셀을 순회
+	void ForEachOccupiedCellInChunk(const FIntVector& ChunkCoord, TFunctionRef<void(const FIntVector&, const FBlockGridCell&)> Func) const;
+
+	// 블록 단위 이벤트 (스냅샷 복원 중에는 발생하지 않음)
+	FOnBlockGridEvent OnBlockEvent;
+
+	// 스냅샷 복원 완료 이벤트
+	FOnBlockGridRestored OnSnapshotRestored;
+
+	// 블록 클래스를 팔레트 인덱스로 변환 (없으면 추가). 0은 빈 칸 전용
+	uint16 FindOrAddPaletteIndex(TSubclassOf<ABlockBase> BlockClass);
+
+	// 팔레트 인덱스의 블록 클래스
+	TSubclassOf<ABlockBase> GetPaletteClass(uint16 PaletteIndex) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 셀을 읽기 전용으로 조회 (청크가 없으면 nullptr)
+	const FBlockGridCell* FindCell(const FIntVector& Cell) const;
+
+	// 쓰기용 셀 참조를 얻음. 청크가 공유 중이면 여기서 복사한다. (Copy-on-Write)
+	FBlockGridCell& GetMutableCell(const FIntVector& Cell, FBlockGridChunk*& OutChunk);
+
+	// 셀 값을 기록하고 청크의 점유 카운트를 갱신
+	void WriteCell(const FIntVector& Cell, const FBlockGridCell& NewValue);
+
+	// 블록 액터의 현재 셀 값
+	FBlockGridCell MakeCellValue(ABlockBase* Block);
+
+	// 팔레트 블록 클래스의 최대 체력 (CDO 기준)
+	int32 GetPaletteMaxHitPoints(uint16 PaletteIndex) const;
+
+	// 셀의 남은 체력 기록 (최대 체력 이상이면 손상 기록 제거)
+	void WriteCellHitPoints(const FIntVector& Cell, int32 HitPoints, int32 MaxHitPoints);
+
+	// 청크의 편집 번호 갱신
+	void MarkChunkEdited(const FIntVector& ChunkCoord);
+
+	// 블록 이벤트 알림 (일괄 쓰기 중이면 EndBatch까지 보류)
+	void BroadcastBlockEvent(const FBlockGridEvent& Event);
+
+	// 두 청크 맵을 비교하여 달라진 셀을 수집 (셀 값 또는 남은 체력이 다른 셀)
+	static void DiffChunkMaps(
+		const TMap<FIntVector, FBlockGridChunkPtr>& From,
+		const TMap<FIntVector, FBlockGridChunkPtr>& To,
+		TArray<FIntVector>& OutChangedCells);
+
+	// 셀 데이터 (청크 좌표 -> 청크)
+	TMap<FIntVector, FBlockGridChunkPtr> Chunks;
+
+	// 셀을 점유 중인 블록 액터 (스냅샷 대상 아님)
+	TMap<FIntVector, TWeakObjectPtr<ABlockBase>> CellActors;
+
+	// 낙하로 그리드를 떠나 아직 착지하지 않은 블록 (GridCell은 낙하 시작 셀)
+	TSet<TWeakObjectPtr<ABlockBase>> FallingBlocks;
+
+	// 블록 클래스 팔레트 (0번은 빈 칸용 nullptr)
+	UPROPERTY()
+	TArray<TSubclassOf<ABlockBase>> Palette;
+
+	// 셀 한 칸의 크기 (블록 BP의 GridSize와 같아야 함)
+	float GridSize = 100.0f;
+
+	// 스냅샷 일련번호
+	uint32 NextSnapshotSerial = 1;
+
+	// 청크별 마지막 편집 번호 (청크가 비어서 제거되어도 남겨둠)
+	TMap<FIntVector, uint32> ChunkEditStamps;
+
+	// 편집 번호 (셀이 바뀔 때마다 증가)
+	uint32 NextEditStamp = 1;
+
+	// 스냅샷 복원 중에는 액터 등록/해제가 셀 데이터를 건드리지 않음
+	bool bIsRestoring = false;
+
+	// 일괄 쓰기 중첩 깊이
+	int32 BatchDepth = 0;
+
+	// 일괄 쓰기 동안 편집된 청크
+	TSet<FIntVector> BatchEditedChunks;
+
+	// 일괄 쓰기 동안 보류된 블록 이벤트
+	TArray<FBlockGridEvent> BatchEvents;
+};
+
+/**
+ * 범위 안에서 UBlockGridSubsystem 일괄 쓰기를 유지하는 스코프
+ * 서브시스템이 없으면 아무 일도 하지 않는다.
+ */
+struct FBlockGridBatchScope
+{
+	explicit FBlockGridBatchScope(UBlockGridSubsystem* InGrid)
+		: Grid(InGrid)
+	{
+		if (Grid)
+		{
+			Grid->BeginBatch();
+		}
+	}
+
+	~FBlockGridBatchScope()
+	{
+		if (Grid)
+		{
+			Grid->EndBatch();
+		}
+	}
+
+	FBlockGridBatchScope(const FBlockGridBatchScope&) = delete;
+	FBlockGridBatchScope& operator=(const FBlockGridBatchScope&) = delete;
+
+private:
+	UBlockGridSubsystem* Grid;
+};
@@ -0,0 +1,154 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Block/BlockBase.h"
+
+// 청크 한 변의 셀 개수 (16 x 16 x 16 = 4096셀)
+constexpr int32 BLOCK_GRID_CHUNK_SIZE = 16;
+constexpr int32 BLOCK_GRID_CHUNK_CELLS = BLOCK_GRID_CHUNK_SIZE * BLOCK_GRID_CHUNK_SIZE * BLOCK_GRID_CHUNK_SIZE;
+
+// 셀 상태 플래그
+// 클라이언트가 예측으로 만든 고스트 블록 (서버 확정 전까지 로컬 그리드에만 존재)
+constexpr uint8 BLOCK_CELL_FLAG_PREDICTED = 1 << 0;
+
+/**
+ * 그리드 한 칸의 상태
+ * 액터 포인터가 아닌 순수 값만 담으므로 스냅샷에 그대로 복사될 수 있다.
+ */
+struct FBlockGridCell
+{
+	// 0 = 빈 칸, 그 외 = 블록 클래스 팔레트 인덱스
+	uint16 PaletteIndex = 0;
+
+	// 셀에 있는 블록의 타입
+	EBlockType BlockType = EBlockType::IMMUTABLE;
+
+	// 셀 단위 상태 플래그 (BLOCK_CELL_FLAG_*)
+	uint8 Flags = 0;
+
+	bool IsEmpty() const { return PaletteIndex == 0; }
+	bool IsPredicted() const { return (Flags & BLOCK_CELL_FLAG_PREDICTED) != 0; }
+
+	bool operator==(const FBlockGridCell& Other) const
+	{
+		return PaletteIndex == Other.PaletteIndex && BlockType == Other.BlockType && Flags == Other.Flags;
+	}
+	bool operator!=(const FBlockGridCell& Other) const { return !(*this == Other); }
+};
+
+/**
+ * 16^3 셀을 담는 청크
+ * 청크는 참조 카운트로 공유되며, 공유 중인 청크에 쓰기가 발생하면 복사된다. (Copy-on-Write)
+ */
+struct FBlockGridChunk
+{
+	FBlockGridCell Cells[BLOCK_GRID_CHUNK_CELLS];
+
+	// 비어있지 않은 셀 개수 (0이 되면 청크를 제거할 수 있음)
+	int32 NumOccupied = 0;
+
+	// 손상된 셀의 남은 체력 (로컬 인덱스 -> HP)
+	// 대부분의 셀은 손상되지 않으므로 희소 맵으로 보관하며, 없으면 최대 체력으로 간주한다.
+	TMap<uint16, uint16> HitPoints;
+
+	// 청크 내부 로컬 좌표(0 ~ 15)를 배열 인덱스로 변환
+	static int32 LocalIndex(const FIntVector& Local)
+	{
+		return Local.X + Local.Y * BLOCK_GRID_CHUNK_SIZE + Local.Z * BLOCK_GRID_CHUNK_SIZE * BLOCK_GRID_CHUNK_SIZE;
+	}
+
+	// 배열 인덱스를 로컬 좌표로 변환
+	static FIntVector LocalCoord(int32 Index)
+	{
+		return FIntVector(
+			Index % BLOCK_GRID_CHUNK_SIZE,
+			(Index / BLOCK_GRID_CHUNK_SIZE) % BLOCK_GRID_CHUNK_SIZE,
+			Index / (BLOCK_GRID_CHUNK_SIZE * BLOCK_GRID_CHUNK_SIZE));
+	}
+};
+
+/**
+ * 블록 단위 그리드 이벤트
+ * 셀 데이터 변화와 달리, 낙하(이동)를 생성/제거와 구분하여 알려준다.
+ */
+enum class EBlockGridEventType : uint8
+{
+	Added,				// 블록이 셀에 새로 생김 (배치, 생성)
+	Removed,			// 블록이 셀에서 사라짐 (파괴)
+	Moved,				// 블록이 FromCell에서 낙하하여 Cell에 착지
+	BombCountChanged	// 블록에 부착된 폭탄 개수 변경
+};
+
+struct FBlockGridEvent
+{
+	EBlockGridEventType Type = EBlockGridEventType::Added;
+
+	// 이벤트가 일어난 셀 (Moved의 경우 착지한 셀)
+	FIntVector Cell = FIntVector::ZeroValue;
+
+	// Moved의 경우 낙하를 시작한 셀
+	FIntVector FromCell = FIntVector::ZeroValue;
+
+	// 블록의 셀 값 (Removed의 경우 제거되기 전 값)
+	FBlockGridCell Value;
+
+	// Removed의 경우 블록이 사라진 월드 위치 (낙하 중 파괴되면 Cell과 다름)
+	FVector Location = FVector::ZeroVector;
+
+	// BombCountChanged의 경우 변경 전/후 폭탄 개수
+	uint8 OldBombCount = 0;
+	uint8 NewBombCount = 0;
+};
+
+using FBlockGridChunkPtr = TSharedPtr<FBlockGridChunk, ESPMode::ThreadSafe>;
+
+/**
+ * 그리드 스냅샷
+ * 청크 포인터의 맵일 뿐이므로 생성 비용은 O(청크 수)이고, 셀 데이터는 복사되지 않는다.
+ */
+struct FBlockGridSnapshot
+{
+	TMap<FIntVector, FBlockGridChunkPtr> Chunks;
+
+	// 낙하 시작 셀에 이미 다른 블록이 들어서서 셀 데이터에 기록하지 못한 낙하 중 블록
+	// 복원 시 이 블록은 제거하지 않고 낙하를 이어가게 둔다.
+	TArray<TWeakObjectPtr<ABlockBase>> InFlightBlocks;
+
+	// 0이면 유효하지 않은 스냅샷
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Serial != 0; }
+};
+
+namespace BlockGrid
+{
+	// 음수 좌표도 올바르게 내림하는 정수 나눗셈
+	FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+	{
+		return (Value >= 0) ? (Value / Divisor) : ((Value - Divisor + 1) / Divisor);
+	}
+
+	// 셀 좌표 -> 청크 좌표
+	FORCEINLINE FIntVector CellToChunk(const FIntVector& Cell)
+	{
+		return FIntVector(
+			FloorDiv(Cell.X, BLOCK_GRID_CHUNK_SIZE),
+			FloorDiv(Cell.Y, BLOCK_GRID_CHUNK_SIZE),
+			FloorDiv(Cell.Z, BLOCK_GRID_CHUNK_SIZE));
+	}
+
+	// 셀 좌표 -> 청크 내부 로컬 좌표
+	FORCEINLINE FIntVector CellToLocal(const FIntVector& Cell)
+	{
+		const FIntVector Chunk = CellToChunk(Cell);
+		return Cell - Chunk * BLOCK_GRID_CHUNK_SIZE;
+	}
+
+	// 청크 좌표 + 로컬 인덱스 -> 셀 좌표
+	FORCEINLINE FIntVector ChunkLocalToCell(const FIntVector& Chunk, int32 LocalIndex)
+	{
+		return Chunk * BLOCK_GRID_CHUNK_SIZE + FBlockGridChunk::LocalCoord(LocalIndex);
+	}
+}
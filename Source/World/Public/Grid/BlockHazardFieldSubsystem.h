@@ -0,0 +1,87 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Grid/BlockGridTypes.h"
+#include "BlockHazardFieldSubsystem.generated.h"
+
+class UBlockGridSubsystem;
+
+/**
+ * Warning 블록(및 임시 위험 셀)으로부터의 거리장 서브시스템
+ * 6방향 맨해튼 거리를 셀 단위로 저장하며, 위험원이 추가/제거될 때 영향받는 셀만 증분 갱신한다.
+ * 거리는 MaxHazardDistance에서 잘리므로 한 번의 편집 비용은 그 반경 안으로 제한된다.
+ * AI, 스킬, UI는 GetHazardDistance로 O(1) 조회한다.
+ */
+UCLASS()
+class WORLD_API UBlockHazardFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 저장하는 최대 거리 (셀). 이보다 멀면 HazardDistanceFar
+	static constexpr uint8 MaxHazardDistance = 16;
+	static constexpr uint8 HazardDistanceFar = 0xFF;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 셀에서 가장 가까운 위험원까지의 거리 (셀 단위, 멀면 HazardDistanceFar)
+	uint8 GetHazardDistance(const FIntVector& Cell) const;
+
+	// 월드 위치에서 가장 가까운 위험원까지의 거리 (월드 단위, 멀면 -1)
+	float GetHazardDistanceAtLocation(const FVector& WorldLocation) const;
+
+	// 임시 위험원 추가/제거 (보스 공격 예고 장판 등). Warning 블록과 참조 카운트를 공유한다.
+	void AddHazardSources(const TArray<FIntVector>& Cells);
+	void RemoveHazardSources(const TArray<FIntVector>& Cells);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 거리 값을 담는 청크 (그리드 청크와 같은 크기)
+	struct FHazardChunk
+	{
+		uint8 Distance[BLOCK_GRID_CHUNK_CELLS];
+
+		// HazardDistanceFar가 아닌 셀 수 (0이 되면 청크 해제)
+		int32 NumNearCells = 0;
+
+		FHazardChunk() { FMemory::Memset(Distance, HazardDistanceFar, sizeof(Distance)); }
+	};
+
+	// 그리드 이벤트 수신
+	void HandleBlockEvent(const FBlockGridEvent& Event);
+	void HandleSnapshotRestored();
+
+	// 위험원 참조 카운트 증감 (0 <-> 1 전이 시에만 거리장 갱신)
+	void AddSource(const FIntVector& Cell);
+	void RemoveSource(const FIntVector& Cell);
+
+	// 거리 읽기/쓰기
+	uint8 ReadDistance(const FIntVector& Cell) const;
+	void WriteDistance(const FIntVector& Cell, uint8 Distance);
+
+	// 버킷 큐에 들어있는 셀에서부터 거리를 낮추며 전파
+	void PropagateLower();
+
+	// 그리드 전체의 Warning 셀과 임시 위험원으로 재구성
+	void RebuildFromGrid();
+
+	UPROPERTY()
+	TObjectPtr<UBlockGridSubsystem> Grid;
+
+	// 청크 좌표 -> 거리 청크 (위험원 근처에만 생성)
+	TMap<FIntVector, TUniquePtr<FHazardChunk>> Chunks;
+
+	// 위험원 셀 -> 참조 카운트
+	TMap<FIntVector, uint16> SourceCounts;
+
+	// AddHazardSources로 추가된 임시 위험원 셀 -> 참조 카운트 (그리드에 없으므로 재구성 시 다시 더함)
+	TMap<FIntVector, uint16> TemporarySourceCounts;
+
+	// 거리별 전파 대기 셀 (거리가 작으므로 버킷 큐 사용)
+	TArray<FIntVector> Buckets[MaxHazardDistance + 1];
+};
@@ -0,0 +1,98 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Recordable 블록의 상태 전이 종류
+enum class EBlockHistoryEvent : uint8
+{
+	Spawned,	// 셀에 생성됨
+	Destroyed,	// 셀에서 파괴됨
+	Fell,		// Cell에서 ToCell로 낙하
+	BombCount	// 폭탄 개수 변경
+};
+
+// 디코딩된 기록 한 건
+struct FBlockHistoryRecord
+{
+	// 기록 시점 (60Hz 틱)
+	int64 Tick = 0;
+
+	EBlockHistoryEvent Type = EBlockHistoryEvent::Spawned;
+
+	// 이벤트가 일어난 셀 (Fell의 경우 낙하 시작 셀)
+	FIntVector Cell = FIntVector::ZeroValue;
+
+	// Fell의 경우 착지 셀
+	FIntVector ToCell = FIntVector::ZeroValue;
+
+	// 블록 클래스 팔레트 인덱스
+	uint16 PaletteIndex = 0;
+
+	// BombCount의 경우 변경 전/후 개수
+	uint8 OldBombCount = 0;
+	uint8 NewBombCount = 0;
+};
+
+/**
+ * 한 영역(그리드 청크)의 기록을 담는 고정 용량 바이트 링 버퍼
+ * 프레임 단위로 [varint 틱 델타][varint 이벤트 수][이벤트...] 를 기록한다.
+ * 셀 좌표는 영역 원점 기준 로컬 인덱스(varint), 낙하 목적지는 지그재그 varint 델타로 저장한다.
+ * 용량이 부족하거나 보관 기간이 지난 프레임은 가장 오래된 것부터 버린다.
+ */
+class WORLD_API FBlockHistoryRing
+{
+public:
+	explicit FBlockHistoryRing(int32 InCapacity = 8 * 1024);
+
+	// 한 틱 분량의 기록을 추가
+	// @param Tick: 기록 시점 (이전 기록보다 작지 않아야 함)
+	// @param Records: 같은 틱에 일어난 기록들 (모두 RegionOrigin 청크 안의 셀)
+	// @param RegionOrigin: 영역의 원점 셀 (청크 좌표 * 청크 크기)
+	// @return 기록 성공 여부 (한 프레임이 용량보다 크면 실패)
+	bool AppendFrame(int64 Tick, const TArray<FBlockHistoryRecord>& Records, const FIntVector& RegionOrigin);
+
+	// MinTick보다 오래된 프레임 제거
+	void EvictOlderThan(int64 MinTick);
+
+	// MinTick 이후의 모든 기록을 시간 순으로 디코딩하여 추가
+	void Decode(const FIntVector& RegionOrigin, int64 MinTick, TArray<FBlockHistoryRecord>& OutRecords) const;
+
+	void Reset();
+
+	bool IsEmpty() const { return NumFrames == 0; }
+	int32 GetUsedBytes() const { return Used; }
+	int32 GetCapacity() const { return Data.Num(); }
+
+private:
+	// 링 버퍼에서 한 프레임을 디코딩하고 커서를 다음 프레임으로 이동
+	// @param OutRecords: nullptr이면 건너뛰기만 함
+	void DecodeFrame(int32& Cursor, int64& InOutTick, const FIntVector& RegionOrigin, TArray<FBlockHistoryRecord>* OutRecords) const;
+
+	// 가장 오래된 프레임 제거
+	void DropOldestFrame();
+
+	// 가장 오래된 프레임의 틱
+	int64 PeekOldestTick() const;
+
+	uint8 ReadByte(int32& Cursor) const;
+	uint32 ReadVarUInt(int32& Cursor) const;
+
+	// 바이트 배열
+	TArray<uint8> Data;
+
+	// 다음 쓰기 위치, 가장 오래된 프레임 위치, 사용 중인 바이트
+	int32 Head = 0;
+	int32 Tail = 0;
+	int32 Used = 0;
+
+	// 저장된 프레임 수
+	int32 NumFrames = 0;
+
+	// 가장 오래된 프레임의 틱 델타가 기준으로 삼는 틱
+	int64 TailBaseTick = 0;
+
+	// 가장 최근에 기록된 프레임의 틱
+	int64 LastTick = 0;
+};
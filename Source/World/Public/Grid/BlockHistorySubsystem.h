@@ -0,0 +1,165 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Grid/BlockGridTypes.h"
+#include "Grid/BlockHistoryRing.h"
+#include "BlockHistorySubsystem.generated.h"
+
+class ABlockBase;
+class UBlockGridSubsystem;
+class UInstancedStaticMeshComponent;
+
+/**
+ * Recordable 블록의 시간 기록 서브시스템
+ * 그리드 이벤트(생성, 파괴, 낙하, 폭탄 개수) 중 Recordable 셀의 것만 영역(청크)별 링 버퍼에 기록한다.
+ * 기록은 이벤트가 있을 때만 비용이 들고 Tick을 쓰지 않으므로 레벨 전체에 항상 켜둘 수 있다.
+ *
+ * 되감기 중에는 해당 영역의 블록 액터를 숨기고 인스턴스 메시로 상태를 표시하므로
+ * 프레임마다 액터를 생성하지 않는다. EndRewind(true) 시에만 최종 상태로 액터를 한 번에 맞춘다.
+ */
+UCLASS()
+class WORLD_API UBlockHistorySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 기록 해상도 (초당 틱 수)와 보관 기간
+	static constexpr int32 HistoryTicksPerSecond = 60;
+	static constexpr int32 HistoryWindowSeconds = 30;
+
+	// 영역 하나의 링 버퍼 용량 (바이트)
+	static constexpr int32 RegionCapacityBytes = 8 * 1024;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return bIsRewinding; }
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	// 되감기 시작
+	// @param RegionChunks: 되감을 영역(청크 좌표). 비어있으면 기록이 있는 모든 영역
+	// @return 되감을 기록이 있으면 true
+	bool BeginRewind(const TArray<FIntVector>& RegionChunks);
+
+	// 재생 속도 설정 (초당 배속). 음수면 과거로, 양수면 현재 쪽으로 재생
+	void SetPlaybackRate(float NewRate) { PlaybackRate = NewRate; }
+	float GetPlaybackRate() const { return PlaybackRate; }
+
+	// 특정 시점으로 바로 이동 (현재로부터 몇 초 전인지)
+	void SeekSecondsAgo(float SecondsAgo);
+
+	// 되감기 종료
+	// @param bCommit: true면 되감은 시점의 상태로 블록 액터를 맞추고 이후 기록을 버림. false면 현재 상태로 복귀
+	void EndRewind(bool bCommit);
+
+	bool IsRewinding() const { return bIsRewinding; }
+
+	// 되감기 중인 시점이 현재로부터 몇 초 전인지
+	float GetRewindSecondsAgo() const;
+
+	// 되감기 중인 시점에 셀에 붙어있던 폭탄 개수 (UI 표시용)
+	uint8 GetRewindBombCount(const FIntVector& Cell) const;
+
+	// 기록 중인 영역 수와 전체 사용 바이트 (디버그용)
+	int32 GetNumRecordedRegions() const { return Regions.Num(); }
+	int32 GetTotalRecordedBytes() const;
+
+protected:
+	// 영역 하나의 기록
+	struct FRegionHistory
+	{
+		FBlockHistoryRing Ring{ RegionCapacityBytes };
+
+		// 아직 링 버퍼에 쓰지 않은 현재 틱의 기록
+		TArray<FBlockHistoryRecord> Pending;
+		int64 PendingTick = 0;
+	};
+
+	// 그리드 이벤트 수신
+	void HandleBlockEvent(const FBlockGridEvent& Event);
+	void HandleSnapshotRestored();
+
+	// 기록 추가 (영역의 현재 틱 버퍼에 모음)
+	void AddRecord(const FBlockHistoryRecord& Record);
+
+	// 영역의 대기 중인 기록을 링 버퍼에 씀
+	void FlushRegion(const FIntVector& RegionChunk, FRegionHistory& Region);
+
+	// 현재 시각의 기록 틱
+	int64 GetCurrentTick() const;
+
+	// 되감기 상태에 기록 하나를 정방향/역방향으로 적용
+	// 되감기 영역 밖의 셀은 건드리지 않음 (Fell의 출발/착지 셀 중 영역 안쪽만 반영)
+	void ApplyRecord(const FBlockHistoryRecord& Record, bool bForward);
+
+	// 재생 위치를 목표 틱으로 이동
+	void MoveToTick(int64 TargetTick);
+
+	// 되감기 상태를 인스턴스 메시에 반영
+	void RefreshRewindVisual();
+
+	// 셀이 되감기 영역 안인지
+	bool IsInRewindRegion(const FIntVector& Cell) const { return RewindRegions.Contains(BlockGrid::CellToChunk(Cell)); }
+
+	// 되감기 자원 정리
+	void ClearRewindState();
+
+	UPROPERTY()
+	TObjectPtr<UBlockGridSubsystem> Grid;
+
+	// 영역(청크 좌표)별 기록
+	TMap<FIntVector, FRegionHistory> Regions;
+
+	// 되감기 재생 중 여부
+	bool bIsRewinding = false;
+
+	// 되감기 결과를 액터에 반영하는 중에는 기록하지 않음
+	bool bIsApplyingRewind = false;
+
+	// 되감기 대상 영역
+	TSet<FIntVector> RewindRegions;
+
+	// 시간 순으로 풀어낸 기록과, 그중 현재 재생 위치까지 적용된 개수
+	TArray<FBlockHistoryRecord> Timeline;
+	int32 AppliedCount = 0;
+
+	// 되감기 시작 시각과 되감을 수 있는 가장 오래된 시각 (틱)
+	int64 RewindStartTick = 0;
+	int64 RewindOldestTick = 0;
+
+	// 현재 재생 위치 (틱, 소수 허용)
+	double PlaybackTick = 0.0;
+
+	// 초당 배속
+	float PlaybackRate = -1.0f;
+
+	// 재생 위치의 Recordable 셀 상태 (셀 -> 팔레트 인덱스)
+	TMap<FIntVector, uint16> RewindCells;
+
+	// 재생 위치의 폭탄 개수
+	TMap<FIntVector, uint8> RewindBombCounts;
+
+	// 되감기 동안 숨긴 블록 액터
+	TArray<TWeakObjectPtr<ABlockBase>> HiddenBlocks;
+
+	// 되감기 상태를 그리는 액터와 팔레트별 인스턴스 메시
+	UPROPERTY()
+	TObjectPtr<AActor> RewindVisualActor;
+
+	// 팔레트 인덱스로 접근 (해당 팔레트가 아직 안 그려졌으면 nullptr)
+	UPROPERTY()
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> RewindMeshes;
+
+	// 인스턴스 메시 갱신 필요 여부
+	bool bRewindVisualDirty = false;
+};
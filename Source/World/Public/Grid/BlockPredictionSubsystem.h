@@ -0,0 +1,124 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayPrediction.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "Grid/BlockGridTypes.h"
+#include "BlockPredictionSubsystem.generated.h"
+
+class ABlockBase;
+class UBlockGridSubsystem;
+class UAbilitySystemComponent;
+
+/**
+ * 클라이언트 블록 건설 예측 서브시스템
+ * 원격 클라이언트가 블록을 건설하면 서버 응답을 기다리지 않고 로컬에 고스트 블록을 만들어 그리드에 넣는다.
+ * 고스트는 어빌리티의 FPredictionKey에 묶이며, 서버가 만든 실제 블록이 같은 셀에 복제되어 오면 교체되고
+ * 서버가 거부하면(예측 키 거부 또는 GenericCancel 이벤트) 롤백된다.
+ * 롤백 시 고스트 위에 착지했던 블록을 다시 깨워 낙하 결과도 되돌린다.
+ * @note 서버/스탠드얼론에서는 예측할 필요가 없으므로 사용하지 않는다.
+ */
+UCLASS()
+class WORLD_API UBlockPredictionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumCaughtUp > 0; }
+	virtual TStatId GetStatId() const override;
+
+	// 고스트 블록을 생성하고 예측 키에 묶음
+	// @param BlockClass: 서버가 생성할 블록과 같은 클래스
+	// @param Location: 블록 중심 위치
+	// @param BlockType: 서버가 설정할 블록 타입
+	// @param ASC: 예측한 시전자의 ASC (서버의 거부 이벤트 수신용)
+	// @param AbilityHandle: 예측한 어빌리티 스펙 핸들
+	// @param PredictionKey: 이 건설의 예측 키 (유효해야 함)
+	// @return 고스트 블록 (실패 시 nullptr)
+	ABlockBase* PredictBlock(
+		TSubclassOf<ABlockBase> BlockClass,
+		const FVector& Location,
+		EBlockType BlockType,
+		UAbilitySystemComponent* ASC,
+		FGameplayAbilitySpecHandle AbilityHandle,
+		FPredictionKey PredictionKey);
+
+	// 여러 고스트 블록을 하나의 예측 키에 묶음 (드래그 건설 등 한 번의 서버 RPC로 여러 블록을 만드는 경우)
+	// 서버 블록이 복제되어 오는 셀부터 하나씩 교체되며, 모든 셀이 교체되면 예측이 끝난다.
+	// 거부되면 남은 고스트를 모두 롤백한다.
+	// @param Locations: 블록 중심 위치 목록 (이미 점유된 셀은 건너뜀)
+	// @return 생성된 고스트 개수
+	int32 PredictBlocks(
+		TSubclassOf<ABlockBase> BlockClass,
+		TConstArrayView<FVector> Locations,
+		EBlockType BlockType,
+		UAbilitySystemComponent* ASC,
+		FGameplayAbilitySpecHandle AbilityHandle,
+		FPredictionKey PredictionKey);
+
+	// 아직 확정/롤백되지 않은 예측 수
+	int32 GetNumPendingPredictions() const { return Predictions.Num(); }
+
+	// 서버가 예측 키를 처리한 뒤 실제 블록이 복제되어 오기를 기다리는 최대 시간 (초)
+	// 이 시간 안에 오지 않으면 서버가 블록을 만들지 않은 것으로 보고 롤백
+	static constexpr float ReplicationTimeout = 1.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// 예측 하나의 상태
+	struct FBlockPrediction
+	{
+		FPredictionKey PredictionKey;
+
+		// 로컬 고스트 블록 (낙하하면 셀이 바뀔 수 있음, 교체된 고스트는 null)
+		TArray<TWeakObjectPtr<ABlockBase>> Ghosts;
+
+		// 고스트를 생성한 셀 (서버의 실제 블록도 이 셀에 생성됨). Ghosts와 같은 순서
+		TArray<FIntVector> SpawnCells;
+
+		// 아직 실제 블록으로 교체되지 않은 고스트 수
+		int32 NumUnresolved = 0;
+
+		// 거부 이벤트 정리용
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FGameplayAbilitySpecHandle AbilityHandle;
+
+		// 서버가 예측 키를 처리한 시각 (음수면 아직 응답 없음)
+		double CaughtUpTime = -1.0;
+	};
+
+	// 예측 키 델리게이트
+	void HandlePredictionRejected(FPredictionKey::KeyType KeyId);
+	void HandlePredictionCaughtUp(FPredictionKey::KeyType KeyId);
+
+	// 서버 어빌리티가 보낸 GenericCancel (예측 키는 통과했지만 건설 검증에 실패)
+	void HandleServerCancel(FPredictionKey::KeyType KeyId);
+
+	// 실제 블록이 고스트 셀에 등록되었는지 감시
+	void HandleBlockEvent(const FBlockGridEvent& Event);
+
+	// 예측 종료. 고스트를 제거하고 델리게이트/ASC 복제 데이터를 정리
+	// @param bRolledBack: 서버가 거부하여 되돌리는 것인지 (로그 구분용)
+	void FinishPrediction(FPredictionKey::KeyType KeyId, bool bRolledBack);
+
+	UPROPERTY()
+	TObjectPtr<UBlockGridSubsystem> Grid;
+
+	// 예측 키 -> 예측 상태
+	TMap<FPredictionKey::KeyType, FBlockPrediction> Predictions;
+
+	// 고스트 생성 셀 -> (예측 키, 고스트 인덱스) (실제 블록 등록 이벤트를 O(1)로 매칭)
+	TMap<FIntVector, TPair<FPredictionKey::KeyType, int32>> SpawnCellToKey;
+
+	// 서버 응답 후 실제 블록을 기다리는 예측 수 (0이면 Tick 불필요)
+	int32 NumCaughtUp = 0;
+};
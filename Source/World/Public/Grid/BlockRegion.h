@@ -0,0 +1,86 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 영역 윤곽선 하나 (셀 변으로 이루어진 닫힌 루프)
+struct FBlockRegionContour
+{
+	// 방향이 바뀌는 격자 꼭짓점 (셀 (X, Y)는 꼭짓점 (X, Y) ~ (X + 1, Y + 1)을 차지)
+	// 외곽선은 반시계, 내곽선(구멍)은 시계 방향
+	TArray<FIntPoint> Corners;
+
+	// 윤곽선을 따라 순서대로 만나는 영역 안쪽 셀 (연속 중복 제거)
+	TArray<FIntPoint> Cells;
+
+	// 윤곽선 길이 (셀 변 개수)
+	int32 Perimeter = 0;
+
+	// 구멍의 테두리이면 true, 바깥 테두리이면 false
+	bool bIsHole = false;
+};
+
+/**
+ * XY 평면 위의 정수 셀 영역 (비트셋)
+ * 행마다 64비트 워드 배열로 점유를 저장하고, 한 칸씩 여백을 두어 이웃 조회에 경계 검사가 필요 없다.
+ * 경계 셀은 워드 단위 비트 연산(상하 행 AND, 좌우 시프트 AND)으로 구하고,
+ * 윤곽선은 영역을 왼쪽에 두는 방향의 셀 변을 꼭짓점 비트마스크로 모아 따라가며 추출한다.
+ * @note 연결성은 4방향 기준이며, 대각선으로만 맞닿은 셀은 서로 다른 윤곽선으로 분리된다.
+ */
+class WORLD_API FBlockRegion2D
+{
+public:
+	// 이웃 방향 (+X, +Y, -X, -Y 순서, 반시계)
+	static const FIntPoint Directions[4];
+
+	FBlockRegion2D() = default;
+
+	// 셀 목록으로 영역 구성 (중복 셀은 하나로 취급)
+	explicit FBlockRegion2D(TConstArrayView<FIntPoint> Cells) { Build(Cells); }
+
+	// 셀 목록으로 영역을 다시 구성
+	void Build(TConstArrayView<FIntPoint> Cells);
+
+	// 영역 초기화
+	void Reset();
+
+	// 셀이 영역에 포함되는지 확인
+	bool Contains(const FIntPoint& Cell) const;
+
+	// 영역에 포함된 셀 수
+	int32 Num() const { return NumCells; }
+
+	bool IsEmpty() const { return NumCells == 0; }
+
+	// 영역을 감싸는 최소/최대 셀 (비어있으면 의미 없음)
+	FIntPoint GetMin() const { return Min; }
+	FIntPoint GetMax() const { return Min + Size - FIntPoint(1, 1); }
+
+	// 4방향 이웃 중 하나라도 영역 밖인 셀 (행 우선 순서)
+	void FindBoundaryCells(TArray<FIntPoint>& OutCells) const;
+
+	// 모든 외곽선과 내곽선(구멍) 추출
+	void FindContours(TArray<FBlockRegionContour>& OutContours) const;
+
+private:
+	// 여백을 포함한 로컬 비트 좌표 (셀 Min은 (1, 1))
+	bool TestBit(int32 LocalX, int32 LocalY) const
+	{
+		const uint64 Word = Bits[LocalY * WordsPerRow + (LocalX >> 6)];
+		return (Word >> (LocalX & 63)) & 1;
+	}
+
+	const uint64* GetRow(int32 LocalY) const { return Bits.GetData() + LocalY * WordsPerRow; }
+
+	// 점유 비트 (여백 포함 (Size.X + 2) x (Size.Y + 2))
+	TArray<uint64> Bits;
+
+	// 셀 영역의 원점과 크기 (여백 제외)
+	FIntPoint Min = FIntPoint::ZeroValue;
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	int32 WordsPerRow = 0;
+	int32 NumRows = 0;
+	int32 NumCells = 0;
+};